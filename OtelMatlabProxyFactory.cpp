@@ -1,4 +1,4 @@
-// Copyright 2023-2025 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "OtelMatlabProxyFactory.h"
 
@@ -22,16 +22,29 @@
 #include "opentelemetry-matlab/sdk/trace/TracerProviderProxy.h"
 #include "opentelemetry-matlab/sdk/trace/SimpleSpanProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/trace/BatchSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/FanoutSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/RingBufferSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/FlightRecorderSpanProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/trace/AlwaysOnSamplerProxy.h"
 #include "opentelemetry-matlab/sdk/trace/AlwaysOffSamplerProxy.h"
 #include "opentelemetry-matlab/sdk/trace/TraceIdRatioBasedSamplerProxy.h"
 #include "opentelemetry-matlab/sdk/trace/ParentBasedSamplerProxy.h"
+#include "opentelemetry-matlab/sdk/trace/SpoolSpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/trace/ChromeTraceSpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanExporterProxy.h"
 #include "opentelemetry-matlab/sdk/metrics/MeterProviderProxy.h"
 #include "opentelemetry-matlab/sdk/metrics/ViewProxy.h"
 #include "opentelemetry-matlab/sdk/metrics/PeriodicExportingMetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/SpoolMetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/ManualMetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/FanoutMetricReaderProxy.h"
 #include "opentelemetry-matlab/sdk/logs/LoggerProviderProxy.h"
 #include "opentelemetry-matlab/sdk/logs/SimpleLogRecordProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/logs/BatchLogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/RingBufferLogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/FlightRecorderLogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/SpoolLogRecordExporterProxy.h"
 #include "opentelemetry-matlab/sdk/common/InternalLogHandlerProxy.h"
 #ifdef WITH_OTLP_HTTP
     #include "opentelemetry-matlab/exporters/otlp/OtlpHttpSpanExporterProxy.h"
@@ -47,6 +60,15 @@
     #include "opentelemetry-matlab/exporters/otlp/OtlpFileSpanExporterProxy.h"
     #include "opentelemetry-matlab/exporters/otlp/OtlpFileMetricExporterProxy.h"
     #include "opentelemetry-matlab/exporters/otlp/OtlpFileLogRecordExporterProxy.h"
+    #include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileReaderProxy.h"
+    #include "opentelemetry-matlab/exporters/otlp/OtlpFileReplayerProxy.h"
+#endif
+#ifdef WITH_PARQUET
+    #include "opentelemetry-matlab/exporters/parquet/ParquetSpanExporterProxy.h"
+    #include "opentelemetry-matlab/exporters/parquet/ParquetLogRecordExporterProxy.h"
+#endif
+#ifdef WITH_PROMETHEUS
+    #include "opentelemetry-matlab/exporters/prometheus/PrometheusExporterProxy.h"
 #endif
 
 libmexclass::proxy::MakeResult
@@ -75,18 +97,31 @@ OtelMatlabProxyFactory::make_proxy(const libmexclass::proxy::ClassName& class_na
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.TracerProviderProxy, libmexclass::opentelemetry::sdk::TracerProviderProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.SimpleSpanProcessorProxy, libmexclass::opentelemetry::sdk::SimpleSpanProcessorProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.BatchSpanProcessorProxy, libmexclass::opentelemetry::sdk::BatchSpanProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.FanoutSpanProcessorProxy, libmexclass::opentelemetry::sdk::FanoutSpanProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.RingBufferSpanProcessorProxy, libmexclass::opentelemetry::sdk::RingBufferSpanProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.FlightRecorderSpanProcessorProxy, libmexclass::opentelemetry::sdk::FlightRecorderSpanProcessorProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.AlwaysOnSamplerProxy, libmexclass::opentelemetry::sdk::AlwaysOnSamplerProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.AlwaysOffSamplerProxy, libmexclass::opentelemetry::sdk::AlwaysOffSamplerProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.TraceIdRatioBasedSamplerProxy, libmexclass::opentelemetry::sdk::TraceIdRatioBasedSamplerProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.ParentBasedSamplerProxy, libmexclass::opentelemetry::sdk::ParentBasedSamplerProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.SpoolSpanExporterProxy, libmexclass::opentelemetry::sdk::SpoolSpanExporterProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.ChromeTraceSpanExporterProxy, libmexclass::opentelemetry::sdk::ChromeTraceSpanExporterProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.CollapsedStackSpanProcessorProxy, libmexclass::opentelemetry::sdk::CollapsedStackSpanProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.CollapsedStackSpanExporterProxy, libmexclass::opentelemetry::sdk::CollapsedStackSpanExporterProxy);
 
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.MeterProviderProxy, libmexclass::opentelemetry::sdk::MeterProviderProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.ViewProxy, libmexclass::opentelemetry::sdk::ViewProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.PeriodicExportingMetricReaderProxy, libmexclass::opentelemetry::sdk::PeriodicExportingMetricReaderProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.SpoolMetricExporterProxy, libmexclass::opentelemetry::sdk::SpoolMetricExporterProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.ManualMetricReaderProxy, libmexclass::opentelemetry::sdk::ManualMetricReaderProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.FanoutMetricReaderProxy, libmexclass::opentelemetry::sdk::FanoutMetricReaderProxy);
 
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.LoggerProviderProxy, libmexclass::opentelemetry::sdk::LoggerProviderProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.SimpleLogRecordProcessorProxy, libmexclass::opentelemetry::sdk::SimpleLogRecordProcessorProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.BatchLogRecordProcessorProxy, libmexclass::opentelemetry::sdk::BatchLogRecordProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.RingBufferLogRecordProcessorProxy, libmexclass::opentelemetry::sdk::RingBufferLogRecordProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.FlightRecorderLogRecordProcessorProxy, libmexclass::opentelemetry::sdk::FlightRecorderLogRecordProcessorProxy);
+    REGISTER_PROXY(libmexclass.opentelemetry.sdk.SpoolLogRecordExporterProxy, libmexclass::opentelemetry::sdk::SpoolLogRecordExporterProxy);
     REGISTER_PROXY(libmexclass.opentelemetry.sdk.InternalLogHandlerProxy, libmexclass::opentelemetry::sdk::InternalLogHandlerProxy);
 
     #ifdef WITH_OTLP_HTTP
@@ -103,6 +138,15 @@ OtelMatlabProxyFactory::make_proxy(const libmexclass::proxy::ClassName& class_na
         REGISTER_PROXY(libmexclass.opentelemetry.exporters.OtlpFileSpanExporterProxy, libmexclass::opentelemetry::exporters::OtlpFileSpanExporterProxy);
         REGISTER_PROXY(libmexclass.opentelemetry.exporters.OtlpFileMetricExporterProxy, libmexclass::opentelemetry::exporters::OtlpFileMetricExporterProxy);
         REGISTER_PROXY(libmexclass.opentelemetry.exporters.OtlpFileLogRecordExporterProxy, libmexclass::opentelemetry::exporters::OtlpFileLogRecordExporterProxy);
+        REGISTER_PROXY(libmexclass.opentelemetry.exporters.OtlpBinaryFileReaderProxy, libmexclass::opentelemetry::exporters::OtlpBinaryFileReaderProxy);
+        REGISTER_PROXY(libmexclass.opentelemetry.exporters.OtlpFileReplayerProxy, libmexclass::opentelemetry::exporters::OtlpFileReplayerProxy);
+    #endif
+    #ifdef WITH_PARQUET
+        REGISTER_PROXY(libmexclass.opentelemetry.exporters.ParquetSpanExporterProxy, libmexclass::opentelemetry::exporters::ParquetSpanExporterProxy);
+        REGISTER_PROXY(libmexclass.opentelemetry.exporters.ParquetLogRecordExporterProxy, libmexclass::opentelemetry::exporters::ParquetLogRecordExporterProxy);
+    #endif
+    #ifdef WITH_PROMETHEUS
+        REGISTER_PROXY(libmexclass.opentelemetry.exporters.PrometheusExporterProxy, libmexclass::opentelemetry::exporters::PrometheusExporterProxy);
     #endif
     return nullptr;
 }
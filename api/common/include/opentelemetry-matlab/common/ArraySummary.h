@@ -0,0 +1,29 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libmexclass::opentelemetry {
+
+// Summary statistics of a numeric array. NaN values are counted and otherwise ignored.
+struct ArraySummary {
+    double Min;
+    double Max;
+    double Mean;
+    double StdDev;      // normalized by N-1, as MATLAB std
+    double L2Norm;
+    uint64_t NaNCount;
+    uint64_t Hash;      // hash of the raw element bytes
+};
+
+// Compute summary statistics in a single pass over the data. The double version uses SSE2 or
+// NEON when available.
+ArraySummary summarizeArray(const double* data, size_t n);
+ArraySummary summarizeArray(const int32_t* data, size_t n);
+ArraySummary summarizeArray(const uint32_t* data, size_t n);
+ArraySummary summarizeArray(const int64_t* data, size_t n);
+ArraySummary summarizeArray(const bool* data, size_t n);
+
+} // namespace libmexclass::opentelemetry
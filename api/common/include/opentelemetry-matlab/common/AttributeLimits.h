@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/common/LimitsRegistry.h"
+
+#include <cstddef>
+#include <limits>
+
+namespace libmexclass::opentelemetry {
+
+// Limits applied while converting MATLAB attribute values, so that oversized values are
+// truncated or rejected before their data is copied
+struct AttributeLimits {
+    static constexpr size_t Unlimited = (std::numeric_limits<size_t>::max)();
+
+    size_t MaxValueLength = Unlimited;   // maximum characters in a string value, or in each string of a string array
+    size_t MaxBytes = Unlimited;         // budget for the estimated size of attribute names and values
+    size_t ArraySummaryThreshold = Unlimited;   // numeric arrays with more elements are replaced by summary statistics
+    size_t UsedBytes = 0;                // portion of the budget already used
+
+    // Take the given number of bytes from the budget. Returns false, leaving the budget
+    // unchanged, if there is not enough left.
+    bool reserve(size_t bytes) {
+        if (bytes > MaxBytes - UsedBytes) {
+            return false;
+        }
+        UsedBytes += bytes;
+        return true;
+    }
+
+    size_t remaining() const {
+        return MaxBytes - UsedBytes;
+    }
+};
+
+// attribute limits of logger and meter providers
+using AttributeLimitsRegistry = LimitsRegistry<AttributeLimits>;
+} // namespace libmexclass::opentelemetry
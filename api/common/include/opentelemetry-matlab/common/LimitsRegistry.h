@@ -0,0 +1,44 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace libmexclass::opentelemetry {
+
+// Registry of limits keyed by provider. Limits are configured on SDK providers, but are
+// enforced by API proxies, which may get the provider through the global instance.
+template <typename Limits>
+class LimitsRegistry {
+  public:
+    static void set(const void* provider, std::shared_ptr<const Limits> limits) {
+        std::lock_guard<std::mutex> lock(mutex());
+        entries()[provider] = std::move(limits);
+    }
+
+    // returns null if no limits are set for the provider
+    static std::shared_ptr<const Limits> get(const void* provider) {
+        std::lock_guard<std::mutex> lock(mutex());
+        auto iter = entries().find(provider);
+        return iter == entries().end() ? nullptr : iter->second;
+    }
+
+    static void erase(const void* provider) {
+        std::lock_guard<std::mutex> lock(mutex());
+        entries().erase(provider);
+    }
+
+  private:
+    static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+    }
+
+    static std::unordered_map<const void*, std::shared_ptr<const Limits> >& entries() {
+        static std::unordered_map<const void*, std::shared_ptr<const Limits> > e;
+        return e;
+    }
+};
+} // namespace libmexclass::opentelemetry
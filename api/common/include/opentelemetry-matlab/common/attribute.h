@@ -1,7 +1,8 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 #include "opentelemetry-matlab/common/ProcessedAttributes.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
 
 #include "opentelemetry/common/attribute_value.h"
 #include "opentelemetry/nostd/string_view.h"
@@ -9,14 +10,29 @@
 #include "MatlabDataArray.hpp"
 
 #include <list>
+#include <string>
+#include <unordered_map>
 
 namespace common = opentelemetry::common;
 namespace nostd = opentelemetry::nostd;
 
 namespace libmexclass::opentelemetry {
 
-void processAttribute(const std::string& attrname, 			// input, attribute name
+// Returns false if the attribute is ignored, because its type is not supported or it does not
+// fit within the byte budget of the optional limits
+bool processAttribute(const std::string& attrname, 			// input, attribute name
 		const matlab::data::Array& attrvalue, 			// input, unprocessed attribute value 
-		ProcessedAttributes& attrs);                            // output, processed attributes struct
+		ProcessedAttributes& attrs,                             // output, processed attributes struct
+		AttributeLimits* limits = nullptr);                     // input/output, optional limits and remaining budget
+
+// bytes of the budget charged for each attribute name that has been set
+using AttributeCharges = std::unordered_map<std::string, size_t>;
+
+// Same as processAttribute with limits, for attributes that may be set again. New names are
+// ignored once maxattributes names are set, and an attribute that is set again is charged only
+// for its new value.
+bool processAttribute(const std::string& attrname, const matlab::data::Array& attrvalue,
+		ProcessedAttributes& attrs, AttributeLimits& limits, AttributeCharges& charges,
+		size_t maxattributes);
 
 } // namespace libmexclass::opentelemetry
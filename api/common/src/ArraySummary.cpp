@@ -0,0 +1,215 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/common/ArraySummary.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OTEL_MATLAB_SUMMARY_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define OTEL_MATLAB_SUMMARY_NEON
+#include <arm_neon.h>
+#endif
+
+namespace libmexclass::opentelemetry {
+
+namespace {
+const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t Prime3 = 0x165667B19E3779F9ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t load64(const unsigned char* p) {
+    uint64_t w;
+    std::memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+// xxHash64-style hash with four independent lanes, so that it keeps up with the reductions
+uint64_t hashBytes(const void* data, size_t len) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t lanes[4] = {Prime1 + Prime2, Prime2, 0, 0 - Prime1};
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        for (int k = 0; k < 4; ++k) {
+            lanes[k] = rotl(lanes[k] + load64(p + i + 8 * k) * Prime2, 31) * Prime1;
+        }
+    }
+    uint64_t h = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+    for (; i + 8 <= len; i += 8) {
+        h ^= rotl(load64(p + i) * Prime2, 31) * Prime1;
+        h = rotl(h, 27) * Prime1 + Prime3;
+    }
+    for (; i < len; ++i) {
+        h ^= p[i] * Prime3;
+        h = rotl(h, 11) * Prime1;
+    }
+    h ^= static_cast<uint64_t>(len);
+    h ^= h >> 33;
+    h *= Prime2;
+    h ^= h >> 29;
+    h *= Prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Running sums are taken relative to a shift value close to the data, which avoids most of the
+// cancellation of the one-pass variance formula
+struct Accumulator {
+    double Min = std::numeric_limits<double>::infinity();
+    double Max = -std::numeric_limits<double>::infinity();
+    double Sum = 0;      // sum of (x - shift)
+    double SumSq = 0;    // sum of (x - shift)^2
+    double L2 = 0;       // sum of x^2
+    uint64_t Valid = 0;  // number of non-NaN values
+
+    void add(double x, double shift) {
+        if (x != x) {
+            return;
+        }
+        double d = x - shift;
+        Min = x < Min ? x : Min;
+        Max = x > Max ? x : Max;
+        Sum += d;
+        SumSq += d * d;
+        L2 += x * x;
+        ++Valid;
+    }
+
+    ArraySummary finish(double shift, size_t n) const {
+        ArraySummary s;
+        s.NaNCount = n - Valid;
+        s.L2Norm = std::sqrt(L2);
+        if (Valid == 0) {
+            double nan = std::numeric_limits<double>::quiet_NaN();
+            s.Min = s.Max = s.Mean = s.StdDev = nan;
+        } else {
+            double nvalid = static_cast<double>(Valid);
+            s.Min = Min;
+            s.Max = Max;
+            s.Mean = shift + Sum / nvalid;
+            double ss = SumSq - Sum * Sum / nvalid;
+            s.StdDev = Valid > 1 && ss > 0 ? std::sqrt(ss / (nvalid - 1)) : 0;
+        }
+        return s;
+    }
+};
+
+template <typename T>
+ArraySummary summarizeConverted(const T* data, size_t n) {
+    Accumulator acc;
+    double shift = n > 0 ? static_cast<double>(data[0]) : 0;
+    for (size_t i = 0; i < n; ++i) {
+        acc.add(static_cast<double>(data[i]), shift);
+    }
+    ArraySummary s = acc.finish(shift, n);
+    s.Hash = hashBytes(data, n * sizeof(T));
+    return s;
+}
+} // namespace
+
+ArraySummary summarizeArray(const double* data, size_t n) {
+    // shift by the first non-NaN value
+    size_t first = 0;
+    while (first < n && data[first] != data[first]) {
+        ++first;
+    }
+    double shift = first < n ? data[first] : 0;
+    Accumulator acc;
+    size_t i = first;
+
+#if defined(OTEL_MATLAB_SUMMARY_SSE2)
+    __m128d vmin = _mm_set1_pd(acc.Min);
+    __m128d vmax = _mm_set1_pd(acc.Max);
+    __m128d vsum = _mm_setzero_pd();
+    __m128d vsumsq = _mm_setzero_pd();
+    __m128d vl2 = _mm_setzero_pd();
+    __m128i vvalid = _mm_setzero_si128();
+    const __m128d vshift = _mm_set1_pd(shift);
+    for (; i + 2 <= n; i += 2) {
+        __m128d x = _mm_loadu_pd(data + i);
+        __m128d ordered = _mm_cmpord_pd(x, x);   // all ones in lanes that are not NaN
+        // minpd and maxpd return the second operand when the first is NaN
+        vmin = _mm_min_pd(x, vmin);
+        vmax = _mm_max_pd(x, vmax);
+        __m128d d = _mm_and_pd(_mm_sub_pd(x, vshift), ordered);
+        __m128d xm = _mm_and_pd(x, ordered);
+        vsum = _mm_add_pd(vsum, d);
+        vsumsq = _mm_add_pd(vsumsq, _mm_mul_pd(d, d));
+        vl2 = _mm_add_pd(vl2, _mm_mul_pd(xm, xm));
+        vvalid = _mm_sub_epi64(vvalid, _mm_castpd_si128(ordered));   // subtracting -1 counts a lane
+    }
+    double lanes[2];
+    uint64_t counts[2];
+    _mm_storeu_pd(lanes, vmin);
+    acc.Min = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+    _mm_storeu_pd(lanes, vmax);
+    acc.Max = lanes[0] > lanes[1] ? lanes[0] : lanes[1];
+    _mm_storeu_pd(lanes, vsum);
+    acc.Sum = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, vsumsq);
+    acc.SumSq = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, vl2);
+    acc.L2 = lanes[0] + lanes[1];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(counts), vvalid);
+    acc.Valid = counts[0] + counts[1];
+#elif defined(OTEL_MATLAB_SUMMARY_NEON)
+    float64x2_t vmin = vdupq_n_f64(acc.Min);
+    float64x2_t vmax = vdupq_n_f64(acc.Max);
+    float64x2_t vsum = vdupq_n_f64(0);
+    float64x2_t vsumsq = vdupq_n_f64(0);
+    float64x2_t vl2 = vdupq_n_f64(0);
+    uint64x2_t vvalid = vdupq_n_u64(0);
+    const float64x2_t vshift = vdupq_n_f64(shift);
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t x = vld1q_f64(data + i);
+        uint64x2_t ordered = vceqq_f64(x, x);   // all ones in lanes that are not NaN
+        // minnm and maxnm ignore NaN operands
+        vmin = vminnmq_f64(vmin, x);
+        vmax = vmaxnmq_f64(vmax, x);
+        float64x2_t d = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(vsubq_f64(x, vshift)), ordered));
+        float64x2_t xm = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(x), ordered));
+        vsum = vaddq_f64(vsum, d);
+        vsumsq = vfmaq_f64(vsumsq, d, d);
+        vl2 = vfmaq_f64(vl2, xm, xm);
+        vvalid = vsubq_u64(vvalid, ordered);   // subtracting all ones counts a lane
+    }
+    acc.Min = vminnmvq_f64(vmin);
+    acc.Max = vmaxnmvq_f64(vmax);
+    acc.Sum = vaddvq_f64(vsum);
+    acc.SumSq = vaddvq_f64(vsumsq);
+    acc.L2 = vaddvq_f64(vl2);
+    acc.Valid = vgetq_lane_u64(vvalid, 0) + vgetq_lane_u64(vvalid, 1);
+#endif
+
+    // remaining elements, or all of them without SIMD support
+    for (; i < n; ++i) {
+        acc.add(data[i], shift);
+    }
+    ArraySummary s = acc.finish(shift, n);
+    s.Hash = hashBytes(data, n * sizeof(double));
+    return s;
+}
+
+ArraySummary summarizeArray(const int32_t* data, size_t n) {
+    return summarizeConverted(data, n);
+}
+
+ArraySummary summarizeArray(const uint32_t* data, size_t n) {
+    return summarizeConverted(data, n);
+}
+
+ArraySummary summarizeArray(const int64_t* data, size_t n) {
+    return summarizeConverted(data, n);
+}
+
+ArraySummary summarizeArray(const bool* data, size_t n) {
+    return summarizeConverted(data, n);
+}
+} // namespace libmexclass::opentelemetry
@@ -1,15 +1,154 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 
 #include "opentelemetry-matlab/common/attribute.h"
+#include "opentelemetry-matlab/common/ArraySummary.h"
 
 #include "opentelemetry/nostd/span.h"
 
+#include <cstdio>
+
 namespace libmexclass::opentelemetry {
 
-void processAttribute(const std::string& attrname, 			// input, attribute name
+namespace {
+// size in bytes of each element of supported numeric and logical types, 0 for other types
+size_t elementSize(matlab::data::ArrayType valtype) {
+    switch (valtype) {
+        case matlab::data::ArrayType::DOUBLE:
+        case matlab::data::ArrayType::INT64:
+            return 8;
+        case matlab::data::ArrayType::INT32:
+        case matlab::data::ArrayType::UINT32:
+            return 4;
+        case matlab::data::ArrayType::LOGICAL:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// number of UTF-16 code units kept when a string is shortened to at most n, without splitting
+// a surrogate pair
+size_t truncatedLength(const matlab::data::String& str, size_t n) {
+    if (str.size() <= n) {
+        return str.size();
+    }
+    if (n > 0 && str[n-1] >= 0xD800 && str[n-1] <= 0xDBFF) {
+        --n;
+    }
+    return n;
+}
+
+// convert the first n UTF-16 code units of a string to UTF-8
+std::string toUTF8(const matlab::data::String& str, size_t n) {
+    std::string out;
+    out.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t c = str[i];
+        if (c >= 0xD800 && c <= 0xDBFF && i + 1 < n && str[i+1] >= 0xDC00 && str[i+1] <= 0xDFFF) {
+            c = 0x10000 + ((c - 0xD800) << 10) + (str[i+1] - 0xDC00);
+            ++i;
+        }
+        if (c < 0x80) {
+            out.push_back(static_cast<char>(c));
+        } else if (c < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else if (c < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (c >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+    return out;
+}
+
+// Convert the strings in a string array, truncated to the length limit. Only the retained
+// part of each string is converted, straight from the element returned by the data array.
+// Returns false if the strings cannot fit in the remaining budget.
+bool convertStrings(const matlab::data::StringArray& attrvalue_mda, size_t budget,
+		AttributeLimits& limits, std::list<std::string>& out) {
+    size_t nbytes = 0;
+    for (auto itr = attrvalue_mda.begin(); itr < attrvalue_mda.end(); ++itr) {
+        const matlab::data::String& str = *itr;
+        size_t n = truncatedLength(str, limits.MaxValueLength);
+        // UTF-8 needs at least one byte per UTF-16 code unit, so bail out before converting
+        if (n > budget - nbytes) {
+            return false;
+        }
+        out.push_back(toUTF8(str, n));
+        nbytes += out.back().size();
+        if (nbytes > budget) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+ArraySummary summarizeTypedArray(const matlab::data::Array& attrvalue) {
+    matlab::data::TypedArray<T> attrvalue_mda = attrvalue;
+    return summarizeArray(&(*attrvalue_mda.cbegin()), attrvalue_mda.getNumberOfElements());
+}
+
+// Replace a large numeric array with summary statistics, plus the usual size attribute
+bool processArraySummary(const std::string& attrname, const matlab::data::Array& attrvalue,
+		matlab::data::ArrayType valtype, ProcessedAttributes& attrs, AttributeLimits& limits) {
+    ArraySummary summary;
+    switch (valtype) {
+        case matlab::data::ArrayType::DOUBLE:
+            summary = summarizeTypedArray<double>(attrvalue);
+            break;
+        case matlab::data::ArrayType::INT32:
+            summary = summarizeTypedArray<int32_t>(attrvalue);
+            break;
+        case matlab::data::ArrayType::UINT32:
+            summary = summarizeTypedArray<uint32_t>(attrvalue);
+            break;
+        case matlab::data::ArrayType::INT64:
+            summary = summarizeTypedArray<int64_t>(attrvalue);
+            break;
+        default:   // LOGICAL
+            summary = summarizeTypedArray<bool>(attrvalue);
+            break;
+    }
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(summary.Hash));
+
+    matlab::data::ArrayDimensions attrdims = attrvalue.getDimensions();
+    // 8 names with 44 characters of suffixes, 6 numbers, a 16 character hash, and the dimensions
+    size_t nbytes = 8 * attrname.size() + 44 + 6 * sizeof(double) + 16 + attrdims.size() * sizeof(double);
+    if (!limits.reserve(nbytes)) {
+        return false;
+    }
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".min", summary.Min));
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".max", summary.Max));
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".mean", summary.Mean));
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".std", summary.StdDev));
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".nan_count",
+			    static_cast<int64_t>(summary.NaNCount)));
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".l2norm", summary.L2Norm));
+    attrs.StringBuffer.push_back(hash);
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".hash",
+			    nostd::string_view(attrs.StringBuffer.back())));
+
+    std::vector<double> attrvalue_dims_buffer(attrdims.begin(), attrdims.end());
+    attrs.DimensionsBuffer.push_back(attrvalue_dims_buffer);
+    attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname + ".size",
+	  nostd::span<const double>{attrs.DimensionsBuffer.back().data(), attrvalue_dims_buffer.size()}));
+    return true;
+}
+} // namespace
+
+bool processAttribute(const std::string& attrname, 			// input, attribute name
 		const matlab::data::Array& attrvalue,			// input, unprocessed attribute value 
-		ProcessedAttributes& attrs)  	                        // output, processed attribute struct
+		ProcessedAttributes& attrs,  	                        // output, processed attribute struct
+		AttributeLimits* limits)                                // input/output, optional limits and remaining budget
 {
     std::vector<double> attrvalue_dims_buffer; // dimensions of array attribute, cast to double
 
@@ -18,6 +157,27 @@ void processAttribute(const std::string& attrname, 			// input, attribute name
 
     // TODO Consider using templates instead of a giant switchyard
     size_t nelements = matlab::data::getNumElements(attrdims);
+    if (limits != nullptr && nelements > limits->ArraySummaryThreshold && elementSize(valtype) > 0) {
+       return processArraySummary(attrname, attrvalue, valtype, attrs, *limits);
+    }
+    if (limits != nullptr && valtype != matlab::data::ArrayType::MATLAB_STRING) {
+       // check the budget before any data is copied. Arrays also need a size attribute.
+       size_t esize = elementSize(valtype);
+       if (esize == 0) {
+          return false;
+       }
+       size_t nbytes = attrname.size();
+       if (nbytes > limits->remaining() || nelements > (limits->remaining() - nbytes) / esize) {
+          return false;
+       }
+       nbytes += nelements * esize;
+       if (nelements != 1) {
+          nbytes += attrname.size() + 5 + attrdims.size() * sizeof(double);
+       }
+       if (!limits->reserve(nbytes)) {
+          return false;
+       }
+    }
     if (nelements == 1) { // scalar case
        if (valtype == matlab::data::ArrayType::DOUBLE) {
           matlab::data::TypedArray<double> attrvalue_mda = attrvalue;
@@ -36,10 +196,22 @@ void processAttribute(const std::string& attrname, 			// input, attribute name
           attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname, attrvalue_mda[0]));
        } else if (valtype == matlab::data::ArrayType::MATLAB_STRING) {   // string
           matlab::data::StringArray attrvalue_mda = attrvalue;
-          attrs.StringBuffer.push_back(static_cast<std::string>(*(attrvalue_mda.begin())));
+          if (limits != nullptr) {
+             if (attrname.size() > limits->remaining()) {
+                return false;
+             }
+             std::list<std::string> converted;
+             if (!convertStrings(attrvalue_mda, limits->remaining() - attrname.size(), *limits, converted)) {
+                return false;
+             }
+             limits->reserve(attrname.size() + converted.back().size());
+             attrs.StringBuffer.splice(attrs.StringBuffer.end(), converted);
+          } else {
+             attrs.StringBuffer.push_back(static_cast<std::string>(*(attrvalue_mda.begin())));
+          }
           attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname, attrs.StringBuffer.back()));
        } else {   // ignore all other types
-	   return;
+	   return false;
        }
     } else {  // array case
        if (valtype == matlab::data::ArrayType::DOUBLE) {
@@ -67,15 +239,35 @@ void processAttribute(const std::string& attrname, 			// input, attribute name
 	  std::vector<nostd::string_view> strarray_attr;
 	  strarray_attr.reserve(nelements);
 	  
-	  for (auto itr = attrvalue_mda.begin(); itr < attrvalue_mda.end(); ++itr) {
-             attrs.StringBuffer.push_back(static_cast<std::string>(*itr));
-	     strarray_attr.push_back(attrs.StringBuffer.back());
+	  if (limits != nullptr) {
+             size_t overhead = 2 * attrname.size() + 5 + attrdims.size() * sizeof(double);
+             if (overhead > limits->remaining()) {
+                return false;
+             }
+             std::list<std::string> converted;
+             if (!convertStrings(attrvalue_mda, limits->remaining() - overhead, *limits, converted)) {
+                return false;
+             }
+             size_t nbytes = overhead;
+             for (const auto& str : converted) {
+                nbytes += str.size();
+             }
+             limits->reserve(nbytes);
+             for (const auto& str : converted) {
+                attrs.StringBuffer.push_back(str);
+                strarray_attr.push_back(attrs.StringBuffer.back());
+             }
+	  } else {
+	     for (auto itr = attrvalue_mda.begin(); itr < attrvalue_mda.end(); ++itr) {
+                attrs.StringBuffer.push_back(static_cast<std::string>(*itr));
+	        strarray_attr.push_back(attrs.StringBuffer.back());
+	     }
 	  }
 	  attrs.StringViewBuffer.push_back(strarray_attr);
           attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(attrname, 
 	     nostd::span<const nostd::string_view>{&(*attrs.StringViewBuffer.back().cbegin()), attrvalue_mda.getNumberOfElements()}));
        } else {   // ignore all other types
-	   return;
+	   return false;
        }
        // Add a size attribute to preserve the shape
        std::string sizeattr{attrname + ".size"};
@@ -87,5 +279,25 @@ void processAttribute(const std::string& attrname, 			// input, attribute name
        attrs.Attributes.push_back(std::pair<std::string, common::AttributeValue>(sizeattr, 
 	  nostd::span<const double>{attrs.DimensionsBuffer.back().data(), attrvalue_dims_buffer.size()})); 
     }
+    return true;
+}
+
+bool processAttribute(const std::string& attrname, const matlab::data::Array& attrvalue,
+		ProcessedAttributes& attrs, AttributeLimits& limits, AttributeCharges& charges,
+		size_t maxattributes) {
+    auto found = charges.find(attrname);
+    if (found == charges.end() && charges.size() >= maxattributes) {
+        return false;
+    }
+    // the new value replaces the old one, so only the new value counts towards the budget
+    size_t oldcharge = found == charges.end() ? 0 : found->second;
+    limits.UsedBytes -= oldcharge;
+    size_t usedbefore = limits.UsedBytes;
+    if (!processAttribute(attrname, attrvalue, attrs, &limits)) {
+        limits.UsedBytes += oldcharge;   // the old value is kept
+        return false;
+    }
+    charges[attrname] = limits.UsedBytes - usedbefore;
+    return true;
 }
 } // namespace
@@ -2,12 +2,12 @@ classdef Context
 % Propagation mechanism used to carry context data across functions and
 % external interfaces.
 
-% Copyright 2023-2024 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     properties (Access={?opentelemetry.context.propagation.TextMapPropagator, ...
             ?opentelemetry.trace.Span, ?opentelemetry.trace.SpanContext, ...
             ?opentelemetry.trace.Tracer, ?opentelemetry.logs.Logger, ...
-            ?opentelemetry.baggage.Baggage})
+            ?opentelemetry.baggage.Baggage, ?opentelemetry.metrics.SynchronousInstrument})
         Proxy   % Proxy object to interface C++ code
     end
 
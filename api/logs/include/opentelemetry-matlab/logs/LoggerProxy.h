@@ -1,19 +1,25 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/method/Context.h"
 
 #include "opentelemetry/logs/logger.h"
 
+#include <memory>
+
 namespace logs_api = opentelemetry::logs;
 namespace nostd = opentelemetry::nostd;
 
 namespace libmexclass::opentelemetry {
 class LoggerProxy : public libmexclass::proxy::Proxy {
   public:
-    LoggerProxy(nostd::shared_ptr<logs_api::Logger> lg) : CppLogger(lg) {
+    // limits is null if the logger provider has no attribute limits
+    LoggerProxy(nostd::shared_ptr<logs_api::Logger> lg, std::shared_ptr<const AttributeLimits> limits = nullptr)
+	    : CppLogger(lg), Limits(std::move(limits)) {
         REGISTER_METHOD(LoggerProxy, emitLogRecord);
     }
 
@@ -22,5 +28,7 @@ class LoggerProxy : public libmexclass::proxy::Proxy {
   private:
 
     nostd::shared_ptr<logs_api::Logger> CppLogger;
+
+    std::shared_ptr<const AttributeLimits> Limits;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,7 +1,8 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/logs/LoggerProviderProxy.h"
 #include "opentelemetry-matlab/logs/LoggerProxy.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/logs/provider.h"
@@ -20,7 +21,8 @@ void LoggerProviderProxy::getLogger(libmexclass::proxy::method::Context& context
    auto lg = CppLoggerProvider->GetLogger(name, version, schema);
 
    // instantiate a LoggerProxy instance
-   LoggerProxy* newproxy = new LoggerProxy(lg);
+   // attribute limits are set on SDK logger providers, look them up here so that they also apply to the global instance
+   LoggerProxy* newproxy = new LoggerProxy(lg, AttributeLimitsRegistry::get(CppLoggerProvider.get()));
    auto lgproxy = std::shared_ptr<libmexclass::proxy::Proxy>(newproxy);
     
    // obtain a proxy ID
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/logs/LoggerProxy.h"
 #include "opentelemetry-matlab/common/attribute.h"
@@ -85,11 +85,13 @@ void LoggerProxy::emitLogRecord(libmexclass::proxy::method::Context& context) {
           matlab::data::CellArray attrvalues_mda = context.inputs[curridx];
           ProcessedAttributes attrs;
           if (nattrs > 0) {
+             // each log record gets a fresh copy of the limits
+             AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
              for (size_t i = 0; i < nattrs; ++i) {
                 std::string attrname = static_cast<std::string>(attrnames_mda[i]);
                 matlab::data::Array attrvalue = attrvalues_mda[i];
 
-                processAttribute(attrname, attrvalue, attrs);
+                processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
              }
              auto record_attribute = [&](const std::pair<std::string, common::AttributeValue> attr) 
                  {rec->SetAttribute(attr.first, attr.second);};
@@ -0,0 +1,136 @@
+classdef CoalescingBuffer < handle
+    % Sums of the increments of a coalescing counter, one per attribute
+    % set. For internal use only.
+
+    % Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        Instrument          % Counter or UpDownCounter the sums are flushed into
+        FlushCount          % Number of add calls between flushes
+        FlushInterval       % Maximum time between flushes checked by add, in seconds
+    end
+
+    properties (Access=private)
+        AllowNegative       % false for counters, whose negative increments are ignored
+        NumSets = 0         % Number of attribute sets seen
+        Inputs = {}         % Attribute inputs of each set, in lookup form
+        Hashes = uint64([]) % Hash of the attribute inputs of each set
+        AttributeKeys = {}  % Processed attribute names of each set
+        AttributeValues = {}  % Processed attribute values of each set
+        Sums = []           % Sum of increments of each set since the last flush
+        Pending = false(1,0)  % Whether each set has increments since the last flush
+        NumCalls = 0        % Number of add calls since the last flush
+        LastFlush           % Time of the last flush, from tic
+    end
+
+    properties (Constant, Access=private)
+        InitialCapacity = 16
+    end
+
+    methods
+        function obj = CoalescingBuffer(instrument, flushcount, flushinterval)
+            obj.Instrument = instrument;
+            obj.AllowNegative = isa(instrument, "opentelemetry.metrics.UpDownCounter");
+            obj.FlushCount = flushcount;
+            obj.FlushInterval = flushinterval;
+            obj.grow(obj.InitialCapacity);
+            % the first set has no attributes
+            obj.NumSets = 1;
+            obj.Inputs{1} = {};
+            obj.AttributeKeys{1} = strings(1,0);
+            obj.AttributeValues{1} = {};
+            obj.LastFlush = tic;
+        end
+
+        function add(obj, value, varargin)
+            % same input checks as Counter.add and UpDownCounter.add
+            if ~(isnumeric(value) && isscalar(value) && isreal(value)) || ...
+                    (value < 0 && ~obj.AllowNegative)
+                return
+            end
+            slot = obj.findSet(varargin);
+            obj.Sums(slot) = obj.Sums(slot) + double(value);
+            obj.Pending(slot) = true;
+            obj.NumCalls = obj.NumCalls + 1;
+            if obj.NumCalls >= obj.FlushCount || toc(obj.LastFlush) >= obj.FlushInterval
+                obj.flush();
+            end
+        end
+
+        function flush(obj)
+            % pass the sums of all attribute sets to the instrument in one
+            % call, then start over
+            idx = find(obj.Pending);
+            if ~isempty(idx)
+                obj.Instrument.processValues(obj.Sums(idx), ...
+                    obj.AttributeKeys(idx), obj.AttributeValues(idx));
+                obj.Sums(idx) = 0;
+                obj.Pending(idx) = false;
+            end
+            obj.NumCalls = 0;
+            obj.LastFlush = tic;
+        end
+    end
+
+    methods (Access=private)
+        function slot = findSet(obj, inputs)
+            % index of the attribute set, adding a new set if not found
+            if isempty(inputs)
+                slot = 1;
+                return
+            end
+            form = lookupForm(inputs);
+            h = keyHash(withoutNaN(form));
+            candidates = find(obj.Hashes(1:obj.NumSets) == h);
+            for slot = candidates   % hashes can collide
+                % NaN attribute values are equal, otherwise every add
+                % with a NaN value would create a new set
+                if isequaln(obj.Inputs{slot}, form)
+                    return
+                end
+            end
+            [attrkeys, attrvalues] = opentelemetry.common.processAttributes(inputs);
+            if obj.NumSets == numel(obj.Sums)
+                obj.grow(2 * obj.NumSets);
+            end
+            obj.NumSets = obj.NumSets + 1;
+            slot = obj.NumSets;
+            obj.Inputs{slot} = form;
+            obj.Hashes(slot) = h;
+            obj.AttributeKeys{slot} = attrkeys;
+            obj.AttributeValues{slot} = attrvalues;
+        end
+
+        function grow(obj, capacity)
+            % preallocate space for attribute sets
+            n = capacity - numel(obj.Sums);
+            obj.Inputs(end+1:capacity) = {[]};
+            obj.Hashes(end+1:capacity) = 0;
+            obj.AttributeKeys(end+1:capacity) = {[]};
+            obj.AttributeValues(end+1:capacity) = {[]};
+            obj.Sums(end+1:end+n) = 0;
+            obj.Pending(end+1:end+n) = false;
+        end
+    end
+end
+
+function form = lookupForm(inputs)
+% attribute inputs with dictionaries replaced by their keys and values, so
+% that they can be compared with isequaln
+form = inputs;
+for i = 1:numel(form)
+    if isa(form{i}, "dictionary")
+        form{i} = {keys(form{i}), values(form{i}, "cell")};
+    end
+end
+end
+
+function x = withoutNaN(x)
+% NaN values replaced by 0, so that attribute sets that are equal under
+% isequaln have the same hash
+if iscell(x)
+    x = cellfun(@withoutNaN, x, "UniformOutput", false);
+elseif isfloat(x)
+    x(isnan(x)) = 0;
+end
+end
@@ -0,0 +1,23 @@
+function coalescingBuffers(action, buffer)
+% Internal function that keeps track of the buffers of coalescing
+% counters, so that they can be flushed before metrics are collected.
+%    COALESCINGBUFFERS("add", BUFFER) and COALESCINGBUFFERS("remove",
+%    BUFFER) register and unregister a buffer.
+%    COALESCINGBUFFERS("flush") flushes all registered buffers.
+
+% Copyright 2026 The MathWorks, Inc.
+
+persistent buffers
+if isempty(buffers)
+    buffers = opentelemetry.metrics.internal.CoalescingBuffer.empty;
+end
+switch action
+    case "add"
+        buffers(end+1) = buffer;
+    case "remove"
+        buffers(buffers == buffer) = [];
+    case "flush"
+        for i = 1:numel(buffers)
+            buffers(i).flush();
+        end
+end
@@ -0,0 +1,138 @@
+classdef CoalescingCounter < handle
+    % Coalescing counter sums increments in MATLAB and adds the sums to a
+    % counter or UpDownCounter in batches, to reduce the overhead of
+    % counters that are updated very often.
+
+    % Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        Instrument      % Counter or UpDownCounter the sums are added to
+        FlushCount      % Maximum number of add calls between flushes
+        FlushInterval   % Maximum time between flushes, as a duration
+    end
+
+    properties (Access=private)
+        Buffer          % Sums of increments not yet flushed
+        FlushTimer      % Timer that flushes the sums every FlushInterval
+    end
+
+    methods
+        function obj = CoalescingCounter(instrument, optionnames, optionvalues)
+            % Coalescing counter sums increments in MATLAB and adds the
+            % sums to a counter or UpDownCounter in batches.
+            %    CC = OPENTELEMETRY.METRICS.COALESCINGCOUNTER(C) creates a
+            %    coalescing counter that adds to counter or UpDownCounter
+            %    C. Increments are summed per attribute set, and the sums
+            %    are passed to C in a single call every 1000 calls to add,
+            %    or when 1 second has passed since the last flush.
+            %
+            %    CC = OPENTELEMETRY.METRICS.COALESCINGCOUNTER(C, PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Parameters are:
+            %       "FlushCount"    - Maximum number of calls to add
+            %                         between flushes. Default is 1000.
+            %       "FlushInterval" - Maximum time between flushes, as a
+            %                         duration. Sums are flushed by a
+            %                         timer, which only runs while MATLAB
+            %                         is idle or processes callbacks, for
+            %                         example in pause or drawnow. While
+            %                         code runs, the interval is checked
+            %                         when add is called. Default is 1
+            %                         second.
+            %
+            %    Sums are also flushed before metrics are collected by
+            %    calling forceFlush or shutdown on a meter provider, or
+            %    collect on a manual metric reader, and when the
+            %    coalescing counter is deleted. Metrics collected
+            %    periodically in the background only include increments
+            %    that have been flushed.
+            %
+            %    See also OPENTELEMETRY.METRICS.METER/CREATECOUNTER,
+            %    OPENTELEMETRY.METRICS.METER/CREATEUPDOWNCOUNTER
+            arguments
+                instrument (1,1) {mustBeA(instrument, ["opentelemetry.metrics.Counter", ...
+                    "opentelemetry.metrics.UpDownCounter"])}
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            flushcount = 1000;
+            flushinterval = seconds(1);
+            validnames = ["FlushCount", "FlushInterval"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                if strcmp(namei, "FlushCount")
+                    if ~(isnumeric(valuei) && isscalar(valuei) && valuei >= 1 && round(valuei) == valuei)
+                        error("opentelemetry:metrics:CoalescingCounter:InvalidFlushCount", ...
+                            "FlushCount must be a positive integer.");
+                    end
+                    flushcount = double(valuei);
+                else   % FlushInterval
+                    if ~(isduration(valuei) && isscalar(valuei) && valuei > 0)
+                        error("opentelemetry:metrics:CoalescingCounter:InvalidFlushInterval", ...
+                            "FlushInterval must be a positive duration scalar.");
+                    end
+                    flushinterval = valuei;
+                end
+            end
+            obj.Instrument = instrument;
+            obj.FlushCount = flushcount;
+            obj.FlushInterval = flushinterval;
+            obj.Buffer = opentelemetry.metrics.internal.CoalescingBuffer(...
+                instrument, flushcount, seconds(flushinterval));
+            opentelemetry.metrics.internal.coalescingBuffers("add", obj.Buffer);
+
+            % the timer refers to the buffer only, so that the coalescing
+            % counter can be deleted while the timer runs
+            buffer = obj.Buffer;
+            period = max(round(seconds(flushinterval), 3), 0.001);   % timer resolution
+            obj.FlushTimer = timer("ExecutionMode", "fixedSpacing", ...
+                "Period", period, "StartDelay", period, ...
+                "BusyMode", "drop", "TimerFcn", @(~,~)buffer.flush(), ...
+                "Name", "CoalescingCounterFlush");
+            start(obj.FlushTimer);
+        end
+
+        function add(obj, value, varargin)
+            % ADD Add to counter value
+            %    ADD(CC, VALUE) adds a scalar numeric value. Negative values
+            %    are ignored if the instrument is a counter.
+            %
+            %    ADD(CC, VALUE, ATTRIBUTES) also specifies attributes as a
+            %    dictionary
+            %
+            %    ADD(CC, VALUE, ATTRNAME1, ATTRVALUE1, ATTRNAME2,
+            %    ATTRVALUE2, ...) specifies attributes as trailing
+            %    name-value pairs.
+            %
+            %    Increments are recorded in the current context when they
+            %    are flushed.
+            %
+            %    See also FLUSH
+            obj.Buffer.add(value, varargin{:});
+        end
+
+        function flush(obj)
+            % FLUSH Add the sums of increments to the instrument
+            %    FLUSH(CC) adds the sum of increments of each attribute
+            %    set since the last flush to the instrument.
+            %
+            %    See also ADD
+            obj.Buffer.flush();
+        end
+
+        function delete(obj)
+            if ~isempty(obj.FlushTimer) && isvalid(obj.FlushTimer)
+                stop(obj.FlushTimer);
+                delete(obj.FlushTimer);
+            end
+            if ~isempty(obj.Buffer)
+                obj.Buffer.flush();
+                opentelemetry.metrics.internal.coalescingBuffers("remove", obj.Buffer);
+            end
+        end
+    end
+end
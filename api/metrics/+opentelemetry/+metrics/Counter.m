@@ -2,7 +2,7 @@ classdef Counter < opentelemetry.metrics.SynchronousInstrument
     % Counter is a value that accumulates over time and can only increase
     % but not decrease.
 
-    % Copyright 2023 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     methods (Access={?opentelemetry.metrics.Meter})
         function obj = Counter(proxy, name, description, unit)
@@ -24,6 +24,11 @@ classdef Counter < opentelemetry.metrics.SynchronousInstrument
             %    ADD(C, VALUE, ATTRNAME1, ATTRVALUE1, ATTRNAME2,
             %    ATTRVALUE2, ...) specifies attributes as trailing
             %    name-value pairs.
+            %
+            %    ADD(C, VALUE, CTXT, ...) records the value in context
+            %    CTXT instead of the current context. If exemplars are
+            %    enabled, the span in the context can be recorded as an
+            %    exemplar.
             obj.processValue(value, varargin{:});
         end
     end
@@ -1,7 +1,7 @@
 classdef Gauge < opentelemetry.metrics.SynchronousInstrument
     % Gauge is an instrument for recording non-aggregatable measurements.
 
-    % Copyright 2025 The MathWorks, Inc.
+    % Copyright 2025-2026 The MathWorks, Inc.
 
     methods (Access={?opentelemetry.metrics.Meter})
         function obj = Gauge(proxy, name, description, unit)
@@ -22,6 +22,11 @@ classdef Gauge < opentelemetry.metrics.SynchronousInstrument
             %    RECORD(G, VALUE, ATTRNAME1, ATTRVALUE1, ATTRNAME2,
             %    ATTRVALUE2, ...) specifies attributes as trailing
             %    name-value pairs.
+            %
+            %    RECORD(G, VALUE, CTXT, ...) records the value in context
+            %    CTXT instead of the current context. If exemplars are
+            %    enabled, the span in the context can be recorded as an
+            %    exemplar.
             obj.processValue(value, varargin{:});
         end
     end
@@ -1,7 +1,7 @@
 classdef Histogram < opentelemetry.metrics.SynchronousInstrument
     % Histogram is an instrument that aggregates values into bins
 
-    % Copyright 2023 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     methods (Access={?opentelemetry.metrics.Meter})
         function obj = Histogram(proxy, name, description, unit)
@@ -23,7 +23,34 @@ classdef Histogram < opentelemetry.metrics.SynchronousInstrument
             %    RECORD(H, VALUE, ATTRNAME1, ATTRVALUE1, ATTRNAME2,
             %    ATTRVALUE2, ...) specifies attributes as trailing
             %    name-value pairs.
+            %
+            %    RECORD(H, VALUE, CTXT, ...) records the value in context
+            %    CTXT instead of the current context. If exemplars are
+            %    enabled, the span in the context can be recorded as an
+            %    exemplar.
             obj.processValue(value, varargin{:});
         end
+
+        function recordDistribution(obj, values, varargin)
+            % RECORDDISTRIBUTION Record an array of values
+            %    RECORDDISTRIBUTION(H, VALUES) records every element of
+            %    numeric array VALUES, as if RECORD were called on each
+            %    of them. Attributes are processed once, but the SDK
+            %    still aggregates each value separately.
+            %
+            %    RECORDDISTRIBUTION(H, VALUES, ATTRIBUTES) also specifies
+            %    attributes as a dictionary. The same attributes apply to
+            %    all values.
+            %
+            %    RECORDDISTRIBUTION(H, VALUES, ATTRNAME1, ATTRVALUE1,
+            %    ATTRNAME2, ATTRVALUE2, ...) specifies attributes as
+            %    trailing name-value pairs.
+            %
+            %    RECORDDISTRIBUTION(H, VALUES, CTXT, ...) records the
+            %    values in context CTXT instead of the current context.
+            %
+            %    See also RECORD
+            obj.processDistribution(values, varargin{:});
+        end
     end
 end
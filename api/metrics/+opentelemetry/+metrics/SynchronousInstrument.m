@@ -1,7 +1,7 @@
 classdef SynchronousInstrument < handle
     % Base class inherited by all synchronous instruments
 
-    % Copyright 2023-2024 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     properties (SetAccess=immutable)
         Name        (1,1) string     % Instrument name
@@ -22,17 +22,47 @@ classdef SynchronousInstrument < handle
         end
 
         function processValue(obj, value, varargin)
-            import opentelemetry.common.processAttributes
             % input value must be a numerical real scalar
             if isnumeric(value) && isscalar(value) && isreal(value)
-                if nargin == 2
-                    obj.Proxy.processValue(value);
-                else
-                    % attributes
-                    [attrkeys, attrvalues] = processAttributes(varargin);
-                    obj.Proxy.processValue(value, attrkeys, attrvalues);
-                end
+                args = obj.processOptionalInputs(varargin);
+                obj.Proxy.processValue(value, args{:});
+            end
+        end
+
+        function processDistribution(obj, values, varargin)
+            % input values must be a numerical real array
+            if isnumeric(values) && isreal(values) && ~isempty(values)
+                args = obj.processOptionalInputs(varargin);
+                obj.Proxy.recordDistribution(double(values), args{:});
+            end
+        end
+    end
+
+    methods (Access=?opentelemetry.metrics.internal.CoalescingBuffer)
+        function processValues(obj, values, attrkeys, attrvalues)
+            % add several values in one call, each with attributes
+            % already processed by processAttributes
+            obj.Proxy.processValues(values, attrkeys, attrvalues);
+        end
+    end
+
+    methods (Static, Access=private)
+        function args = processOptionalInputs(inputs)
+            % Convert an optional context followed by attributes into
+            % proxy inputs. Without a context, the current context is used.
+            import opentelemetry.common.processAttributes
+            args = {};
+            contextid = {};
+            if ~isempty(inputs) && isa(inputs{1}, "opentelemetry.context.Context")
+                contextid = {inputs{1}.Proxy.ID};
+                inputs(1) = [];
+            end
+            if ~isempty(inputs)
+                [attrkeys, attrvalues] = processAttributes(inputs);
+                args = {attrkeys, attrvalues};
             end
+            % context ID goes last
+            args = [args contextid];
         end
     end
 end
@@ -1,7 +1,7 @@
 classdef UpDownCounter < opentelemetry.metrics.SynchronousInstrument
     % UpDownCounter is an instrument that adds or reduce values.
 
-    % Copyright 2023 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     methods (Access={?opentelemetry.metrics.Meter})
         function obj = UpDownCounter(proxy, name, description, unit)
@@ -23,6 +23,11 @@ classdef UpDownCounter < opentelemetry.metrics.SynchronousInstrument
             %    ADD(C, VALUE, ATTRNAME1, ATTRVALUE1, ATTRNAME2,
             %    ATTRVALUE2, ...) specifies attributes as trailing
             %    name-value pairs.
+            %
+            %    ADD(C, VALUE, CTXT, ...) records the value in context
+            %    CTXT instead of the current context. If exemplars are
+            %    enabled, the span in the context can be recorded as an
+            %    exemplar.
             obj.processValue(value, varargin{:});
         end
     end
@@ -0,0 +1,38 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/common/ProcessedAttributes.h"
+#include "opentelemetry-matlab/common/LimitsRegistry.h"
+#include "opentelemetry-matlab/metrics/SynchronousInstrumentProxyFactory.h"
+
+#include <memory>
+#include <string>
+
+namespace libmexclass::opentelemetry {
+
+// Rewrites attribute values of one instrument before they are passed to the SDK. The SDK
+// hashes the original values of each attribute set, so values are grouped here rather than
+// in a view's attributes processor, which would still create a series per original value.
+class AttributeRewriter {
+  public:
+    virtual ~AttributeRewriter() = default;
+
+    virtual void apply(ProcessedAttributes& attrs) = 0;
+};
+
+// Creates the attribute rewriters of the instruments of a meter provider. Rewrite rules are
+// configured on SDK views, this interface lets API instrument proxies apply them.
+class AttributeRewriterFactory {
+  public:
+    virtual ~AttributeRewriterFactory() = default;
+
+    // Returns the rewriter for an instrument, or null if no rules apply to it
+    virtual std::shared_ptr<AttributeRewriter> create(SynchronousInstrumentType type, const std::string& name,
+		    const std::string& unit, const std::string& metername, const std::string& meterversion,
+		    const std::string& meterschema) const = 0;
+};
+
+// attribute rewriter factories of meter providers
+using AttributeRewriteRegistry = LimitsRegistry<AttributeRewriterFactory>;
+} // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -10,6 +10,10 @@
 
 #include "opentelemetry-matlab/common/attribute.h"
 #include "opentelemetry-matlab/common/ProcessedAttributes.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
+
+#include <memory>
 
 namespace metrics_api = opentelemetry::metrics;
 namespace nostd = opentelemetry::nostd;
@@ -17,16 +21,26 @@ namespace nostd = opentelemetry::nostd;
 namespace libmexclass::opentelemetry {
 class CounterProxy : public libmexclass::proxy::Proxy {
   public:
-    CounterProxy(nostd::shared_ptr<metrics_api::Counter<double> > ct) : CppCounter(ct) {
+    CounterProxy(nostd::shared_ptr<metrics_api::Counter<double> > ct, std::shared_ptr<const AttributeLimits> limits = nullptr,
+	        std::shared_ptr<AttributeRewriter> rewriter = nullptr)
+	    : CppCounter(ct), Limits(std::move(limits)), Rewriter(std::move(rewriter)) {
        REGISTER_METHOD(CounterProxy, processValue);
+       REGISTER_METHOD(CounterProxy, processValues);
     }
 
     void processValue(libmexclass::proxy::method::Context& context);
 
+    // add several values, each with its own attributes, in one call
+    void processValues(libmexclass::proxy::method::Context& context);
+
   private:
 
     nostd::shared_ptr<metrics_api::Counter<double> > CppCounter;
 
+    std::shared_ptr<const AttributeLimits> Limits;   // null if the meter provider has no attribute limits
+
+    std::shared_ptr<AttributeRewriter> Rewriter;   // null if no view rewrites attributes of this instrument
+
 }; 
 } // namespace libmexclass::opentelemetry
 
@@ -1,4 +1,4 @@
-// Copyright 2025 The MathWorks, Inc.
+// Copyright 2025-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -10,6 +10,10 @@
 
 #include "opentelemetry-matlab/common/attribute.h"
 #include "opentelemetry-matlab/common/ProcessedAttributes.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
+
+#include <memory>
 
 namespace metrics_api = opentelemetry::metrics;
 namespace nostd = opentelemetry::nostd;
@@ -17,7 +21,9 @@ namespace nostd = opentelemetry::nostd;
 namespace libmexclass::opentelemetry {
 class GaugeProxy : public libmexclass::proxy::Proxy {
   public:
-    GaugeProxy(nostd::shared_ptr<metrics_api::Gauge<double> > g) : CppGauge(g) {
+    GaugeProxy(nostd::shared_ptr<metrics_api::Gauge<double> > g, std::shared_ptr<const AttributeLimits> limits = nullptr,
+	        std::shared_ptr<AttributeRewriter> rewriter = nullptr)
+	    : CppGauge(g), Limits(std::move(limits)), Rewriter(std::move(rewriter)) {
        REGISTER_METHOD(GaugeProxy, processValue);
     }
 
@@ -27,6 +33,10 @@ class GaugeProxy : public libmexclass::proxy::Proxy {
 
     nostd::shared_ptr<metrics_api::Gauge<double> > CppGauge;
 
+    std::shared_ptr<const AttributeLimits> Limits;   // null if the meter provider has no attribute limits
+
+    std::shared_ptr<AttributeRewriter> Rewriter;   // null if no view rewrites attributes of this instrument
+
 }; 
 } // namespace libmexclass::opentelemetry
 
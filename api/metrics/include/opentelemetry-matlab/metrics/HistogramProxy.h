@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -11,6 +11,10 @@
 
 #include "opentelemetry-matlab/common/attribute.h"
 #include "opentelemetry-matlab/common/ProcessedAttributes.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
+
+#include <memory>
 #include "opentelemetry-matlab/context/ContextProxy.h"
 
 namespace metrics_api = opentelemetry::metrics;
@@ -20,16 +24,27 @@ namespace nostd = opentelemetry::nostd;
 namespace libmexclass::opentelemetry {
 class HistogramProxy : public libmexclass::proxy::Proxy {
   public:
-    HistogramProxy(nostd::shared_ptr<metrics_api::Histogram<double> > hist) : CppHistogram(hist) {
+    HistogramProxy(nostd::shared_ptr<metrics_api::Histogram<double> > hist, std::shared_ptr<const AttributeLimits> limits = nullptr,
+	        std::shared_ptr<AttributeRewriter> rewriter = nullptr)
+	    : CppHistogram(hist), Limits(std::move(limits)), Rewriter(std::move(rewriter)) {
        REGISTER_METHOD(HistogramProxy, processValue);
+       REGISTER_METHOD(HistogramProxy, recordDistribution);
     }
 
     void processValue(libmexclass::proxy::method::Context& context);
 
+    // record all values of an array with the same attributes. The SDK does not accept
+    // pre-aggregated histograms, so each value is still recorded separately.
+    void recordDistribution(libmexclass::proxy::method::Context& context);
+
   private:
 
     nostd::shared_ptr<metrics_api::Histogram<double> > CppHistogram;
 
+    std::shared_ptr<const AttributeLimits> Limits;   // null if the meter provider has no attribute limits
+
+    std::shared_ptr<AttributeRewriter> Rewriter;   // null if no view rewrites attributes of this instrument
+
 }; 
 } // namespace libmexclass::opentelemetry
 
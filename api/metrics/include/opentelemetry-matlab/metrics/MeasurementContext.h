@@ -0,0 +1,35 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "libmexclass/proxy/ProxyManager.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry-matlab/context/ContextProxy.h"
+
+#include "opentelemetry/context/context.h"
+#include "opentelemetry/context/runtime_context.h"
+
+#include "MatlabDataArray.hpp"
+
+namespace context_api = opentelemetry::context;
+
+namespace libmexclass::opentelemetry {
+
+// Context of a measurement, used by the SDK to link exemplars to the active span. A context
+// proxy ID may be passed as the last input, otherwise the current context is used. nin is
+// reduced by one if a context input is present.
+inline context_api::Context measurementContext(libmexclass::proxy::method::Context& context, size_t& nin) {
+    if (nin > 1) {
+        matlab::data::Array last_mda = context.inputs[nin-1];
+        if (last_mda.getType() == matlab::data::ArrayType::UINT64) {
+            matlab::data::TypedArray<uint64_t> contextid_mda = last_mda;
+            libmexclass::proxy::ID contextid = contextid_mda[0];
+            --nin;
+            return std::static_pointer_cast<ContextProxy>(
+                libmexclass::proxy::ProxyManager::getProxy(contextid))->getInstance();
+        }
+    }
+    return context_api::RuntimeContext::GetCurrent();
+}
+} // namespace libmexclass::opentelemetry
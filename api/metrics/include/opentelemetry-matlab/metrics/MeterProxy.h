@@ -1,4 +1,4 @@
-// Copyright 2023-2025 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -14,6 +14,8 @@
 #include "opentelemetry-matlab/metrics/ObservableGaugeProxy.h"
 #include "opentelemetry-matlab/metrics/SynchronousInstrumentProxyFactory.h"
 #include "opentelemetry-matlab/metrics/AsynchronousInstrumentProxyFactory.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
 
 #include "opentelemetry/metrics/meter.h"
 
@@ -23,8 +25,12 @@ namespace nostd = opentelemetry::nostd;
 namespace libmexclass::opentelemetry {
 class MeterProxy : public libmexclass::proxy::Proxy {
   public:
-    MeterProxy(nostd::shared_ptr<metrics_api::Meter> mt, const std::shared_ptr<matlab::engine::MATLABEngine> eng) 
-            : CppMeter(mt), MexEngine(eng) {
+    MeterProxy(nostd::shared_ptr<metrics_api::Meter> mt, const std::shared_ptr<matlab::engine::MATLABEngine> eng,
+		    std::shared_ptr<const AttributeLimits> limits = nullptr,
+		    std::shared_ptr<const AttributeRewriterFactory> rewrites = nullptr, const std::string& name = "",
+		    const std::string& version = "", const std::string& schema = "") 
+            : CppMeter(mt), MexEngine(eng), Limits(std::move(limits)), Rewrites(std::move(rewrites)),
+	      Name(name), Version(version), Schema(schema) {
         REGISTER_METHOD(MeterProxy, createCounter);
         REGISTER_METHOD(MeterProxy, createUpDownCounter);
         REGISTER_METHOD(MeterProxy, createHistogram);
@@ -56,5 +62,14 @@ class MeterProxy : public libmexclass::proxy::Proxy {
     nostd::shared_ptr<metrics_api::Meter> CppMeter;
 
     const std::shared_ptr<matlab::engine::MATLABEngine> MexEngine;  // mex engine pointer used by asynchronous instruments for feval
+
+    std::shared_ptr<const AttributeLimits> Limits;   // attribute limits of synchronous instruments, null if none
+
+    std::shared_ptr<const AttributeRewriterFactory> Rewrites;   // attribute rewrite rules of views, null if none
+
+    // meter name, version, and schema URL, used to select attribute rewrite rules
+    std::string Name;
+    std::string Version;
+    std::string Schema;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,7 +1,9 @@
-// Copyright 2023-2025 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+
 #include "libmexclass/proxy/Proxy.h"
 
 #include "opentelemetry/metrics/meter.h"
@@ -13,15 +15,21 @@ namespace libmexclass::opentelemetry {
 
 enum class SynchronousInstrumentType {Counter, UpDownCounter, Histogram, Gauge};
 
+class AttributeRewriter;
+
 class SynchronousInstrumentProxyFactory {
   public:
-    SynchronousInstrumentProxyFactory(nostd::shared_ptr<metrics_api::Meter> mt) : CppMeter(mt) {}
+    SynchronousInstrumentProxyFactory(nostd::shared_ptr<metrics_api::Meter> mt, 
+		    std::shared_ptr<const AttributeLimits> limits = nullptr) : CppMeter(mt), Limits(std::move(limits)) {}
 
     std::shared_ptr<libmexclass::proxy::Proxy> create(SynchronousInstrumentType type, 
-		    const std::string& name, const std::string& description, const std::string& unit);
+		    const std::string& name, const std::string& description, const std::string& unit,
+		    std::shared_ptr<AttributeRewriter> rewriter = nullptr);
 
   private:
 
     nostd::shared_ptr<metrics_api::Meter> CppMeter;
+
+    std::shared_ptr<const AttributeLimits> Limits;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2025 The MathWorks, Inc.
+// Copyright 2025-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/metrics/GaugeProxy.h"
 
@@ -12,8 +12,9 @@ void GaugeProxy::processValue(libmexclass::proxy::method::Context& context){
     matlab::data::Array value_mda = context.inputs[0];
     double value = static_cast<double>(value_mda[0]);
     size_t nin = context.inputs.getNumberOfElements();
+    auto ctxt = measurementContext(context, nin);
     if (nin == 1){
-        CppGauge->Record(value);
+        CppGauge->Record(value, ctxt);
     } 
     // add attributes
     else { 
@@ -21,12 +22,16 @@ void GaugeProxy::processValue(libmexclass::proxy::method::Context& context){
         matlab::data::StringArray attrnames_mda = context.inputs[1];
         matlab::data::Array attrvalues_mda = context.inputs[2];
         size_t nattrs = attrnames_mda.getNumberOfElements();
+        AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
         for (size_t i = 0; i < nattrs; i ++){
             std::string attrname = static_cast<std::string>(attrnames_mda[i]);
             matlab::data::Array attrvalue = attrvalues_mda[i];
-            processAttribute(attrname, attrvalue, attrs);
+            processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
         }
-        CppGauge->Record(value, attrs.Attributes);
+        if (Rewriter) {
+            Rewriter->apply(attrs);
+        }
+        CppGauge->Record(value, attrs.Attributes, ctxt);
     }
     
 }
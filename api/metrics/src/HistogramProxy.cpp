@@ -1,9 +1,12 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/metrics/HistogramProxy.h"
 
+#include "opentelemetry-matlab/metrics/MeasurementContext.h"
+
 #include "libmexclass/proxy/ProxyManager.h"
 
+#include "opentelemetry/common/key_value_iterable_view.h"
 
 #include "MatlabDataArray.hpp"
 
@@ -16,10 +19,9 @@ void HistogramProxy::processValue(libmexclass::proxy::method::Context& context){
     // Get value
     matlab::data::Array value_mda = context.inputs[0];
     double value = static_cast<double>(value_mda[0]);
-    // Create empty context
-    auto ctxt = context_api::Context();
     // If no attributes input, record value and context
     size_t nin = context.inputs.getNumberOfElements();
+    auto ctxt = measurementContext(context, nin);
     if (nin == 1){
         CppHistogram->Record(value, ctxt);
     } 
@@ -29,16 +31,49 @@ void HistogramProxy::processValue(libmexclass::proxy::method::Context& context){
         matlab::data::StringArray attrnames_mda = context.inputs[1];
         matlab::data::Array attrvalues_mda = context.inputs[2];
         size_t nattrs = attrnames_mda.getNumberOfElements();
+        AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
         for (size_t i = 0; i < nattrs; i ++){
             std::string attrname = static_cast<std::string>(attrnames_mda[i]);
             matlab::data::Array attrvalue = attrvalues_mda[i];
-            processAttribute(attrname, attrvalue, attrs);
+            processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
+        }
+        if (Rewriter) {
+            Rewriter->apply(attrs);
         }
         CppHistogram->Record(value, attrs.Attributes, ctxt);
     }
     
 }
 
+void HistogramProxy::recordDistribution(libmexclass::proxy::method::Context& context){
+    const matlab::data::TypedArray<double> values_mda = context.inputs[0];
+    size_t nin = context.inputs.getNumberOfElements();
+    auto ctxt = measurementContext(context, nin);
+
+    // process attributes once for the whole array
+    ProcessedAttributes attrs;
+    if (nin > 1) {
+        matlab::data::StringArray attrnames_mda = context.inputs[1];
+        matlab::data::Array attrvalues_mda = context.inputs[2];
+        size_t nattrs = attrnames_mda.getNumberOfElements();
+        AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
+        for (size_t i = 0; i < nattrs; i ++){
+            std::string attrname = static_cast<std::string>(attrnames_mda[i]);
+            matlab::data::Array attrvalue = attrvalues_mda[i];
+            processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
+        }
+        if (Rewriter) {
+            Rewriter->apply(attrs);
+        }
+    }
+    common::KeyValueIterableView<std::list<std::pair<std::string, common::AttributeValue> > > attrview(attrs.Attributes);
+
+    // const iteration reads the values in place, without copying the array
+    for (double value : values_mda) {
+        CppHistogram->Record(value, attrview, ctxt);
+    }
+}
+
 
 
 } // namespace libmexclass::opentelemetry
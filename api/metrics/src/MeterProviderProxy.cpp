@@ -1,7 +1,9 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/metrics/MeterProviderProxy.h"
 #include "opentelemetry-matlab/metrics/MeterProxy.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/metrics/provider.h"
@@ -24,7 +26,10 @@ void MeterProviderProxy::getMeter(libmexclass::proxy::method::Context& context)
    if (MexEngine == nullptr) {
       MexEngine = context.matlab; 
    }
-   MeterProxy* newproxy = new MeterProxy(mt, MexEngine);
+   // attribute limits and rewrite rules are set on SDK meter providers, look them up here so that they also apply
+   // to the global instance
+   MeterProxy* newproxy = new MeterProxy(mt, MexEngine, AttributeLimitsRegistry::get(CppMeterProvider.get()),
+		   AttributeRewriteRegistry::get(CppMeterProvider.get()), name, version, schema);
    auto mtproxy = std::shared_ptr<libmexclass::proxy::Proxy>(newproxy);
 
    // obtain a proxy ID
@@ -1,4 +1,4 @@
-// Copyright 2023-2025 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/metrics/MeterProxy.h"
 #include "opentelemetry-matlab/metrics/MeasurementFetcher.h"
@@ -20,8 +20,9 @@ void MeterProxy::createSynchronous(libmexclass::proxy::method::Context& context,
    matlab::data::StringArray unit_mda = context.inputs[2];
    std::string unit = static_cast<std::string>(unit_mda[0]); 
 	
-   SynchronousInstrumentProxyFactory proxyfactory(CppMeter);
-   auto proxy = proxyfactory.create(type, name, description, unit);
+   SynchronousInstrumentProxyFactory proxyfactory(CppMeter, Limits);
+   auto rewriter = Rewrites ? Rewrites->create(type, name, unit, Name, Version, Schema) : nullptr;
+   auto proxy = proxyfactory.create(type, name, description, unit, rewriter);
     
    // obtain a proxy ID
    libmexclass::proxy::ID proxyid = libmexclass::proxy::ProxyManager::manageProxy(proxy);
@@ -1,7 +1,9 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/metrics/UpDownCounterProxy.h"
 
+#include "opentelemetry-matlab/metrics/MeasurementContext.h"
+
 #include "libmexclass/proxy/ProxyManager.h"
 
 
@@ -17,8 +19,9 @@ void UpDownCounterProxy::processValue(libmexclass::proxy::method::Context& conte
     matlab::data::Array value_mda = context.inputs[0];
     double value = static_cast<double>(value_mda[0]);
     size_t nin = context.inputs.getNumberOfElements();
+    auto ctxt = measurementContext(context, nin);
     if (nin == 1){
-        CppUpDownCounter->Add(value);
+        CppUpDownCounter->Add(value, ctxt);
     } 
     // add attributes
     else { 
@@ -26,16 +29,45 @@ void UpDownCounterProxy::processValue(libmexclass::proxy::method::Context& conte
         matlab::data::StringArray attrnames_mda = context.inputs[1];
         matlab::data::Array attrvalues_mda = context.inputs[2];
         size_t nattrs = attrnames_mda.getNumberOfElements();
+        AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
         for (size_t i = 0; i < nattrs; i ++){
             std::string attrname = static_cast<std::string>(attrnames_mda[i]);
             matlab::data::Array attrvalue = attrvalues_mda[i];
-            processAttribute(attrname, attrvalue, attrs);
+            processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
+        }
+        if (Rewriter) {
+            Rewriter->apply(attrs);
         }
-        CppUpDownCounter->Add(value, attrs.Attributes);
+        CppUpDownCounter->Add(value, attrs.Attributes, ctxt);
     }
     
 }
 
+void UpDownCounterProxy::processValues(libmexclass::proxy::method::Context& context){
+    const matlab::data::TypedArray<double> values_mda = context.inputs[0];
+    matlab::data::CellArray attrnames_mda = context.inputs[1];
+    matlab::data::CellArray attrvalues_mda = context.inputs[2];
+    size_t nin = context.inputs.getNumberOfElements();
+    auto ctxt = measurementContext(context, nin);
+    size_t nvalues = values_mda.getNumberOfElements();
+    AttributeLimits limits = Limits ? *Limits : AttributeLimits{};
+    for (size_t v = 0; v < nvalues; v ++){
+        ProcessedAttributes attrs;
+        matlab::data::StringArray names_mda = attrnames_mda[v];
+        matlab::data::Array attrvalues_v = attrvalues_mda[v];
+        size_t nattrs = names_mda.getNumberOfElements();
+        for (size_t i = 0; i < nattrs; i ++){
+            std::string attrname = static_cast<std::string>(names_mda[i]);
+            matlab::data::Array attrvalue = attrvalues_v[i];
+            processAttribute(attrname, attrvalue, attrs, Limits ? &limits : nullptr);
+        }
+        if (Rewriter) {
+            Rewriter->apply(attrs);
+        }
+        CppUpDownCounter->Add(values_mda[v], attrs.Attributes, ctxt);
+    }
+}
+
 
 
 } // namespace libmexclass::opentelemetry
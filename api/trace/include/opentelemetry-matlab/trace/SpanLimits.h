@@ -0,0 +1,32 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/common/AttributeLimits.h"
+#include "opentelemetry-matlab/common/LimitsRegistry.h"
+
+#include <cstddef>
+
+namespace libmexclass::opentelemetry {
+
+// Limits on the contents of a span, enforced while MATLAB inputs are converted
+struct SpanLimits {
+    size_t MaxAttributes = AttributeLimits::Unlimited;            // per span, and per event or link
+    size_t MaxEvents = AttributeLimits::Unlimited;
+    size_t MaxLinks = AttributeLimits::Unlimited;
+    size_t MaxAttributeValueLength = AttributeLimits::Unlimited;
+    size_t MaxBytes = AttributeLimits::Unlimited;                 // estimated size of names, attributes, events, and links
+    size_t ArraySummaryThreshold = AttributeLimits::Unlimited;    // numeric arrays with more elements are summarized
+
+    // attribute limits with the full byte budget of a new span
+    AttributeLimits attributeLimits() const {
+        AttributeLimits limits;
+        limits.MaxValueLength = MaxAttributeValueLength;
+        limits.MaxBytes = MaxBytes;
+        limits.ArraySummaryThreshold = ArraySummaryThreshold;
+        return limits;
+    }
+};
+
+using SpanLimitsRegistry = LimitsRegistry<SpanLimits>;
+} // namespace libmexclass::opentelemetry
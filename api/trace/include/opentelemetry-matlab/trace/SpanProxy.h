@@ -1,19 +1,29 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
+#include "opentelemetry-matlab/trace/SpanLimits.h"
+#include "opentelemetry-matlab/common/attribute.h"
+
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/method/Context.h"
 
 #include "opentelemetry/trace/span.h"
 
+#include <memory>
+#include <string>
+
 namespace trace_api = opentelemetry::trace;
 namespace nostd = opentelemetry::nostd;
 
 namespace libmexclass::opentelemetry {
 class SpanProxy : public libmexclass::proxy::Proxy {
   public:
-    SpanProxy(nostd::shared_ptr<trace_api::Span> span) : CppSpan(span) {
+    // limits, budget, and charges carry the span limits of the tracer provider, the remaining
+    // byte budget, and the attributes already set when the span was started
+    SpanProxy(nostd::shared_ptr<trace_api::Span> span, std::shared_ptr<const SpanLimits> limits = nullptr,
+		    AttributeLimits budget = AttributeLimits{}, AttributeCharges charges = {})
+	    : CppSpan(span), Limits(std::move(limits)), Budget(budget), Charges(std::move(charges)) {
         REGISTER_METHOD(SpanProxy, endSpan);
         REGISTER_METHOD(SpanProxy, makeCurrent);
         REGISTER_METHOD(SpanProxy, setAttribute);
@@ -48,5 +58,10 @@ class SpanProxy : public libmexclass::proxy::Proxy {
   private:
 
     nostd::shared_ptr<trace_api::Span> CppSpan;
+
+    std::shared_ptr<const SpanLimits> Limits;   // null if unlimited
+    AttributeLimits Budget;
+    AttributeCharges Charges;   // bytes charged for each attribute of the span
+    size_t NumEvents = 0;
 };
 } // namespace libmexclass::opentelemetry
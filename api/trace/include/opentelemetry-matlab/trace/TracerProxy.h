@@ -1,19 +1,25 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
+#include "opentelemetry-matlab/trace/SpanLimits.h"
+
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/method/Context.h"
 
 #include "opentelemetry/trace/tracer.h"
 
+#include <memory>
+
 namespace trace_api = opentelemetry::trace;
 namespace nostd = opentelemetry::nostd;
 
 namespace libmexclass::opentelemetry {
 class TracerProxy : public libmexclass::proxy::Proxy {
   public:
-    TracerProxy(nostd::shared_ptr<trace_api::Tracer> tr) : CppTracer(tr) {
+    // limits is null if the tracer provider has no span limits
+    TracerProxy(nostd::shared_ptr<trace_api::Tracer> tr, std::shared_ptr<const SpanLimits> limits = nullptr)
+	    : CppTracer(tr), Limits(std::move(limits)) {
         REGISTER_METHOD(TracerProxy, startSpanWithNameOnly);
         REGISTER_METHOD(TracerProxy, startSpanWithNameAndOptions);
         REGISTER_METHOD(TracerProxy, startSpanWithNameAndAttributes);
@@ -31,5 +37,7 @@ class TracerProxy : public libmexclass::proxy::Proxy {
   private:
 
     nostd::shared_ptr<trace_api::Tracer> CppTracer;
+
+    std::shared_ptr<const SpanLimits> Limits;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/trace/SpanProxy.h"
 #include "opentelemetry-matlab/trace/ScopeProxy.h"
@@ -74,7 +74,12 @@ void SpanProxy::setAttribute(libmexclass::proxy::method::Context& context) {
     matlab::data::Array attrvalue = context.inputs[1];
 
     ProcessedAttributes attrs;
-    processAttribute(attrname, attrvalue, attrs); 
+    if (Limits) {
+       // updating an existing attribute is always allowed, new attributes are dropped at the limit
+       processAttribute(attrname, attrvalue, attrs, Budget, Charges, Limits->MaxAttributes);
+    } else {
+       processAttribute(attrname, attrvalue, attrs); 
+    }
 						      
     for (auto itr = attrs.Attributes.cbegin(); itr!=attrs.Attributes.cend(); ++itr) {
        CppSpan->SetAttribute(itr->first, itr->second); 
@@ -88,14 +93,25 @@ void SpanProxy::addEvent(libmexclass::proxy::method::Context& context) {
     matlab::data::TypedArray<double> eventtime_mda = context.inputs[1];
     common::SystemTimestamp eventtime{std::chrono::duration<double>{eventtime_mda[0]}};
     const size_t nin = context.inputs.getNumberOfElements();
+    if (Limits) {
+       if (NumEvents >= Limits->MaxEvents || !Budget.reserve(eventname.size() + sizeof(double))) {
+          return;
+       }
+       ++NumEvents;
+    }
     // attributes
     ProcessedAttributes eventattrs;
-    for (size_t i = 2, count = 0; i < nin; i += 2, ++count) {
+    for (size_t i = 2, count = 0; i < nin; i += 2) {
+       if (Limits && count >= Limits->MaxAttributes) {
+          break;
+       }
        matlab::data::StringArray attrname_mda = context.inputs[i];
        std::string attrname = static_cast<std::string>(attrname_mda[0]);
        matlab::data::Array attrvalue = context.inputs[i+1];
 
-       processAttribute(attrname, attrvalue, eventattrs);
+       if (processAttribute(attrname, attrvalue, eventattrs, Limits ? &Budget : nullptr)) {
+          ++count;
+       }
     }
     if (nin < 3) {
        CppSpan->AddEvent(eventname, eventtime);
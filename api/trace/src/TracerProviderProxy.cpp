@@ -1,7 +1,8 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/trace/TracerProviderProxy.h"
 #include "opentelemetry-matlab/trace/TracerProxy.h"
+#include "opentelemetry-matlab/trace/SpanLimits.h"
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/trace/provider.h"
@@ -20,7 +21,8 @@ void TracerProviderProxy::getTracer(libmexclass::proxy::method::Context& context
    auto tr = CppTracerProvider->GetTracer(name, version, schema);
 
    // instantiate a TracerProxy instance
-   TracerProxy* newproxy = new TracerProxy(tr);
+   // span limits are set on SDK tracer providers, look them up here so that they also apply to the global instance
+   TracerProxy* newproxy = new TracerProxy(tr, SpanLimitsRegistry::get(CppTracerProvider.get()));
    auto trproxy = std::shared_ptr<libmexclass::proxy::Proxy>(newproxy);
     
    // obtain a proxy ID
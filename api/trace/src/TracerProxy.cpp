@@ -1,4 +1,4 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/trace/TracerProxy.h"
 #include "opentelemetry-matlab/trace/SpanProxy.h"
@@ -14,10 +14,22 @@
 namespace libmexclass::opentelemetry {
 const libmexclass::proxy::ID NOPARENTID(-1);   // wrap around to intmax
 						   
+// Helper function to return the byte budget of a new span, after its name
+AttributeLimits initialBudget(const SpanLimits* limits, const std::string& name) {
+    AttributeLimits budget;
+    if (limits != nullptr) {
+       budget = limits->attributeLimits();
+       budget.reserve(name.size());
+    }
+    return budget;
+}
+
 // Helper function to create a span proxy from a otel-cpp Span object
 matlab::data::TypedArray<libmexclass::proxy::ID> createSpanProxy(
-		nostd::shared_ptr<trace_api::Span> sp) {
-   auto spproxy = std::shared_ptr<libmexclass::proxy::Proxy>(new SpanProxy(sp));
+		nostd::shared_ptr<trace_api::Span> sp, std::shared_ptr<const SpanLimits> limits = nullptr,
+		AttributeLimits budget = AttributeLimits{}, AttributeCharges charges = {}) {
+   auto spproxy = std::shared_ptr<libmexclass::proxy::Proxy>(new SpanProxy(sp, std::move(limits), budget,
+			   std::move(charges)));
     
     // obtain a proxy ID
     libmexclass::proxy::ID proxyid = libmexclass::proxy::ProxyManager::manageProxy(spproxy);
@@ -33,7 +45,7 @@ void TracerProxy::startSpanWithNameOnly(libmexclass::proxy::method::Context& con
     matlab::data::StringArray name_mda = context.inputs[0];
     std::string name = static_cast<std::string>(name_mda[0]);
     auto sp = CppTracer->StartSpan(name);
-    context.outputs[0] = createSpanProxy(sp);
+    context.outputs[0] = createSpanProxy(sp, Limits, initialBudget(Limits.get(), name));
 }
 
 // Helper function to process parent ID, span kind, and start time inputs, and return an options object
@@ -88,28 +100,39 @@ void TracerProxy::startSpanWithNameAndOptions(libmexclass::proxy::method::Contex
 
     auto sp = CppTracer->StartSpan(name, options);
 
-    context.outputs[0] = createSpanProxy(sp);
+    context.outputs[0] = createSpanProxy(sp, Limits, initialBudget(Limits.get(), name));
 }
 
-// Helper function to process attributes
+// Helper function to process attributes. If limits is not null, attributes beyond the attribute
+// count limit or the byte budget are dropped, and the sizes of accepted attributes are added to charges.
 void processAttributes(const matlab::data::StringArray& attrnames_mda, 
 		const matlab::data::CellArray& attrvalues_mda, 
-		ProcessedAttributes& attrs) {
+		ProcessedAttributes& attrs, const SpanLimits* limits = nullptr,
+		AttributeLimits* budget = nullptr, AttributeCharges* charges = nullptr) {
     const size_t nattrs = attrnames_mda.getNumberOfElements();
     for (size_t i = 0; i < nattrs; ++i) {
        std::string attrname = static_cast<std::string>(attrnames_mda[i]);
        matlab::data::Array attrvalue = attrvalues_mda[i];
 
-       processAttribute(attrname, attrvalue, attrs);
+       if (limits != nullptr) {
+          processAttribute(attrname, attrvalue, attrs, *budget, *charges, limits->MaxAttributes);
+       } else {
+          processAttribute(attrname, attrvalue, attrs);
+       }
     }
 }
 
 // Helper function to process links
 std::list<std::pair<trace_api::SpanContext, std::list<std::pair<std::string, common::AttributeValue> > > > processLinks(
-		const matlab::data::Array& contextinputs, size_t linkstartindex, ProcessedAttributes& linkattrs) {
+		const matlab::data::Array& contextinputs, size_t linkstartindex, ProcessedAttributes& linkattrs,
+		const SpanLimits* limits = nullptr, AttributeLimits* budget = nullptr) {
     const size_t ninputs = contextinputs.getNumberOfElements();
     std::list<std::pair<trace_api::SpanContext, std::list<std::pair<std::string, common::AttributeValue> > > > links;
     for (size_t i = linkstartindex; i < ninputs; i+=3) {
+       if (limits != nullptr && (links.size() >= limits->MaxLinks || 
+			       !budget->reserve(trace_api::TraceId::kSize + trace_api::SpanId::kSize))) {
+          break;
+       }
        // link target
        matlab::data::TypedArray<uint64_t> linktargetid_mda = contextinputs[i];
        libmexclass::proxy::ID linktargetid = linktargetid_mda[0];
@@ -120,11 +143,16 @@ std::list<std::pair<trace_api::SpanContext, std::list<std::pair<std::string, com
        matlab::data::StringArray linkattrnames_mda = contextinputs[i+1];
        const size_t nlinkattrs = linkattrnames_mda.getNumberOfElements();
        matlab::data::Array linkattrvalues_mda = contextinputs[i+2];
-       for (size_t ii = 0; ii < nlinkattrs; ++ii) {
+       for (size_t ii = 0, count = 0; ii < nlinkattrs; ++ii) {
+          if (limits != nullptr && count >= limits->MaxAttributes) {
+             break;
+          }
           std::string linkattrname = static_cast<std::string>(linkattrnames_mda[ii]);
           matlab::data::Array linkattrvalue = linkattrvalues_mda[ii];
   
-          processAttribute(linkattrname, linkattrvalue, linkattrs);
+          if (processAttribute(linkattrname, linkattrvalue, linkattrs, limits != nullptr ? budget : nullptr)) {
+             ++count;
+          }
        }
        links.push_back(std::pair(linktarget->getInstance(), linkattrs.Attributes));
     }
@@ -144,16 +172,18 @@ void TracerProxy::startSpanWithNameAndAttributes(libmexclass::proxy::method::Con
     matlab::data::CellArray attrvalues_mda = context.inputs[2];
 
     // attributes
+    AttributeLimits budget = initialBudget(Limits.get(), name);
+    AttributeCharges charges;
     ProcessedAttributes attrs;
-    processAttributes(attrnames_mda, attrvalues_mda, attrs);
+    processAttributes(attrnames_mda, attrvalues_mda, attrs, Limits.get(), &budget, &charges);
 
     // links
     ProcessedAttributes linkattrs;
-    auto links = processLinks(context.inputs, nfixedinputs, linkattrs);
+    auto links = processLinks(context.inputs, nfixedinputs, linkattrs, Limits.get(), &budget);
 
     auto sp = CppTracer->StartSpan(name, attrs.Attributes, links);
 
-    context.outputs[0] = createSpanProxy(sp);
+    context.outputs[0] = createSpanProxy(sp, Limits, budget, std::move(charges));
 }
 
 // startSpan implementation with span name, attributes, links, and an options object
@@ -177,15 +207,17 @@ void TracerProxy::startSpanWithNameOptionsAttributes(libmexclass::proxy::method:
     trace_api::StartSpanOptions options = processOptions(parentid, kindstr, starttime);
 
     // attributes
+    AttributeLimits budget = initialBudget(Limits.get(), name);
+    AttributeCharges charges;
     ProcessedAttributes attrs;
-    processAttributes(attrnames_mda, attrvalues_mda, attrs);
+    processAttributes(attrnames_mda, attrvalues_mda, attrs, Limits.get(), &budget, &charges);
 
     // links
     ProcessedAttributes linkattrs;
-    auto links = processLinks(context.inputs, nfixedinputs, linkattrs);
+    auto links = processLinks(context.inputs, nfixedinputs, linkattrs, Limits.get(), &budget);
 
     auto sp = CppTracer->StartSpan(name, attrs.Attributes, links, options);
 
-    context.outputs[0] = createSpanProxy(sp);
+    context.outputs[0] = createSpanProxy(sp, Limits, budget, std::move(charges));
 }
 } // namespace libmexclass::opentelemetry
@@ -2,7 +2,7 @@ classdef OtlpFileMetricExporter < opentelemetry.sdk.metrics.MetricExporter
 % OtlpFileMetricExporter exports metrics in OpenTelemetry Protocol format to
 % one or more files. 
 
-% Copyright 2024 The MathWorks, Inc.
+% Copyright 2024-2026 The MathWorks, Inc.
 
     properties
         FileName (1,1) string = "metrics-%N.jsonl"       % Output file name
@@ -11,6 +11,7 @@ classdef OtlpFileMetricExporter < opentelemetry.sdk.metrics.MetricExporter
         FlushRecordCount (1,1) double = 256            % Maximum number of records before exporting
         MaxFileSize (1,1) double = 20971520            % Maximum output file size
         MaxFileCount (1,1) double = 10                 % Maximum number of output files, written to in rotation.
+        Format (1,1) string = "JSON"                   % Output file format, "JSON" or "binary"
     end
 
     properties (Access=private, Constant)
@@ -47,6 +48,15 @@ classdef OtlpFileMetricExporter < opentelemetry.sdk.metrics.MetricExporter
             %       "MaxFileCount"      - Maximum number of output files, 
             %                             written to in rotation. Default
             %                             is 10.
+            %       "Format"            - Output file format, "JSON" for
+            %                             one JSON object per line, or
+            %                             "binary" for length-delimited
+            %                             protobuf records. Binary files
+            %                             should be given a different
+            %                             extension, such as
+            %                             "metrics-%N.binpb", and can be read
+            %                             using readOtlpBinaryFile. Default
+            %                             is "JSON".
             %
             %    Supported pattern placeholders in FileName and AliasName are:
             %       %Y:  year as a 4 digit decimal number
@@ -77,7 +87,7 @@ classdef OtlpFileMetricExporter < opentelemetry.sdk.metrics.MetricExporter
                 "libmexclass.opentelemetry.exporters.OtlpFileMetricExporterProxy");
 
             validnames = ["FileName", "AliasName", "FlushInterval", ...
-                "FlushRecordCount", "MaxFileSize", "MaxFileCount"];
+                "FlushRecordCount", "MaxFileSize", "MaxFileCount", "Format"];
             for i = 1:length(optionnames)
                 namei = validatestring(optionnames{i}, validnames);
                 valuei = optionvalues{i};
@@ -120,5 +130,11 @@ classdef OtlpFileMetricExporter < opentelemetry.sdk.metrics.MetricExporter
             obj.Proxy.setMaxFileCount(maxfilecount);
             obj.MaxFileCount = maxfilecount;
         end
+
+        function obj = set.Format(obj, newformat)
+            newformat = obj.Validator.validateFormat(newformat);
+            obj.Proxy.setFormat(newformat);
+            obj.Format = newformat;
+        end
     end
 end
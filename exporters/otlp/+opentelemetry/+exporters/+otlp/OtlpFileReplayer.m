@@ -0,0 +1,110 @@
+classdef OtlpFileReplayer < handle
+% OtlpFileReplayer sends files written by the OTLP file exporters to a
+% backend, through an OTLP HTTP or gRPC exporter.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        Exporter        % Span, metric, or log record exporter used to send the data
+        Signal          % "traces", "metrics", or "logs", depending on Exporter
+    end
+
+    properties
+        Workers (1,1) double = 4               % Number of requests sent in parallel
+        MaxBatchSize (1,1) double = 4194304    % Approximate size in bytes of each request sent
+    end
+
+    properties (Access=private)
+        Proxy   % Proxy object to interface C++ code
+    end
+
+    properties (Access=private, Constant)
+        Validator = opentelemetry.exporters.otlp.OtlpFileValidator
+    end
+
+    methods
+        function obj = OtlpFileReplayer(exporter, optionnames, optionvalues)
+            % OtlpFileReplayer sends files written by the OTLP file
+            % exporters to a backend.
+            %    R = OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILEREPLAYER(EXP)
+            %    creates a replayer that sends data through exporter EXP,
+            %    which can be a span, metric, or log record exporter. EXP
+            %    also determines which kind of files can be replayed.
+            %
+            %    R = OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILEREPLAYER(EXP,
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "Workers"           - Number of requests sent in
+            %                             parallel, each through its own
+            %                             copy of EXP. Default is 4.
+            %       "MaxBatchSize"      - Data read from the files is
+            %                             merged into requests of
+            %                             approximately this size in
+            %                             bytes. Default is 4 MB.
+            %
+            %    See also OPENTELEMETRY.EXPORTERS.OTLP.REPLAYOTLPFILES,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILESPANEXPORTER
+            arguments
+                exporter (1,1)
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            if isa(exporter, "opentelemetry.sdk.trace.SpanExporter")
+                signal = "traces";
+            elseif isa(exporter, "opentelemetry.sdk.metrics.MetricExporter")
+                signal = "metrics";
+            elseif isa(exporter, "opentelemetry.sdk.logs.LogRecordExporter")
+                signal = "logs";
+            else
+                error("opentelemetry:exporters:otlp:OtlpFileReplayer:InvalidExporter", ...
+                    "Exporter must be a span, metric, or log record exporter.");
+            end
+            obj.Exporter = exporter;
+            obj.Signal = signal;
+            obj.Proxy = libmexclass.proxy.Proxy("Name", ...
+                "libmexclass.opentelemetry.exporters.OtlpFileReplayerProxy", ...
+                "ConstructorArguments", {exporter.Proxy.ID, signal});
+
+            validnames = ["Workers", "MaxBatchSize"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function obj = set.Workers(obj, n)
+            n = obj.Validator.validateScalarPositiveInteger(n, "Workers");
+            obj.Proxy.setWorkers(n);
+            obj.Workers = n;
+        end
+
+        function obj = set.MaxBatchSize(obj, sz)
+            sz = obj.Validator.validateScalarPositiveInteger(sz, "MaxBatchSize");
+            obj.Proxy.setMaxBatchSize(sz);
+            obj.MaxBatchSize = sz;
+        end
+
+        function result = replay(obj, filenames)
+            % REPLAY Send the contents of files.
+            %    RESULT = REPLAY(R, FILES) reads the files written by an
+            %    OTLP file exporter in JSON or binary format, and sends
+            %    their contents. FILES is a string array of file names.
+            %    RESULT is a struct with the number of records read, the
+            %    number of records that could not be read, the number of
+            %    files that could not be opened, and the number of
+            %    requests sent and failed. The number of failed requests
+            %    is NaN if the exporter sends asynchronously, because
+            %    failures are then not reported.
+            arguments
+                obj
+                filenames {mustBeText}
+            end
+            filenames = string(filenames);
+            result = obj.Proxy.replay(reshape(filenames, 1, []));
+        end
+    end
+end
@@ -2,7 +2,7 @@ classdef OtlpFileValidator
 % OtlpFileValidator   Validate options inputs for OtlpFileSpanExporter, 
 % OtlpFileMetricExporter, and OtlpFileLogRecordExporter
 
-% Copyright 2024 The MathWorks, Inc.
+% Copyright 2024-2026 The MathWorks, Inc.
 
     methods (Static)
         function name = validateName(name, paramname)
@@ -27,6 +27,10 @@ classdef OtlpFileValidator
                     paramname + " must be a scalar positive integer.")
             end
             value = double(value);
+        end
+
+        function newformat = validateFormat(newformat)
+            newformat = string(validatestring(newformat, ["JSON", "binary"]));
         end      
     end
 end
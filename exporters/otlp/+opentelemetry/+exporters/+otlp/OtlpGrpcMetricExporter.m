@@ -3,7 +3,7 @@ classdef OtlpGrpcMetricExporter < opentelemetry.sdk.metrics.MetricExporter
 % gRPC. By default, it exports to the default address of the OpenTelemetry
 % Collector.
 
-% Copyright 2023-2024 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     properties
         Endpoint (1,1) string = "http://localhost:4317"   % Export destination
@@ -12,6 +12,9 @@ classdef OtlpGrpcMetricExporter < opentelemetry.sdk.metrics.MetricExporter
         CertificateString (1,1) string = ""     % In-memory string representation of .pem file for SSL encryption
         Timeout (1,1) duration = seconds(10)    % Maximum time above which exports will abort
         HttpHeaders (1,1) dictionary = dictionary(string.empty, string.empty)   % Additional HTTP headers
+        Compression (1,1) string = "none"        % Payload compression, "none" or "gzip"
+        MaxConcurrentRequests (1,1) double = 64  % Maximum number of export requests in flight
+        SharedClient (1,1) logical = false       % Whether to share one gRPC connection with other exporters
     end
 
     properties (Access=private, Constant)
@@ -40,6 +43,18 @@ classdef OtlpGrpcMetricExporter < opentelemetry.sdk.metrics.MetricExporter
             %       "Timeout"           - Maximum time above which exports 
             %                             will abort
             %       "HTTPHeaders"       - Additional HTTP Headers
+            %       "Compression"       - Payload compression: "none" (default)
+            %                             or "gzip"
+            %       "MaxConcurrentRequests"
+            %                           - Maximum number of export requests
+            %                             in flight at the same time.
+            %                             Default is 64. Requires a
+            %                             build with WITH_ASYNC_EXPORT.
+            %       "SharedClient"      - Whether to send requests over one
+            %                             gRPC connection shared with other
+            %                             exporters that use the same
+            %                             endpoint, credentials and
+            %                             compression. Default is false.
             %       "PreferredAggregationTemporality"  
             %                           - An aggregation temporality of 
             %                           - delta or cumulative
@@ -56,7 +71,8 @@ classdef OtlpGrpcMetricExporter < opentelemetry.sdk.metrics.MetricExporter
                 "libmexclass.opentelemetry.exporters.OtlpGrpcMetricExporterProxy");
 
             validnames = ["Endpoint", "UseCredentials ", "CertificatePath", ...
-                "CertificateString", "Timeout", "HttpHeaders", "PreferredAggregationTemporality"];
+                "CertificateString", "Timeout", "HttpHeaders", "Compression", ...
+                "MaxConcurrentRequests", "SharedClient", "PreferredAggregationTemporality"];
             for i = 1:length(optionnames)
                 namei = validatestring(optionnames{i}, validnames);
                 valuei = optionvalues{i};
@@ -99,5 +115,24 @@ classdef OtlpGrpcMetricExporter < opentelemetry.sdk.metrics.MetricExporter
             obj.Proxy.setHttpHeaders(headerkeys, headervalues);
             obj.HttpHeaders = httpheaders;
         end
+
+        function obj = set.Compression(obj, compression)
+            compression = obj.Validator.validateCompression(compression);
+            obj.Proxy.setCompression(compression);
+            obj.Compression = compression;
+        end
+
+        function obj = set.MaxConcurrentRequests(obj, maxrequests)
+            maxrequests = obj.Validator.validateScalarPositiveInteger(maxrequests, "MaxConcurrentRequests");
+            supported = obj.Proxy.setMaxConcurrentRequests(maxrequests);
+            obj.Validator.validateAsyncExportSupported(supported, "MaxConcurrentRequests");
+            obj.MaxConcurrentRequests = maxrequests;
+        end
+
+        function obj = set.SharedClient(obj, sharedclient)
+            sharedclient = obj.Validator.validateSharedClient(sharedclient);
+            obj.Proxy.setSharedClient(sharedclient);
+            obj.SharedClient = sharedclient;
+        end
     end
 end
@@ -2,7 +2,7 @@ classdef OtlpGrpcValidator < opentelemetry.exporters.otlp.OtlpValidator
 % OtlpGrpcValidator   Validate options inputs for OtlpGrpcSpanExporter, 
 % OtlpGrpcMetricExporter, and OtlpGrpcLogRecordExporter
 
-% Copyright 2023-2024 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     methods (Static)
         function uc = validateUseCredentials(uc)
@@ -28,5 +28,13 @@ classdef OtlpGrpcValidator < opentelemetry.exporters.otlp.OtlpValidator
             end
             certstr = string(certstr);
         end
+
+        function sc = validateSharedClient(sc)
+            if ~((islogical(sc) || isnumeric(sc)) && isscalar(sc))
+                error("opentelemetry:exporters:otlp:OtlpGrpcValidator:SharedClientNotScalarLogical", ...
+                    "SharedClient must be a scalar logical.")
+            end
+            sc = logical(sc);
+        end
     end
 end
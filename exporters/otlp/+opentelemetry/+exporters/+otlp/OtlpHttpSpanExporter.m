@@ -3,7 +3,7 @@ classdef OtlpHttpSpanExporter < opentelemetry.sdk.trace.SpanExporter
 % HTTP. By default, it exports to the default address of the OpenTelemetry
 % Collector.
 
-% Copyright 2023-2024 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     properties
         Endpoint (1,1) string = "http://localhost:4318/v1/traces" % Export destination
@@ -12,6 +12,9 @@ classdef OtlpHttpSpanExporter < opentelemetry.sdk.trace.SpanExporter
         UseJsonName (1,1) logical = false        % Whether to use JSON name of protobuf field to set the key of JSON      
         Timeout (1,1) duration = seconds(10)     % Maximum time above which exports will abort
         HttpHeaders (1,1) dictionary = dictionary(string.empty, string.empty)  % Additional HTTP headers
+        Compression (1,1) string = "none"        % Payload compression, "none" or "gzip"
+        MaxConcurrentRequests (1,1) double = 64  % Maximum number of export requests in flight
+        MaxRequestsPerConnection (1,1) double = 8  % Maximum number of requests sent on each connection
     end
 
     properties (Access=private, Constant)
@@ -40,6 +43,19 @@ classdef OtlpHttpSpanExporter < opentelemetry.sdk.trace.SpanExporter
             %       "Timeout"           - Maximum time above which exports 
             %                             will abort
             %       "HTTPHeaders"       - Additional HTTP Headers
+            %       "Compression"       - Payload compression: "none" (default)
+            %                             or "gzip"
+            %       "MaxConcurrentRequests"
+            %                           - Maximum number of export requests
+            %                             in flight at the same time.
+            %                             Default is 64. Requires a
+            %                             build with WITH_ASYNC_EXPORT.
+            %       "MaxRequestsPerConnection"
+            %                           - Maximum number of requests sent
+            %                             on each kept-alive connection
+            %                             before it is replaced. Default
+            %                             is 8. Requires a build with
+            %                             WITH_ASYNC_EXPORT.
             %
             %    See also
             %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPGRPCSPANEXPORTER, 
@@ -53,7 +69,8 @@ classdef OtlpHttpSpanExporter < opentelemetry.sdk.trace.SpanExporter
                 "libmexclass.opentelemetry.exporters.OtlpHttpSpanExporterProxy");
 
             validnames = ["Endpoint", "Format", "JsonBytesMapping", ...
-                "UseJsonName", "Timeout", "HttpHeaders"];
+                "UseJsonName", "Timeout", "HttpHeaders", "Compression", ...
+                "MaxConcurrentRequests", "MaxRequestsPerConnection"];
             for i = 1:length(optionnames)
                 namei = validatestring(optionnames{i}, validnames);
                 valuei = optionvalues{i};
@@ -96,5 +113,25 @@ classdef OtlpHttpSpanExporter < opentelemetry.sdk.trace.SpanExporter
             obj.Proxy.setHttpHeaders(headerkeys, headervalues);
             obj.HttpHeaders = httpheaders;
         end
+
+        function obj = set.Compression(obj, compression)
+            compression = obj.Validator.validateCompression(compression);
+            obj.Proxy.setCompression(compression);
+            obj.Compression = compression;
+        end
+
+        function obj = set.MaxConcurrentRequests(obj, maxrequests)
+            maxrequests = obj.Validator.validateScalarPositiveInteger(maxrequests, "MaxConcurrentRequests");
+            supported = obj.Proxy.setMaxConcurrentRequests(maxrequests);
+            obj.Validator.validateAsyncExportSupported(supported, "MaxConcurrentRequests");
+            obj.MaxConcurrentRequests = maxrequests;
+        end
+
+        function obj = set.MaxRequestsPerConnection(obj, maxrequests)
+            maxrequests = obj.Validator.validateScalarPositiveInteger(maxrequests, "MaxRequestsPerConnection");
+            supported = obj.Proxy.setMaxRequestsPerConnection(maxrequests);
+            obj.Validator.validateAsyncExportSupported(supported, "MaxRequestsPerConnection");
+            obj.MaxRequestsPerConnection = maxrequests;
+        end
     end
 end
@@ -1,7 +1,7 @@
 classdef OtlpValidator 
 % OtlpValidator   Validate export options
 
-% Copyright 2023 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     methods (Static)
         function ep = validateEndpoint(ep)
@@ -31,5 +31,27 @@ classdef OtlpValidator
                     "HttpHeaders dictionary values must be strings.")
             end
         end
+
+        function value = validateScalarPositiveInteger(value, paramname)
+            if ~((islogical(value) || isnumeric(value)) && isscalar(value) && ...
+                    value > 0 && round(value) == value)
+                error("opentelemetry:exporters:otlp:OtlpValidator:NotScalarPositiveInteger", ...
+                    paramname + " must be a scalar positive integer.")
+            end
+            value = double(value);
+        end
+
+        function validateAsyncExportSupported(supported, paramname)
+            % options that need asynchronous export are rejected by
+            % builds without it
+            if ~supported
+                error("opentelemetry:exporters:otlp:OtlpValidator:AsyncExportNotSupported", ...
+                    paramname + " requires a build with the WITH_ASYNC_EXPORT option.");
+            end
+        end
+
+        function compression = validateCompression(compression)
+            compression = string(validatestring(compression, ["none", "gzip"]));
+        end
     end
 end
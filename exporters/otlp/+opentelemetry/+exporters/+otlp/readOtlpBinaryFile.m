@@ -0,0 +1,31 @@
+function records = readOtlpBinaryFile(filename, signal)
+% Read a file written by an OTLP file exporter in binary format
+%    RECORDS = OPENTELEMETRY.EXPORTERS.OTLP.READOTLPBINARYFILE(FILENAME,
+%    SIGNAL) reads the length-delimited protobuf records in FILENAME and
+%    returns them as a cell array of structs, one per export request, in
+%    the same layout as the JSON output format. SIGNAL is "traces",
+%    "metrics", or "logs". Trace and span IDs are hex strings, as in the
+%    JSON output format. The whole file is read into memory, so large
+%    files should be split or replayed with OTLPFILEREPLAYER instead.
+%
+%    See also OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILESPANEXPORTER,
+%    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILEMETRICEXPORTER,
+%    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILELOGRECORDEXPORTER
+
+% Copyright 2026 The MathWorks, Inc.
+
+arguments
+    filename {mustBeTextScalar}
+    signal {mustBeTextScalar}
+end
+
+filename = string(filename);
+signal = string(validatestring(signal, ["traces", "metrics", "logs"]));
+reader = libmexclass.proxy.Proxy("Name", ...
+    "libmexclass.opentelemetry.exporters.OtlpBinaryFileReaderProxy", ...
+    "ConstructorArguments", {filename, signal});
+jsonrecords = reader.getRecords();
+records = cell(numel(jsonrecords), 1);
+for i = 1:numel(jsonrecords)
+    records{i} = jsondecode(jsonrecords(i));
+end
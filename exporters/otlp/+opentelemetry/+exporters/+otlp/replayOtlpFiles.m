@@ -0,0 +1,23 @@
+function result = replayOtlpFiles(filenames, exporter, varargin)
+% Send files written by the OTLP file exporters to a backend
+%    RESULT = OPENTELEMETRY.EXPORTERS.OTLP.REPLAYOTLPFILES(FILES, EXP)
+%    reads the files in string array FILES, written by an OTLP file
+%    exporter in JSON or binary format, and sends their contents through
+%    exporter EXP, typically an OTLP HTTP or gRPC exporter. Data is merged
+%    into large requests and sent by several workers in parallel. EXP
+%    must match the kind of data in the files, for example a span
+%    exporter for files written by OtlpFileSpanExporter. RESULT is a
+%    struct with the number of records read and requests sent.
+%
+%    RESULT = OPENTELEMETRY.EXPORTERS.OTLP.REPLAYOTLPFILES(..., PARAM1,
+%    VALUE1, PARAM2, VALUE2, ...) specifies the optional parameters
+%    "Workers" and "MaxBatchSize" of OtlpFileReplayer.
+%
+%    See also OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILEREPLAYER,
+%    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILESPANEXPORTER,
+%    OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPSPANEXPORTER
+
+% Copyright 2026 The MathWorks, Inc.
+
+replayer = opentelemetry.exporters.otlp.OtlpFileReplayer(exporter, varargin{:});
+result = replay(replayer, filenames);
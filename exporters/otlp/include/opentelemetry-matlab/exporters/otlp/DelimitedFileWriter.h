@@ -0,0 +1,73 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/exporters/otlp/otlp_file_client_options.h"
+
+#include <google/protobuf/message_lite.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Writes protobuf messages to files, each prefixed by its size as a varint, in the same format as
+// protobuf's delimited message utilities. Files are named and rotated following the file system
+// options of the OTLP file exporters. Once a file is open, a background thread flushes records
+// that have waited for the flush interval, so that they reach the file even if nothing else is
+// written.
+class DelimitedFileWriter {
+  public:
+    explicit DelimitedFileWriter(const otlp_exporter::OtlpFileClientFileSystemOptions& options);
+
+    ~DelimitedFileWriter();
+
+    DelimitedFileWriter(const DelimitedFileWriter&) = delete;
+    DelimitedFileWriter& operator=(const DelimitedFileWriter&) = delete;
+
+    bool write(const google::protobuf::MessageLite& message);
+
+    bool flush();
+
+    void close();
+
+  private:
+    bool openFile(bool truncate);
+
+    void updateAlias();
+
+    // body of the flush thread
+    void flushPeriodically();
+
+    // expand %N and %n to the rotate index and the remaining placeholders with strftime
+    std::string expandPattern(const std::string& pattern) const;
+
+    const otlp_exporter::OtlpFileClientFileSystemOptions Options;
+    std::mutex Mutex;
+    std::ofstream File;
+    std::string FileName;
+    size_t FileIndex = 0;
+    size_t FileSize = 0;
+    size_t UnflushedRecords = 0;
+    std::chrono::steady_clock::time_point LastFlush;
+    bool Closed = false;
+    std::condition_variable FlushCondition;
+    std::thread FlushThread;
+};
+
+// append the varint encoding of value to out
+void appendVarint(std::string& out, uint64_t value);
+
+// Read a varint from a stream. Returns false if the stream ends first or the varint is longer
+// than 10 bytes.
+bool readVarint(std::istream& in, uint64_t& value);
+
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+
+#include "opentelemetry/sdk/logs/exporter.h"
+#include "opentelemetry/exporters/otlp/otlp_file_client_options.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Log record exporter that writes each batch as a length-prefixed binary ExportLogsServiceRequest
+class OtlpBinaryFileLogRecordExporter : public logs_sdk::LogRecordExporter {
+  public:
+    explicit OtlpBinaryFileLogRecordExporter(const otlp_exporter::OtlpFileClientFileSystemOptions& options)
+        : Writer(options) {}
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    DelimitedFileWriter Writer;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/exporters/otlp/otlp_file_client_options.h"
+#include "opentelemetry/exporters/otlp/otlp_preferred_temporality.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Metric exporter that writes each collection as a length-prefixed binary ExportMetricsServiceRequest
+class OtlpBinaryFileMetricExporter : public metric_sdk::PushMetricExporter {
+  public:
+    OtlpBinaryFileMetricExporter(const otlp_exporter::OtlpFileClientFileSystemOptions& options,
+		    otlp_exporter::PreferredAggregationTemporality temporality);
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+		    metric_sdk::InstrumentType instrument_type) const noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(const metric_sdk::ResourceMetrics& data) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    DelimitedFileWriter Writer;
+    const metric_sdk::AggregationTemporalitySelector TemporalitySelector;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
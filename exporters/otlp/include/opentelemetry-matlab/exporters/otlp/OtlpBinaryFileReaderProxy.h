@@ -0,0 +1,29 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include <string>
+#include <vector>
+
+namespace libmexclass::opentelemetry::exporters {
+// Reads a file written by the OTLP file exporters in binary format, and converts each
+// length-delimited request to protobuf JSON, with trace and span IDs as hex strings like the JSON
+// file exporters. The whole file is converted when the proxy is created, so memory use grows with
+// the size of the file.
+class OtlpBinaryFileReaderProxy : public libmexclass::proxy::Proxy {
+  public:
+    OtlpBinaryFileReaderProxy(std::vector<std::string> records) : Records(std::move(records)) {
+        REGISTER_METHOD(OtlpBinaryFileReaderProxy, getRecords);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    void getRecords(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::vector<std::string> Records;
+};
+} // namespace libmexclass::opentelemetry::exporters
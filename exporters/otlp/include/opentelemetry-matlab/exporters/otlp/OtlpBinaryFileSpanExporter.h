@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/exporters/otlp/otlp_file_client_options.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Span exporter that writes each batch as a length-prefixed binary ExportTraceServiceRequest
+class OtlpBinaryFileSpanExporter : public trace_sdk::SpanExporter {
+  public:
+    explicit OtlpBinaryFileSpanExporter(const otlp_exporter::OtlpFileClientFileSystemOptions& options)
+        : Writer(options) {}
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    DelimitedFileWriter Writer;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
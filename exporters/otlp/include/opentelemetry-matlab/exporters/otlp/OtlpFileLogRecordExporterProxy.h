@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,6 +23,7 @@ class OtlpFileLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
         REGISTER_METHOD(OtlpFileLogRecordExporterProxy, setFlushRecordCount);
         REGISTER_METHOD(OtlpFileLogRecordExporterProxy, setMaxFileSize);
         REGISTER_METHOD(OtlpFileLogRecordExporterProxy, setMaxFileCount);
+        REGISTER_METHOD(OtlpFileLogRecordExporterProxy, setFormat);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
@@ -41,7 +42,10 @@ class OtlpFileLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
 
     void setMaxFileCount(libmexclass::proxy::method::Context& context);
 
+    void setFormat(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpFileLogRecordExporterOptions CppOptions;
+    bool Binary = false;   // write length-delimited binary protobuf instead of JSON lines
 };
 } // namespace libmexclass::opentelemetry
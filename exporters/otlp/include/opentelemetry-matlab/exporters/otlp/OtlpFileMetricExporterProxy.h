@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,6 +23,7 @@ class OtlpFileMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
         REGISTER_METHOD(OtlpFileMetricExporterProxy, setFlushRecordCount);
         REGISTER_METHOD(OtlpFileMetricExporterProxy, setMaxFileSize);
         REGISTER_METHOD(OtlpFileMetricExporterProxy, setMaxFileCount);
+        REGISTER_METHOD(OtlpFileMetricExporterProxy, setFormat);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
@@ -41,7 +42,10 @@ class OtlpFileMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
 
     void setMaxFileCount(libmexclass::proxy::method::Context& context);
 
+    void setFormat(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpFileMetricExporterOptions CppOptions;
+    bool Binary = false;   // write length-delimited binary protobuf instead of JSON lines
 };
 } // namespace libmexclass::opentelemetry
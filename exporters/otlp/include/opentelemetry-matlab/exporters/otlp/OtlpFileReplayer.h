@@ -0,0 +1,51 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/logs/exporter.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace logs_sdk = opentelemetry::sdk::logs;
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::exporters {
+
+struct OtlpFileReplayOptions {
+    size_t workers = 4;                          // number of exporters sending in parallel
+    size_t max_batch_bytes = 4 * 1024 * 1024;    // approximate serialized size of each request sent
+};
+
+struct OtlpFileReplayResult {
+    uint64_t records = 0;           // requests read from the files
+    uint64_t invalid_records = 0;   // lines or records that could not be parsed
+    uint64_t failed_files = 0;      // files that could not be opened
+    uint64_t batches = 0;           // requests sent after re-batching
+    uint64_t failed_batches = 0;    // requests the exporters failed to send, always 0 for exporters
+                                    // that send asynchronously and so do not report failures
+};
+
+// Replay files written by the OTLP file exporters, in either JSON lines or binary format. Files
+// are read as a stream, and the requests they contain are merged into larger requests, combining
+// data of the same resource. These are sent by a pool of worker threads, each with an exporter
+// created by the factory, so that uploads are not limited by the latency of a single connection.
+OtlpFileReplayResult replayTraceFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<trace_sdk::SpanExporter>()>& factory,
+		const OtlpFileReplayOptions& options);
+
+OtlpFileReplayResult replayLogFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<logs_sdk::LogRecordExporter>()>& factory,
+		const OtlpFileReplayOptions& options);
+
+OtlpFileReplayResult replayMetricFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<metric_sdk::PushMetricExporter>()>& factory,
+		const OtlpFileReplayOptions& options);
+
+} // namespace libmexclass::opentelemetry
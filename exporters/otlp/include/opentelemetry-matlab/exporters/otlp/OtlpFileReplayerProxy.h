@@ -0,0 +1,36 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpFileReplayer.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include <string>
+
+namespace libmexclass::opentelemetry::exporters {
+// Sends files written by the OTLP file exporters through a span, metric, or log record exporter
+class OtlpFileReplayerProxy : public libmexclass::proxy::Proxy {
+  public:
+    OtlpFileReplayerProxy(libmexclass::proxy::ID exporterid, const std::string& signal)
+	    : ExporterID(exporterid), Signal(signal) {
+        REGISTER_METHOD(OtlpFileReplayerProxy, setWorkers);
+        REGISTER_METHOD(OtlpFileReplayerProxy, setMaxBatchSize);
+        REGISTER_METHOD(OtlpFileReplayerProxy, replay);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    void setWorkers(libmexclass::proxy::method::Context& context);
+
+    void setMaxBatchSize(libmexclass::proxy::method::Context& context);
+
+    void replay(libmexclass::proxy::method::Context& context);
+
+  private:
+    libmexclass::proxy::ID ExporterID;
+    std::string Signal;
+    OtlpFileReplayOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,6 +23,7 @@ class OtlpFileSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
         REGISTER_METHOD(OtlpFileSpanExporterProxy, setFlushRecordCount);
         REGISTER_METHOD(OtlpFileSpanExporterProxy, setMaxFileSize);
         REGISTER_METHOD(OtlpFileSpanExporterProxy, setMaxFileCount);
+        REGISTER_METHOD(OtlpFileSpanExporterProxy, setFormat);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
@@ -41,7 +42,10 @@ class OtlpFileSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
 
     void setMaxFileCount(libmexclass::proxy::method::Context& context);
 
+    void setFormat(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpFileExporterOptions CppOptions;
+    bool Binary = false;   // write length-delimited binary protobuf instead of JSON lines
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,12 +23,17 @@ class OtlpGrpcLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
         REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setCertificateString);
         REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpGrpcLogRecordExporterProxy, setSharedClient);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<logs_sdk::LogRecordExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
     void setUseCredentials(libmexclass::proxy::method::Context& context);
     void setCertificatePath(libmexclass::proxy::method::Context& context);
@@ -36,7 +41,14 @@ class OtlpGrpcLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
     void setTimeout(libmexclass::proxy::method::Context& context);
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
 
+    void setCompression(libmexclass::proxy::method::Context& context);
+
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+
+    void setSharedClient(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpGrpcLogRecordExporterOptions CppOptions;
+    bool SharedClient = false;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,6 +23,9 @@ class OtlpGrpcMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
         REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setCertificateString);
         REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setSharedClient);
         REGISTER_METHOD(OtlpGrpcMetricExporterProxy, setTemporality);
     }
 
@@ -30,15 +33,21 @@ class OtlpGrpcMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
 
     std::unique_ptr<metric_sdk::PushMetricExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
     void setUseCredentials(libmexclass::proxy::method::Context& context);
     void setCertificatePath(libmexclass::proxy::method::Context& context);
     void setCertificateString(libmexclass::proxy::method::Context& context);
     void setTimeout(libmexclass::proxy::method::Context& context);
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
+    void setCompression(libmexclass::proxy::method::Context& context);
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+    void setSharedClient(libmexclass::proxy::method::Context& context);
     void setTemporality(libmexclass::proxy::method::Context& context);
 
   private:
     otlp_exporter::OtlpGrpcMetricExporterOptions CppOptions;
+    bool SharedClient = false;
 };
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,18 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/exporters/otlp/otlp_grpc_client.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_client_options.h"
+
+#include <memory>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+
+namespace libmexclass::opentelemetry::exporters {
+// Returns a gRPC client for the given options. The client is reused by every exporter that is
+// created while it is still in use and whose options give the same channel, that is the same
+// endpoint, credentials and compression, so that span, metric and log exporters send their
+// requests over one connection and TLS session.
+std::shared_ptr<otlp_exporter::OtlpGrpcClient> getSharedGrpcClient(const otlp_exporter::OtlpGrpcClientOptions& options);
+} // namespace libmexclass::opentelemetry
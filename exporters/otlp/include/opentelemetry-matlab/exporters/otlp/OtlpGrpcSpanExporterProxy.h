@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,12 +23,17 @@ class OtlpGrpcSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
         REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setCertificateString);
         REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpGrpcSpanExporterProxy, setSharedClient);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
     void setUseCredentials(libmexclass::proxy::method::Context& context);
     void setCertificatePath(libmexclass::proxy::method::Context& context);
@@ -36,7 +41,14 @@ class OtlpGrpcSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
     void setTimeout(libmexclass::proxy::method::Context& context);
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
 
+    void setCompression(libmexclass::proxy::method::Context& context);
+
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+
+    void setSharedClient(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpGrpcExporterOptions CppOptions;
+    bool SharedClient = false;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,12 +23,17 @@ class OtlpHttpLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
         REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setUseJsonName);
         REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpHttpLogRecordExporterProxy, setMaxRequestsPerConnection);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<logs_sdk::LogRecordExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
 
     void setFormat(libmexclass::proxy::method::Context& context);
@@ -41,6 +46,12 @@ class OtlpHttpLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::Lo
 
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
 
+    void setCompression(libmexclass::proxy::method::Context& context);
+
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+
+    void setMaxRequestsPerConnection(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpHttpLogRecordExporterOptions CppOptions;
 };
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,6 +23,9 @@ class OtlpHttpMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
         REGISTER_METHOD(OtlpHttpMetricExporterProxy, setUseJsonName);
         REGISTER_METHOD(OtlpHttpMetricExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpHttpMetricExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpHttpMetricExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpHttpMetricExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpHttpMetricExporterProxy, setMaxRequestsPerConnection);
         REGISTER_METHOD(OtlpHttpMetricExporterProxy, setTemporality);
     }
 
@@ -30,12 +33,20 @@ class OtlpHttpMetricExporterProxy: public libmexclass::opentelemetry::sdk::Metri
 
     std::unique_ptr<metric_sdk::PushMetricExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
     void setFormat(libmexclass::proxy::method::Context& context);
     void setJsonBytesMapping(libmexclass::proxy::method::Context& context);
     void setUseJsonName(libmexclass::proxy::method::Context& context);
     void setTimeout(libmexclass::proxy::method::Context& context);
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
+
+    void setCompression(libmexclass::proxy::method::Context& context);
+
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+
+    void setMaxRequestsPerConnection(libmexclass::proxy::method::Context& context);
     void setTemporality(libmexclass::proxy::method::Context& context);
 
   private:
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -23,12 +23,17 @@ class OtlpHttpSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
         REGISTER_METHOD(OtlpHttpSpanExporterProxy, setUseJsonName);
         REGISTER_METHOD(OtlpHttpSpanExporterProxy, setTimeout);
         REGISTER_METHOD(OtlpHttpSpanExporterProxy, setHttpHeaders);
+        REGISTER_METHOD(OtlpHttpSpanExporterProxy, setCompression);
+        REGISTER_METHOD(OtlpHttpSpanExporterProxy, setMaxConcurrentRequests);
+        REGISTER_METHOD(OtlpHttpSpanExporterProxy, setMaxRequestsPerConnection);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
 
+    bool exportsAsynchronously() const override;
+
     void setEndpoint(libmexclass::proxy::method::Context& context);
 
     void setFormat(libmexclass::proxy::method::Context& context);
@@ -41,6 +46,12 @@ class OtlpHttpSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExp
 
     void setHttpHeaders(libmexclass::proxy::method::Context& context);
 
+    void setCompression(libmexclass::proxy::method::Context& context);
+
+    void setMaxConcurrentRequests(libmexclass::proxy::method::Context& context);
+
+    void setMaxRequestsPerConnection(libmexclass::proxy::method::Context& context);
+
   private:
     otlp_exporter::OtlpHttpExporterOptions CppOptions;
 };
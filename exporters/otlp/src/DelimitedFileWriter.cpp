@@ -0,0 +1,196 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <system_error>
+
+namespace libmexclass::opentelemetry::exporters {
+
+void appendVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool readVarint(std::istream& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 70; shift += 7) {
+        int byte = in.get();
+        if (byte == std::char_traits<char>::eof()) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+DelimitedFileWriter::DelimitedFileWriter(const otlp_exporter::OtlpFileClientFileSystemOptions& options)
+	: Options(options), LastFlush(std::chrono::steady_clock::now()) {}
+
+DelimitedFileWriter::~DelimitedFileWriter() {
+    close();
+}
+
+std::string DelimitedFileWriter::expandPattern(const std::string& pattern) const {
+    std::string timepattern;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        if (pattern[i] == '%' && i + 1 < pattern.size()) {
+            char spec = pattern[++i];
+            if (spec == 'N' || spec == 'n') {
+                timepattern += std::to_string(FileIndex + (spec == 'n' ? 1 : 0));
+            } else {
+                timepattern += '%';
+                timepattern += spec;
+            }
+        } else {
+            timepattern += pattern[i];
+        }
+    }
+    std::time_t now = std::time(nullptr);
+    std::tm tmnow;
+#ifdef _WIN32
+    localtime_s(&tmnow, &now);
+#else
+    localtime_r(&now, &tmnow);
+#endif
+    std::string result(timepattern.size() + 256, '\0');
+    size_t len = std::strftime(result.data(), result.size(), timepattern.c_str(), &tmnow);
+    if (len == 0) {   // empty result or buffer too small, use the pattern without time placeholders
+        return timepattern;
+    }
+    result.resize(len);
+    return result;
+}
+
+bool DelimitedFileWriter::openFile(bool truncate) {
+    if (File.is_open()) {
+        File.close();
+    }
+    FileName = expandPattern(Options.file_pattern);
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(FileName).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+    File.open(FileName, std::ios::binary | (truncate ? std::ios::trunc : std::ios::app));
+    FileSize = truncate ? 0 : static_cast<size_t>(std::filesystem::file_size(FileName, ec));
+    if (ec) {
+        FileSize = 0;
+    }
+    updateAlias();
+    return File.is_open();
+}
+
+void DelimitedFileWriter::updateAlias() {
+    if (Options.alias_pattern.empty()) {
+        return;
+    }
+    // The alias is a symbolic link to the current file, or a hard link where symbolic links
+    // are not permitted. Failures are ignored, the alias is only a convenience.
+    std::error_code ec;
+    std::filesystem::path alias(expandPattern(Options.alias_pattern));
+    std::filesystem::path target = std::filesystem::absolute(FileName, ec);
+    if (ec || alias == target) {
+        return;
+    }
+    std::filesystem::remove(alias, ec);
+    std::filesystem::create_symlink(target, alias, ec);
+    if (ec) {
+        std::filesystem::create_hard_link(target, alias, ec);
+    }
+}
+
+bool DelimitedFileWriter::write(const google::protobuf::MessageLite& message) {
+    std::string record;
+    appendVarint(record, static_cast<uint64_t>(message.ByteSizeLong()));
+    if (!message.AppendToString(&record)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Closed) {
+        return false;
+    }
+    if (!File.is_open()) {
+        // append to an existing first file, rotated files are overwritten
+        if (!openFile(false)) {
+            return false;
+        }
+        if (!FlushThread.joinable() && Options.flush_interval.count() > 0) {
+            FlushThread = std::thread(&DelimitedFileWriter::flushPeriodically, this);
+        }
+    } else if (FileSize > 0 && FileSize + record.size() > Options.file_size) {
+        FileIndex = Options.rotate_size > 0 ? (FileIndex + 1) % Options.rotate_size : 0;
+        if (!openFile(true)) {
+            return false;
+        }
+    }
+    File.write(record.data(), static_cast<std::streamsize>(record.size()));
+    FileSize += record.size();
+    if (++UnflushedRecords == 1) {
+        FlushCondition.notify_all();
+    }
+
+    // the flush thread only wakes up once per interval, so also check as records are written
+    auto now = std::chrono::steady_clock::now();
+    if (UnflushedRecords >= Options.flush_count || now - LastFlush >= Options.flush_interval) {
+        File.flush();
+        UnflushedRecords = 0;
+        LastFlush = now;
+    }
+    return File.good();
+}
+
+bool DelimitedFileWriter::flush() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (File.is_open()) {
+        File.flush();
+        UnflushedRecords = 0;
+        LastFlush = std::chrono::steady_clock::now();
+        return File.good();
+    }
+    return true;
+}
+
+void DelimitedFileWriter::flushPeriodically() {
+    // bound each wait so that very long intervals do not overflow the clock
+    std::chrono::microseconds interval = (std::min)(
+        std::chrono::duration_cast<std::chrono::microseconds>(Options.flush_interval),
+        std::chrono::microseconds(std::chrono::hours(1)));
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (!Closed) {
+        if (UnflushedRecords == 0) {
+            FlushCondition.wait(lock);   // woken by the first record after a flush, or by close
+        } else if (FlushCondition.wait_until(lock, LastFlush + interval) == std::cv_status::timeout) {
+            auto now = std::chrono::steady_clock::now();
+            if (!Closed && UnflushedRecords > 0 && now - LastFlush >= Options.flush_interval) {
+                File.flush();
+                UnflushedRecords = 0;
+                LastFlush = now;
+            }
+        }
+    }
+}
+
+void DelimitedFileWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (File.is_open()) {
+            File.close();
+        }
+        Closed = true;
+    }
+    FlushCondition.notify_all();
+    if (FlushThread.joinable()) {
+        FlushThread.join();
+    }
+}
+} // namespace libmexclass::opentelemetry
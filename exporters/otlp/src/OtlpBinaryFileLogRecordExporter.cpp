@@ -0,0 +1,40 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileLogRecordExporter.h"
+
+#include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace libmexclass::opentelemetry::exporters {
+std::unique_ptr<logs_sdk::Recordable> OtlpBinaryFileLogRecordExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<logs_sdk::Recordable>(new otlp_exporter::OtlpLogRecordable());
+}
+
+::opentelemetry::sdk::common::ExportResult OtlpBinaryFileLogRecordExporter::Export(
+		const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    if (records.empty()) {
+        return ::opentelemetry::sdk::common::ExportResult::kSuccess;
+    }
+    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(records, &request);
+    return Writer.write(request) ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool OtlpBinaryFileLogRecordExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    return Writer.flush();
+}
+
+bool OtlpBinaryFileLogRecordExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    Writer.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,44 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileMetricExporter.h"
+
+#include "opentelemetry/exporters/otlp/otlp_metric_utils.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace libmexclass::opentelemetry::exporters {
+OtlpBinaryFileMetricExporter::OtlpBinaryFileMetricExporter(const otlp_exporter::OtlpFileClientFileSystemOptions& options,
+		otlp_exporter::PreferredAggregationTemporality temporality)
+	: Writer(options), TemporalitySelector(otlp_exporter::OtlpMetricUtils::ChooseTemporalitySelector(temporality)) {}
+
+metric_sdk::AggregationTemporality OtlpBinaryFileMetricExporter::GetAggregationTemporality(
+		metric_sdk::InstrumentType instrument_type) const noexcept {
+    return TemporalitySelector(instrument_type);
+}
+
+::opentelemetry::sdk::common::ExportResult OtlpBinaryFileMetricExporter::Export(
+		const metric_sdk::ResourceMetrics& data) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    if (data.scope_metric_data_.empty()) {
+        return ::opentelemetry::sdk::common::ExportResult::kSuccess;
+    }
+    ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+    otlp_exporter::OtlpMetricUtils::PopulateRequest(data, &request);
+    return Writer.write(request) ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool OtlpBinaryFileMetricExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    return Writer.flush();
+}
+
+bool OtlpBinaryFileMetricExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    Writer.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
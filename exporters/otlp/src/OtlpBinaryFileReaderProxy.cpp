@@ -0,0 +1,142 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileReaderProxy.h"
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+
+#include "MatlabDataArray.hpp"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/util/json_util.h>
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <system_error>
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+// records are limited to this size when the size of the file is not known, e.g. for a pipe
+constexpr uint64_t MaxRecordBytes = 256 * 1024 * 1024;
+
+bool isIdField(const std::string& name) {
+    return name == "trace_id" || name == "span_id" || name == "parent_span_id";
+}
+
+// The JSON file exporters write trace and span IDs as hex strings, while protobuf's JSON printer
+// writes bytes fields as base64. The ID is replaced by the bytes whose base64 encoding is its hex
+// text, the reverse of how OtlpFileReplayer reads IDs from JSON files.
+std::string bytesIdToHex(const std::string& id) {
+    static const char hexdigits[] = "0123456789abcdef";
+    auto base64value = [](char c) {
+        return c >= 'A' && c <= 'Z' ? c - 'A' : c >= 'a' && c <= 'z' ? c - 'a' + 26 : c - '0' + 52;
+    };
+    std::string hex;
+    for (char c : id) {
+        hex.push_back(hexdigits[(static_cast<uint8_t>(c) >> 4) & 0xF]);
+        hex.push_back(hexdigits[static_cast<uint8_t>(c) & 0xF]);
+    }
+    // 16 and 8 byte IDs give 32 and 16 hex digits, which decode from base64 without padding
+    std::string bytes;
+    for (size_t i = 0; i + 4 <= hex.size(); i += 4) {
+        uint32_t n = static_cast<uint32_t>(base64value(hex[i])) << 18 | static_cast<uint32_t>(base64value(hex[i + 1])) << 12
+                | static_cast<uint32_t>(base64value(hex[i + 2])) << 6 | static_cast<uint32_t>(base64value(hex[i + 3]));
+        bytes.push_back(static_cast<char>((n >> 16) & 0xFF));
+        bytes.push_back(static_cast<char>((n >> 8) & 0xFF));
+        bytes.push_back(static_cast<char>(n & 0xFF));
+    }
+    return bytes;
+}
+
+// Convert the trace and span ID fields of a request, wherever they occur
+void bytesIdsToHex(google::protobuf::Message& message) {
+    const google::protobuf::Reflection* reflection = message.GetReflection();
+    std::vector<const google::protobuf::FieldDescriptor*> fields;
+    reflection->ListFields(message, &fields);
+    for (const auto* field : fields) {
+        if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+            if (field->is_repeated()) {
+                for (int i = 0; i < reflection->FieldSize(message, field); ++i) {
+                    bytesIdsToHex(*reflection->MutableRepeatedMessage(&message, field, i));
+                }
+            } else {
+                bytesIdsToHex(*reflection->MutableMessage(&message, field));
+            }
+        } else if (field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES && !field->is_repeated()
+                && isIdField(field->name())) {
+            const std::string id = reflection->GetString(message, field);
+            if (id.size() == 16 || id.size() == 8) {
+                reflection->SetString(&message, field, bytesIdToHex(id));
+            }
+        }
+    }
+}
+} // namespace
+
+libmexclass::proxy::MakeResult OtlpBinaryFileReaderProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::StringArray filename_mda = constructor_arguments[0];
+    std::string filename = static_cast<std::string>(filename_mda[0]);
+    matlab::data::StringArray signal_mda = constructor_arguments[1];
+    std::string signal = static_cast<std::string>(signal_mda[0]);
+
+    std::unique_ptr<google::protobuf::Message> message;
+    if (signal.compare("traces") == 0) {
+        message = std::make_unique<::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest>();
+    } else if (signal.compare("metrics") == 0) {
+        message = std::make_unique<::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>();
+    } else {   // logs
+        message = std::make_unique<::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest>();
+    }
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        return libmexclass::error::Error{"opentelemetry:exporters:otlp:readOtlpBinaryFile:FileOpenFailed",
+            "Unable to open file " + filename + "."};
+    }
+    std::error_code ec;
+    uint64_t filesize = std::filesystem::file_size(filename, ec);
+
+    google::protobuf::util::JsonPrintOptions jsonoptions;
+    jsonoptions.preserve_proto_field_names = false;   // lowerCamelCase, as the JSON file format
+    // all records are converted before returning, so the JSON text of the whole file is held in memory
+    std::vector<std::string> records;
+    std::string record;   // binary record, reused for each record
+    while (file.peek() != std::char_traits<char>::eof()) {
+        uint64_t start = static_cast<uint64_t>(file.tellg());
+        uint64_t len;
+        bool valid = readVarint(file, len);
+        // check the size against the rest of the file before allocating
+        if (valid) {
+            valid = ec ? len <= MaxRecordBytes : len <= filesize - static_cast<uint64_t>(file.tellg());
+        }
+        if (valid) {
+            record.resize(static_cast<size_t>(len));
+            valid = file.read(record.data(), static_cast<std::streamsize>(len)) && message->ParseFromString(record);
+        }
+        if (!valid) {
+            return libmexclass::error::Error{"opentelemetry:exporters:otlp:readOtlpBinaryFile:InvalidRecord",
+                "Invalid or truncated record at byte " + std::to_string(start) + " of file " + filename + "."};
+        }
+        bytesIdsToHex(*message);
+        std::string json;
+        google::protobuf::util::MessageToJsonString(*message, &json, jsonoptions);
+        records.push_back(std::move(json));
+    }
+    return std::make_shared<OtlpBinaryFileReaderProxy>(std::move(records));
+}
+
+void OtlpBinaryFileReaderProxy::getRecords(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+    auto records_mda = factory.createArray<matlab::data::MATLABString>({Records.size(), 1});
+    for (size_t i = 0; i < Records.size(); ++i) {
+        records_mda[i] = Records[i];
+    }
+    context.outputs[0] = records_mda;
+}
+} // namespace libmexclass::opentelemetry::exporters
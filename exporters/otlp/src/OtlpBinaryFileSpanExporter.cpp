@@ -0,0 +1,40 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileSpanExporter.h"
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace libmexclass::opentelemetry::exporters {
+std::unique_ptr<trace_sdk::Recordable> OtlpBinaryFileSpanExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new otlp_exporter::OtlpRecordable());
+}
+
+::opentelemetry::sdk::common::ExportResult OtlpBinaryFileSpanExporter::Export(
+		const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    if (spans.empty()) {
+        return ::opentelemetry::sdk::common::ExportResult::kSuccess;
+    }
+    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(spans, &request);
+    return Writer.write(request) ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool OtlpBinaryFileSpanExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    return Writer.flush();
+}
+
+bool OtlpBinaryFileSpanExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    Writer.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
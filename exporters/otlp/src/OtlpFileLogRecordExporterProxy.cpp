@@ -1,7 +1,9 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/exporters/otlp/OtlpFileLogRecordExporterProxy.h"
 
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileLogRecordExporter.h"
+
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/exporters/otlp/otlp_file_log_record_exporter_factory.h"
@@ -17,6 +19,10 @@ libmexclass::proxy::MakeResult OtlpFileLogRecordExporterProxy::make(const libmex
 }
 
 std::unique_ptr<logs_sdk::LogRecordExporter> OtlpFileLogRecordExporterProxy::getInstance() {
+    if (Binary) {
+        return std::make_unique<OtlpBinaryFileLogRecordExporter>(
+		nostd::get<otlp_exporter::OtlpFileClientFileSystemOptions>(CppOptions.backend_options));
+    }
     return otlp_exporter::OtlpFileLogRecordExporterFactory::Create(CppOptions);
 }
 
@@ -68,4 +74,9 @@ void OtlpFileLogRecordExporterProxy::setMaxFileCount(libmexclass::proxy::method:
     CppOptions.backend_options = options;
 }
 
+void OtlpFileLogRecordExporterProxy::setFormat(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray format_mda = context.inputs[0];
+    Binary = (static_cast<std::string>(format_mda[0]).compare("binary") == 0);
+}
+
 } // namespace libmexclass::opentelemetry
@@ -1,7 +1,9 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/exporters/otlp/OtlpFileMetricExporterProxy.h"
 
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileMetricExporter.h"
+
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/exporters/otlp/otlp_file_metric_exporter_factory.h"
@@ -17,6 +19,10 @@ libmexclass::proxy::MakeResult OtlpFileMetricExporterProxy::make(const libmexcla
 }
 
 std::unique_ptr<metric_sdk::PushMetricExporter> OtlpFileMetricExporterProxy::getInstance() {
+    if (Binary) {
+        return std::make_unique<OtlpBinaryFileMetricExporter>(
+		nostd::get<otlp_exporter::OtlpFileClientFileSystemOptions>(CppOptions.backend_options), CppOptions.aggregation_temporality);
+    }
     return otlp_exporter::OtlpFileMetricExporterFactory::Create(CppOptions);
 }
 
@@ -68,4 +74,9 @@ void OtlpFileMetricExporterProxy::setMaxFileCount(libmexclass::proxy::method::Co
     CppOptions.backend_options = options;
 }
 
+void OtlpFileMetricExporterProxy::setFormat(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray format_mda = context.inputs[0];
+    Binary = (static_cast<std::string>(format_mda[0]).compare("binary") == 0);
+}
+
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,309 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpFileReplayer.h"
+#include "opentelemetry-matlab/exporters/otlp/DelimitedFileWriter.h"
+#include "opentelemetry-matlab/sdk/trace/TraceRequestReplay.h"
+#include "opentelemetry-matlab/sdk/logs/LogsRequestReplay.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricsRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/util/json_util.h>
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace trace_collector = ::opentelemetry::proto::collector::trace::v1;
+namespace logs_collector = ::opentelemetry::proto::collector::logs::v1;
+namespace metrics_collector = ::opentelemetry::proto::collector::metrics::v1;
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+// Access to the per-resource entries of each request type
+google::protobuf::RepeatedPtrField< ::opentelemetry::proto::trace::v1::ResourceSpans>* resourceEntries(
+		trace_collector::ExportTraceServiceRequest& request) {
+    return request.mutable_resource_spans();
+}
+
+google::protobuf::RepeatedPtrField< ::opentelemetry::proto::logs::v1::ResourceLogs>* resourceEntries(
+		logs_collector::ExportLogsServiceRequest& request) {
+    return request.mutable_resource_logs();
+}
+
+google::protobuf::RepeatedPtrField< ::opentelemetry::proto::metrics::v1::ResourceMetrics>* resourceEntries(
+		metrics_collector::ExportMetricsServiceRequest& request) {
+    return request.mutable_resource_metrics();
+}
+
+void moveScopes(::opentelemetry::proto::trace::v1::ResourceSpans& from, ::opentelemetry::proto::trace::v1::ResourceSpans& to) {
+    for (auto& scope : *from.mutable_scope_spans()) {
+        *to.add_scope_spans() = std::move(scope);
+    }
+}
+
+void moveScopes(::opentelemetry::proto::logs::v1::ResourceLogs& from, ::opentelemetry::proto::logs::v1::ResourceLogs& to) {
+    for (auto& scope : *from.mutable_scope_logs()) {
+        *to.add_scope_logs() = std::move(scope);
+    }
+}
+
+void moveScopes(::opentelemetry::proto::metrics::v1::ResourceMetrics& from,
+		::opentelemetry::proto::metrics::v1::ResourceMetrics& to) {
+    for (auto& scope : *from.mutable_scope_metrics()) {
+        *to.add_scope_metrics() = std::move(scope);
+    }
+}
+
+common_sdk::ExportResult exportRequest(const trace_collector::ExportTraceServiceRequest& request,
+		trace_sdk::SpanExporter& exporter) {
+    return sdk::exportTraceRequest(request, exporter);
+}
+
+common_sdk::ExportResult exportRequest(const logs_collector::ExportLogsServiceRequest& request,
+		logs_sdk::LogRecordExporter& exporter) {
+    return sdk::exportLogsRequest(request, exporter);
+}
+
+common_sdk::ExportResult exportRequest(const metrics_collector::ExportMetricsServiceRequest& request,
+		metric_sdk::PushMetricExporter& exporter) {
+    return sdk::exportMetricsRequest(request, exporter);
+}
+
+bool isIdField(const std::string& name) {
+    return name == "trace_id" || name == "span_id" || name == "parent_span_id";
+}
+
+// The file exporters write trace and span IDs as hex strings, as the OTLP JSON encoding requires,
+// while protobuf's JSON parser reads bytes fields as base64. Hex digits are valid base64, so the
+// parser accepts the IDs, and encoding the parsed bytes as base64 again restores the hex text.
+// IDs of the expected size were written as base64 and are left as they are.
+bool hexIdToBytes(const std::string& parsed, std::string& id) {
+    static const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto hexdigit = [](char c) {
+        return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+    };
+    // 32 and 16 hex digits decode to 24 and 12 bytes, without padding
+    if (parsed.size() != 24 && parsed.size() != 12) {
+        return false;
+    }
+    std::string hex;
+    for (size_t i = 0; i < parsed.size(); i += 3) {
+        uint32_t n = static_cast<uint32_t>(static_cast<uint8_t>(parsed[i])) << 16
+                | static_cast<uint32_t>(static_cast<uint8_t>(parsed[i + 1])) << 8
+                | static_cast<uint8_t>(parsed[i + 2]);
+        for (int shift = 18; shift >= 0; shift -= 6) {
+            hex.push_back(base64[(n >> shift) & 0x3F]);
+        }
+    }
+    id.clear();
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        int hi = hexdigit(hex[i]);
+        int lo = hexdigit(hex[i + 1]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        id.push_back(static_cast<char>((hi << 4) | lo));
+    }
+    return true;
+}
+
+// Convert the trace and span ID fields of a parsed JSON request, wherever they occur
+void hexIdsToBytes(google::protobuf::Message& message) {
+    const google::protobuf::Reflection* reflection = message.GetReflection();
+    std::vector<const google::protobuf::FieldDescriptor*> fields;
+    reflection->ListFields(message, &fields);
+    std::string id;
+    for (const auto* field : fields) {
+        if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+            if (field->is_repeated()) {
+                for (int i = 0; i < reflection->FieldSize(message, field); ++i) {
+                    hexIdsToBytes(*reflection->MutableRepeatedMessage(&message, field, i));
+                }
+            } else {
+                hexIdsToBytes(*reflection->MutableMessage(&message, field));
+            }
+        } else if (field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES && !field->is_repeated()
+                && isIdField(field->name()) && hexIdToBytes(reflection->GetString(message, field), id)) {
+            reflection->SetString(&message, field, id);
+        }
+    }
+}
+
+// Calls a function with each request in a file. The JSON lines format is recognized from its
+// first characters, anything else is read as length-delimited binary records.
+template <typename Request, typename Callback>
+bool readFile(const std::string& filename, OtlpFileReplayResult& result, Callback callback) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    char start[2] = {0, 0};
+    file.read(start, 2);
+    file.clear();
+    file.seekg(0);
+    bool json = start[0] == '{' && (start[1] == '"' || start[1] == '}');
+
+    Request request;
+    std::string record;
+    if (json) {
+        google::protobuf::util::JsonParseOptions jsonoptions;
+        jsonoptions.ignore_unknown_fields = true;
+        while (std::getline(file, record)) {
+            if (record.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            request.Clear();
+            if (google::protobuf::util::JsonStringToMessage(record, &request, jsonoptions).ok()) {
+                hexIdsToBytes(request);
+                callback(request);
+            } else {
+                ++result.invalid_records;
+            }
+        }
+    } else {
+        uint64_t len;
+        while (readVarint(file, len)) {
+            record.resize(static_cast<size_t>(len));
+            if (!file.read(&record[0], static_cast<std::streamsize>(len))) {
+                ++result.invalid_records;   // truncated, typically by a crash of the writer
+                break;
+            }
+            request.Clear();
+            if (request.ParseFromString(record)) {
+                callback(request);
+            } else {
+                ++result.invalid_records;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename Request, typename Exporter>
+OtlpFileReplayResult replayFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<Exporter>()>& factory, const OtlpFileReplayOptions& options) {
+    OtlpFileReplayResult result;
+    size_t nworkers = (std::max)(options.workers, size_t(1));
+    size_t capacity = 2 * nworkers;   // bounds memory use when the network is slower than the disk
+
+    std::mutex mutex;
+    std::condition_variable notfull;
+    std::condition_variable notempty;
+    std::deque<Request> queue;
+    bool done = false;
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < nworkers; ++i) {
+        workers.emplace_back([&] {
+            std::unique_ptr<Exporter> exporter = factory();
+            Request batch;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    notempty.wait(lock, [&] { return done || !queue.empty(); });
+                    if (queue.empty()) {
+                        break;
+                    }
+                    batch = std::move(queue.front());
+                    queue.pop_front();
+                }
+                notfull.notify_one();
+                bool ok = exportRequest(batch, *exporter) == common_sdk::ExportResult::kSuccess;
+                std::lock_guard<std::mutex> lock(mutex);
+                ++result.batches;
+                if (!ok) {
+                    ++result.failed_batches;
+                }
+            }
+            exporter->ForceFlush();
+            exporter->Shutdown();
+        });
+    }
+
+    // merge requests into a batch, combining entries with the same resource
+    Request batch;
+    size_t batchbytes = 0;
+    std::unordered_map<std::string, int> resourceindex;
+    auto send = [&] {
+        if (batchbytes == 0) {
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notfull.wait(lock, [&] { return queue.size() < capacity; });
+            queue.push_back(std::move(batch));
+        }
+        notempty.notify_one();
+        batch = Request();
+        batchbytes = 0;
+        resourceindex.clear();
+    };
+    auto add = [&](Request& request) {
+        ++result.records;
+        size_t bytes = request.ByteSizeLong();
+        auto* batchentries = resourceEntries(batch);
+        for (auto& entry : *resourceEntries(request)) {
+            std::string key = entry.resource().SerializeAsString() + '\0' + entry.schema_url();
+            auto found = resourceindex.find(key);
+            if (found == resourceindex.end()) {
+                resourceindex.emplace(std::move(key), batchentries->size());
+                *batchentries->Add() = std::move(entry);
+            } else {
+                moveScopes(entry, *batchentries->Mutable(found->second));
+            }
+        }
+        batchbytes += bytes;
+        if (batchbytes >= options.max_batch_bytes) {
+            send();
+        }
+    };
+    for (const auto& filename : filenames) {
+        if (!readFile<Request>(filename, result, add)) {
+            ++result.failed_files;
+        }
+    }
+    send();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    notempty.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return result;
+}
+} // namespace
+
+OtlpFileReplayResult replayTraceFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<trace_sdk::SpanExporter>()>& factory,
+		const OtlpFileReplayOptions& options) {
+    return replayFiles<trace_collector::ExportTraceServiceRequest>(filenames, factory, options);
+}
+
+OtlpFileReplayResult replayLogFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<logs_sdk::LogRecordExporter>()>& factory,
+		const OtlpFileReplayOptions& options) {
+    return replayFiles<logs_collector::ExportLogsServiceRequest>(filenames, factory, options);
+}
+
+OtlpFileReplayResult replayMetricFiles(const std::vector<std::string>& filenames,
+		const std::function<std::unique_ptr<metric_sdk::PushMetricExporter>()>& factory,
+		const OtlpFileReplayOptions& options) {
+    return replayFiles<metrics_collector::ExportMetricsServiceRequest>(filenames, factory, options);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,70 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpFileReplayerProxy.h"
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include "MatlabDataArray.hpp"
+
+#include <limits>
+
+namespace libmexclass::opentelemetry::exporters {
+libmexclass::proxy::MakeResult OtlpFileReplayerProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    matlab::data::StringArray signal_mda = constructor_arguments[1];
+    std::string signal = static_cast<std::string>(signal_mda[0]);
+    return std::make_shared<OtlpFileReplayerProxy>(exporterid, signal);
+}
+
+void OtlpFileReplayerProxy::setWorkers(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> workers_mda = context.inputs[0];
+    CppOptions.workers = static_cast<size_t>(workers_mda[0]);
+}
+
+void OtlpFileReplayerProxy::setMaxBatchSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> batchsize_mda = context.inputs[0];
+    CppOptions.max_batch_bytes = static_cast<size_t>(batchsize_mda[0]);
+}
+
+void OtlpFileReplayerProxy::replay(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filenames_mda = context.inputs[0];
+    std::vector<std::string> filenames;
+    for (const auto& filename : filenames_mda) {
+        filenames.push_back(static_cast<std::string>(filename));
+    }
+
+    // each worker creates its own exporter, with the options of the MATLAB exporter object
+    auto exporterproxy = libmexclass::proxy::ProxyManager::getProxy(ExporterID);
+    OtlpFileReplayResult result;
+    bool async;
+    if (Signal.compare("traces") == 0) {
+        auto spanexporter = std::static_pointer_cast<sdk::SpanExporterProxy>(exporterproxy);
+        async = spanexporter->exportsAsynchronously();
+        result = replayTraceFiles(filenames, [spanexporter] { return spanexporter->getInstance(); }, CppOptions);
+    } else if (Signal.compare("metrics") == 0) {
+        auto metricexporter = std::static_pointer_cast<sdk::MetricExporterProxy>(exporterproxy);
+        async = metricexporter->exportsAsynchronously();
+        result = replayMetricFiles(filenames, [metricexporter] { return metricexporter->getInstance(); }, CppOptions);
+    } else {   // logs
+        auto logexporter = std::static_pointer_cast<sdk::LogRecordExporterProxy>(exporterproxy);
+        async = logexporter->exportsAsynchronously();
+        result = replayLogFiles(filenames, [logexporter] { return logexporter->getInstance(); }, CppOptions);
+    }
+
+    matlab::data::ArrayFactory factory;
+    matlab::data::StructArray result_mda = factory.createStructArray({1, 1}, {"Records", "InvalidRecords",
+		    "FailedFiles", "Requests", "FailedRequests"});
+    result_mda[0]["Records"] = factory.createScalar(static_cast<double>(result.records));
+    result_mda[0]["InvalidRecords"] = factory.createScalar(static_cast<double>(result.invalid_records));
+    result_mda[0]["FailedFiles"] = factory.createScalar(static_cast<double>(result.failed_files));
+    result_mda[0]["Requests"] = factory.createScalar(static_cast<double>(result.batches));
+    // asynchronous exporters do not report failures, so the number of failed requests is unknown
+    result_mda[0]["FailedRequests"] = factory.createScalar(async ? std::numeric_limits<double>::quiet_NaN()
+            : static_cast<double>(result.failed_batches));
+    context.outputs[0] = result_mda;
+}
+} // namespace libmexclass::opentelemetry
@@ -1,7 +1,9 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/exporters/otlp/OtlpFileSpanExporterProxy.h"
 
+#include "opentelemetry-matlab/exporters/otlp/OtlpBinaryFileSpanExporter.h"
+
 #include "libmexclass/proxy/ProxyManager.h"
 
 #include "opentelemetry/exporters/otlp/otlp_file_exporter_factory.h"
@@ -17,6 +19,10 @@ libmexclass::proxy::MakeResult OtlpFileSpanExporterProxy::make(const libmexclass
 }
 
 std::unique_ptr<trace_sdk::SpanExporter> OtlpFileSpanExporterProxy::getInstance() {
+    if (Binary) {
+        return std::make_unique<OtlpBinaryFileSpanExporter>(
+		nostd::get<otlp_exporter::OtlpFileClientFileSystemOptions>(CppOptions.backend_options));
+    }
     return otlp_exporter::OtlpFileExporterFactory::Create(CppOptions);
 }
 
@@ -68,4 +74,9 @@ void OtlpFileSpanExporterProxy::setMaxFileCount(libmexclass::proxy::method::Cont
     CppOptions.backend_options = options;
 }
 
+void OtlpFileSpanExporterProxy::setFormat(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray format_mda = context.inputs[0];
+    Binary = (static_cast<std::string>(format_mda[0]).compare("binary") == 0);
+}
+
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,55 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpGrpcSharedClient.h"
+
+#include "opentelemetry/exporters/otlp/otlp_grpc_client_factory.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace libmexclass::opentelemetry::exporters {
+namespace {
+// options that are used to create the channel, requests sent over a shared channel still use
+// the timeout and headers of their own exporter
+std::string channelKey(const otlp_exporter::OtlpGrpcClientOptions& options) {
+    std::string key = options.endpoint;
+    key += '\0';
+    key += options.use_ssl_credentials ? '1' : '0';
+    key += options.ssl_credentials_cacert_path;
+    key += '\0';
+    key += options.ssl_credentials_cacert_as_string;
+    key += '\0';
+    key += options.compression;
+#ifdef ENABLE_ASYNC_EXPORT
+    key += '\0';
+    key += std::to_string(options.max_concurrent_requests);
+#endif
+    return key;
+}
+} // namespace
+
+std::shared_ptr<otlp_exporter::OtlpGrpcClient> getSharedGrpcClient(const otlp_exporter::OtlpGrpcClientOptions& options) {
+    static std::mutex clientsmutex;
+    static std::unordered_map<std::string, std::weak_ptr<otlp_exporter::OtlpGrpcClient> > clients;
+
+    std::lock_guard<std::mutex> lock(clientsmutex);
+    // forget clients whose exporters have all been destroyed
+    for (auto it = clients.begin(); it != clients.end();) {
+        it = it->second.expired() ? clients.erase(it) : std::next(it);
+    }
+
+    std::string key = channelKey(options);
+    auto found = clients.find(key);
+    if (found != clients.end()) {
+        std::shared_ptr<otlp_exporter::OtlpGrpcClient> client = found->second.lock();
+        // a client is shut down once all exporters using it have been shut down
+        if (client && !client->IsShutdown()) {
+            return client;
+        }
+    }
+    std::shared_ptr<otlp_exporter::OtlpGrpcClient> client = otlp_exporter::OtlpGrpcClientFactory::Create(options);
+    clients[key] = client;
+    return client;
+}
+} // namespace libmexclass::opentelemetry
@@ -1,6 +1,7 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/exporters/otlp/OtlpGrpcSpanExporterProxy.h"
+#include "opentelemetry-matlab/exporters/otlp/OtlpGrpcSharedClient.h"
 
 #include "libmexclass/proxy/ProxyManager.h"
 
@@ -15,6 +16,9 @@ libmexclass::proxy::MakeResult OtlpGrpcSpanExporterProxy::make(const libmexclass
 }
 
 std::unique_ptr<trace_sdk::SpanExporter> OtlpGrpcSpanExporterProxy::getInstance() {
+    if (SharedClient) {
+        return otlp_exporter::OtlpGrpcExporterFactory::Create(CppOptions, getSharedGrpcClient(CppOptions));
+    }
     return otlp_exporter::OtlpGrpcExporterFactory::Create(CppOptions);
 }
 
@@ -69,4 +73,34 @@ void OtlpGrpcSpanExporterProxy::setHttpHeaders(libmexclass::proxy::method::Conte
                                 static_cast<std::string>(headervalues_mda[i])});
     }
 }
+
+void OtlpGrpcSpanExporterProxy::setCompression(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray compression_mda = context.inputs[0];
+    CppOptions.compression = static_cast<std::string>(compression_mda[0]);
+}
+
+bool OtlpGrpcSpanExporterProxy::exportsAsynchronously() const {
+#ifdef ENABLE_ASYNC_EXPORT
+    return true;
+#else
+    return false;
+#endif
+}
+
+void OtlpGrpcSpanExporterProxy::setMaxConcurrentRequests(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+#ifdef ENABLE_ASYNC_EXPORT
+    matlab::data::TypedArray<double> maxrequests_mda = context.inputs[0];
+    CppOptions.max_concurrent_requests = static_cast<std::size_t>(maxrequests_mda[0]);
+    context.outputs[0] = factory.createScalar(true);
+#else
+    // the option needs asynchronous export, so report that it is not supported
+    context.outputs[0] = factory.createScalar(false);
+#endif
+}
+
+void OtlpGrpcSpanExporterProxy::setSharedClient(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<bool> sharedclient_mda = context.inputs[0];
+    SharedClient = sharedclient_mda[0];
+}
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/exporters/otlp/OtlpHttpLogRecordExporterProxy.h"
 
@@ -74,4 +74,41 @@ void OtlpHttpLogRecordExporterProxy::setHttpHeaders(libmexclass::proxy::method::
 				static_cast<std::string>(headervalues_mda[i])});
     }
 }
+
+void OtlpHttpLogRecordExporterProxy::setCompression(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray compression_mda = context.inputs[0];
+    CppOptions.compression = static_cast<std::string>(compression_mda[0]);
+}
+
+bool OtlpHttpLogRecordExporterProxy::exportsAsynchronously() const {
+#ifdef ENABLE_ASYNC_EXPORT
+    return true;
+#else
+    return false;
+#endif
+}
+
+void OtlpHttpLogRecordExporterProxy::setMaxConcurrentRequests(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+#ifdef ENABLE_ASYNC_EXPORT
+    matlab::data::TypedArray<double> maxrequests_mda = context.inputs[0];
+    CppOptions.max_concurrent_requests = static_cast<std::size_t>(maxrequests_mda[0]);
+    context.outputs[0] = factory.createScalar(true);
+#else
+    // the option needs asynchronous export, so report that it is not supported
+    context.outputs[0] = factory.createScalar(false);
+#endif
+}
+
+void OtlpHttpLogRecordExporterProxy::setMaxRequestsPerConnection(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+#ifdef ENABLE_ASYNC_EXPORT
+    matlab::data::TypedArray<double> maxrequests_mda = context.inputs[0];
+    CppOptions.max_requests_per_connection = static_cast<std::size_t>(maxrequests_mda[0]);
+    context.outputs[0] = factory.createScalar(true);
+#else
+    // the option needs asynchronous export, so report that it is not supported
+    context.outputs[0] = factory.createScalar(false);
+#endif
+}
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,85 @@
+classdef ParquetLogRecordExporter < opentelemetry.sdk.logs.LogRecordExporter
+% ParquetLogRecordExporter writes log records to a Parquet file, with one
+% row per log record, so that they can be analyzed as a table. 
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        FileName (1,1) string = "logs.parquet"       % Output file name
+        MaxRowGroupSize (1,1) double = 65536         % Maximum number of log records in a row group
+        FlushInterval (1,1) duration = seconds(30)   % Maximum time before a row group is written
+    end
+
+    properties (Access=private, Constant)
+        Validator = opentelemetry.exporters.parquet.ParquetValidator
+    end
+
+    methods
+        function obj = ParquetLogRecordExporter(optionnames, optionvalues)
+            % ParquetLogRecordExporter writes log records to a Parquet
+            % file.
+            %    EXP = OPENTELEMETRY.EXPORTERS.PARQUET.PARQUETLOGRECORDEXPORTER
+            %    creates an exporter that uses default configurations.
+            %
+            %    EXP =
+            %    OPENTELEMETRY.EXPORTERS.PARQUET.PARQUETLOGRECORDEXPORTER(PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter 
+            %    name/value pairs. Parameters are:
+            %       "FileName"          - Output file name. Default name is
+            %                             "logs.parquet"
+            %       "MaxRowGroupSize"   - Maximum number of log records in
+            %                             a row group. Default is 65536.
+            %       "FlushInterval"     - Maximum time since the last row
+            %                             group before the exported log
+            %                             records are written as a row
+            %                             group,
+            %                             represented as a duration.
+            %                             Default is 30 seconds.
+            %
+            %    The file has columns timestamp, observed_timestamp,
+            %    severity_number, severity_text, body, trace_id, span_id,
+            %    scope_name, scope_version, attribute_keys,
+            %    attribute_values, resource_attribute_keys, and
+            %    resource_attribute_values. IDs are hexadecimal text, and
+            %    the body and attribute values are converted to text. The
+            %    file can be read using parquetread after the logger
+            %    provider is shut down.
+            %
+            %    See also PARQUETREAD,
+            %    OPENTELEMETRY.EXPORTERS.PARQUET.PARQUETSPANEXPORTER,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILELOGRECORDEXPORTER
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            obj = obj@opentelemetry.sdk.logs.LogRecordExporter(...
+                "libmexclass.opentelemetry.exporters.ParquetLogRecordExporterProxy");
+
+            validnames = ["FileName", "MaxRowGroupSize", "FlushInterval"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function obj = set.FileName(obj, fn)
+            fn = obj.Validator.validateFileName(fn);
+            obj.Proxy.setFileName(fn);
+            obj.FileName = fn;
+        end
+
+        function obj = set.MaxRowGroupSize(obj, rowgroupsize)
+            rowgroupsize = obj.Validator.validateMaxRowGroupSize(rowgroupsize);
+            obj.Proxy.setMaxRowGroupSize(rowgroupsize);
+            obj.MaxRowGroupSize = rowgroupsize;
+        end
+
+        function obj = set.FlushInterval(obj, interval)
+            obj.Validator.validateFlushInterval(interval);
+            obj.Proxy.setFlushInterval(milliseconds(interval));
+            obj.FlushInterval = interval;
+        end
+    end
+end
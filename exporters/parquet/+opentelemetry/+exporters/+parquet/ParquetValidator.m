@@ -0,0 +1,32 @@
+classdef ParquetValidator
+% ParquetValidator   Validate options inputs for ParquetSpanExporter and
+% ParquetLogRecordExporter
+
+% Copyright 2026 The MathWorks, Inc.
+
+    methods (Static)
+        function fn = validateFileName(fn)
+            if ~(isStringScalar(fn) || (ischar(fn) && isrow(fn)))
+                error("opentelemetry:exporters:parquet:ParquetValidator:FileNameNotScalarText", ...
+                    "FileName must be a scalar string or a char row.");
+            end
+            fn = string(fn);
+        end
+
+        function value = validateMaxRowGroupSize(value)
+            if ~((islogical(value) || isnumeric(value)) && isscalar(value) && ...
+                    value > 0 && round(value) == value)
+                error("opentelemetry:exporters:parquet:ParquetValidator:MaxRowGroupSizeNotScalarPositiveInteger", ...
+                    "MaxRowGroupSize must be a scalar positive integer.")
+            end
+            value = double(value);
+        end
+
+        function validateFlushInterval(interval)
+            if ~(isduration(interval) && isscalar(interval) && interval > 0)
+                error("opentelemetry:exporters:parquet:ParquetValidator:FlushIntervalNotPositiveDuration", ...
+                    "FlushInterval must be a positive scalar duration.");
+            end
+        end
+    end
+end
@@ -0,0 +1,54 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <arrow/api.h>
+
+#include "opentelemetry/sdk/resource/resource.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/common/v1/common.pb.h"
+#include "opentelemetry/proto/resource/v1/resource.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace resource = opentelemetry::sdk::resource;
+
+namespace libmexclass::opentelemetry::exporters {
+
+using ProtoKeyValues = google::protobuf::RepeatedPtrField< ::opentelemetry::proto::common::v1::KeyValue>;
+
+// Text form of an attribute value. Strings are returned as they are, and arrays and key-value
+// lists are written in JSON notation.
+std::string anyValueToString(const ::opentelemetry::proto::common::v1::AnyValue& value);
+
+// Append a trace or span ID as hexadecimal text, or a null if the ID is empty or all zeros
+arrow::Status appendId(arrow::StringBuilder* builder, const std::string& bytes);
+
+// Append nanoseconds since the epoch, or a null if the time is not set
+arrow::Status appendTimestamp(arrow::TimestampBuilder* builder, uint64_t nanoseconds);
+
+// Append attributes as two list entries, one holding the keys and one holding the values as text
+arrow::Status appendAttributes(arrow::ListBuilder* keys, arrow::ListBuilder* values,
+		const ProtoKeyValues& attributes);
+
+// Resource attributes converted to OTLP once per resource, since all records from a provider
+// share the same resource. Entries are found by address and checked against the attributes they
+// were converted from, so a new resource at the address of a freed one is converted again.
+// Not thread-safe.
+class ResourceAttributeCache {
+  public:
+    const ProtoKeyValues& get(const resource::Resource& res);
+
+  private:
+    struct Entry {
+        resource::ResourceAttributes Attributes;
+        ::opentelemetry::proto::resource::v1::Resource Converted;
+    };
+
+    std::unordered_map<const resource::Resource*, Entry> Cache;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,40 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetColumns.h"
+#include "opentelemetry-matlab/exporters/parquet/ParquetTableWriter.h"
+
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Log record exporter that writes one row per log record to a Parquet file, for analysis as a
+// table. IDs are written as hexadecimal text, and the body and attribute values are converted
+// to text.
+class ParquetLogRecordExporter : public logs_sdk::LogRecordExporter {
+  public:
+    explicit ParquetLogRecordExporter(const ParquetWriterOptions& options);
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    ParquetTableWriter Writer;
+    ResourceAttributeCache Resources;   // only used from the callback of Writer.append, which holds its lock
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,37 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+#include "opentelemetry-matlab/exporters/parquet/ParquetTableWriter.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/logs/exporter.h"
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::exporters {
+class ParquetLogRecordExporterProxy: public libmexclass::opentelemetry::sdk::LogRecordExporterProxy {
+  public:
+    ParquetLogRecordExporterProxy(ParquetWriterOptions options) : CppOptions(options) {
+        REGISTER_METHOD(ParquetLogRecordExporterProxy, setFileName);
+        REGISTER_METHOD(ParquetLogRecordExporterProxy, setMaxRowGroupSize);
+        REGISTER_METHOD(ParquetLogRecordExporterProxy, setFlushInterval);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<logs_sdk::LogRecordExporter> getInstance() override;
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+    void setMaxRowGroupSize(libmexclass::proxy::method::Context& context);
+
+    void setFlushInterval(libmexclass::proxy::method::Context& context);
+
+  private:
+    ParquetWriterOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry
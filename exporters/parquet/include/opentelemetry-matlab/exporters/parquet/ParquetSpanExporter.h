@@ -0,0 +1,40 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetColumns.h"
+#include "opentelemetry-matlab/exporters/parquet/ParquetTableWriter.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Span exporter that writes one row per span to a Parquet file, for analysis as a table.
+// IDs are written as hexadecimal text, and attributes as lists of keys and lists of values
+// converted to text.
+class ParquetSpanExporter : public trace_sdk::SpanExporter {
+  public:
+    explicit ParquetSpanExporter(const ParquetWriterOptions& options);
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    ParquetTableWriter Writer;
+    ResourceAttributeCache Resources;   // only used from the callback of Writer.append, which holds its lock
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,37 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+#include "opentelemetry-matlab/exporters/parquet/ParquetTableWriter.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::exporters {
+class ParquetSpanExporterProxy: public libmexclass::opentelemetry::sdk::SpanExporterProxy {
+  public:
+    ParquetSpanExporterProxy(ParquetWriterOptions options) : CppOptions(options) {
+        REGISTER_METHOD(ParquetSpanExporterProxy, setFileName);
+        REGISTER_METHOD(ParquetSpanExporterProxy, setMaxRowGroupSize);
+        REGISTER_METHOD(ParquetSpanExporterProxy, setFlushInterval);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+    void setMaxRowGroupSize(libmexclass::proxy::method::Context& context);
+
+    void setFlushInterval(libmexclass::proxy::method::Context& context);
+
+  private:
+    ParquetWriterOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,70 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <arrow/api.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libmexclass::opentelemetry::exporters {
+
+struct ParquetWriterOptions {
+    std::string file_name;
+    size_t max_row_group_size = 65536;                                   // rows per row group
+    std::chrono::milliseconds flush_interval = std::chrono::milliseconds(30000);  // maximum age of a row group
+};
+
+// Writes rows to a Parquet file. Rows are collected in Arrow builders and written out as a row
+// group when the row group is full, or by a background thread once the flush interval has elapsed
+// since the last row group, even if no more rows are appended. Columns
+// are dictionary encoded, except the ones listed as plain columns, which are expected to have
+// mostly distinct values. The file footer is written on close, so the file can only be read
+// after the writer is closed.
+class ParquetTableWriter {
+  public:
+    // Append rows by adding one value to every column of the record batch builder
+    using FillFunction = std::function<arrow::Status(arrow::RecordBatchBuilder&)>;
+
+    ParquetTableWriter(std::shared_ptr<arrow::Schema> schema, const std::vector<std::string>& plaincolumns,
+		    const ParquetWriterOptions& options);
+
+    ~ParquetTableWriter();
+
+    ParquetTableWriter(const ParquetTableWriter&) = delete;
+    ParquetTableWriter& operator=(const ParquetTableWriter&) = delete;
+
+    bool append(const FillFunction& fill);
+
+    // write the pending rows as a row group
+    bool flush();
+
+    void close();
+
+  private:
+    bool writeRowGroup();
+
+    // run by FlushThread, writes pending rows once they are older than the flush interval
+    void flushPeriodically();
+
+    int64_t pendingRows() const;
+
+    const ParquetWriterOptions Options;
+    std::shared_ptr<arrow::Schema> Schema;
+    std::mutex Mutex;
+    std::unique_ptr<arrow::RecordBatchBuilder> Builder;
+    std::unique_ptr<parquet::arrow::FileWriter> Writer;
+    std::chrono::steady_clock::time_point LastRowGroup;
+    bool Closed = false;
+    std::condition_variable FlushCondition;
+    std::thread FlushThread;
+};
+} // namespace libmexclass::opentelemetry
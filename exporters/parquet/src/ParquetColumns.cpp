@@ -0,0 +1,151 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetColumns.h"
+
+#include "opentelemetry/exporters/otlp/otlp_populate_attribute_utils.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_proto = ::opentelemetry::proto::common::v1;
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+std::string toHex(const std::string& bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (unsigned char c : bytes) {
+        hex.push_back(digits[c >> 4]);
+        hex.push_back(digits[c & 0xf]);
+    }
+    return hex;
+}
+
+void appendQuoted(std::string& out, const std::string& text) {
+    static const char digits[] = "0123456789abcdef";
+    out.push_back('"');
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '\r') {
+            out += "\\r";
+        } else if (c == '\t') {
+            out += "\\t";
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            // other control characters are not allowed in JSON strings
+            out += "\\u00";
+            out.push_back(digits[c >> 4]);
+            out.push_back(digits[c & 0xf]);
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+void appendJson(std::string& out, const common_proto::AnyValue& value) {
+    if (value.has_string_value()) {
+        appendQuoted(out, value.string_value());
+    } else if (value.has_bytes_value()) {
+        appendQuoted(out, toHex(value.bytes_value()));
+    } else if (value.has_array_value()) {
+        out.push_back('[');
+        for (int i = 0; i < value.array_value().values_size(); ++i) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            appendJson(out, value.array_value().values(i));
+        }
+        out.push_back(']');
+    } else if (value.has_kvlist_value()) {
+        out.push_back('{');
+        for (int i = 0; i < value.kvlist_value().values_size(); ++i) {
+            const auto& kv = value.kvlist_value().values(i);
+            if (i > 0) {
+                out.push_back(',');
+            }
+            appendQuoted(out, kv.key());
+            out.push_back(':');
+            appendJson(out, kv.value());
+        }
+        out.push_back('}');
+    } else if (value.value_case() == common_proto::AnyValue::VALUE_NOT_SET) {
+        out += "null";
+    } else {
+        out += anyValueToString(value);
+    }
+}
+} // namespace
+
+std::string anyValueToString(const common_proto::AnyValue& value) {
+    switch (value.value_case()) {
+        case common_proto::AnyValue::kStringValue:
+            return value.string_value();
+        case common_proto::AnyValue::kBoolValue:
+            return value.bool_value() ? "true" : "false";
+        case common_proto::AnyValue::kIntValue:
+            return std::to_string(value.int_value());
+        case common_proto::AnyValue::kDoubleValue: {
+            // shortest text that reads back to the same double
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value.double_value());
+            return std::string(buffer, result.ptr);
+        }
+        case common_proto::AnyValue::kBytesValue:
+            return toHex(value.bytes_value());
+        case common_proto::AnyValue::VALUE_NOT_SET:
+            return std::string();
+        default: {
+            std::string out;
+            appendJson(out, value);
+            return out;
+        }
+    }
+}
+
+arrow::Status appendId(arrow::StringBuilder* builder, const std::string& bytes) {
+    if (std::all_of(bytes.begin(), bytes.end(), [](char c) { return c == 0; })) {
+        return builder->AppendNull();
+    }
+    return builder->Append(toHex(bytes));
+}
+
+arrow::Status appendTimestamp(arrow::TimestampBuilder* builder, uint64_t nanoseconds) {
+    if (nanoseconds == 0) {
+        return builder->AppendNull();
+    }
+    return builder->Append(static_cast<int64_t>(nanoseconds));
+}
+
+arrow::Status appendAttributes(arrow::ListBuilder* keys, arrow::ListBuilder* values,
+		const ProtoKeyValues& attributes) {
+    auto keybuilder = static_cast<arrow::StringBuilder*>(keys->value_builder());
+    auto valuebuilder = static_cast<arrow::StringBuilder*>(values->value_builder());
+    ARROW_RETURN_NOT_OK(keys->Append());
+    ARROW_RETURN_NOT_OK(values->Append());
+    for (const auto& kv : attributes) {
+        ARROW_RETURN_NOT_OK(keybuilder->Append(kv.key()));
+        ARROW_RETURN_NOT_OK(valuebuilder->Append(anyValueToString(kv.value())));
+    }
+    return arrow::Status::OK();
+}
+
+const ProtoKeyValues& ResourceAttributeCache::get(const resource::Resource& res) {
+    const resource::ResourceAttributes& attributes = res.GetAttributes();
+    auto found = Cache.find(&res);
+    if (found != Cache.end() && found->second.Attributes == attributes) {
+        return found->second.Converted.attributes();
+    }
+    Entry& entry = Cache[&res];
+    entry.Attributes = attributes;
+    entry.Converted.Clear();
+    otlp_exporter::OtlpPopulateAttributeUtils::PopulateAttribute(&entry.Converted, res);
+    return entry.Converted.attributes();
+}
+} // namespace libmexclass::opentelemetry
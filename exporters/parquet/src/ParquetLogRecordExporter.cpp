@@ -0,0 +1,89 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetLogRecordExporter.h"
+
+#include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace logs_proto = ::opentelemetry::proto::logs::v1;
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+enum Column {
+    Timestamp, ObservedTimestamp, SeverityNumber, SeverityText, Body, TraceId, SpanId,
+    ScopeName, ScopeVersion, AttributeKeys, AttributeValues, ResourceAttributeKeys, ResourceAttributeValues
+};
+
+std::shared_ptr<arrow::Schema> logSchema() {
+    auto timestamp = arrow::timestamp(arrow::TimeUnit::NANO, "UTC");
+    auto textlist = arrow::list(arrow::utf8());
+    return arrow::schema({
+        arrow::field("timestamp", timestamp),
+        arrow::field("observed_timestamp", timestamp),
+        arrow::field("severity_number", arrow::int32()),
+        arrow::field("severity_text", arrow::utf8()),
+        arrow::field("body", arrow::utf8()),
+        arrow::field("trace_id", arrow::utf8()),
+        arrow::field("span_id", arrow::utf8()),
+        arrow::field("scope_name", arrow::utf8()),
+        arrow::field("scope_version", arrow::utf8()),
+        arrow::field("attribute_keys", textlist),
+        arrow::field("attribute_values", textlist),
+        arrow::field("resource_attribute_keys", textlist),
+        arrow::field("resource_attribute_values", textlist)});
+}
+} // namespace
+
+ParquetLogRecordExporter::ParquetLogRecordExporter(const ParquetWriterOptions& options)
+	: Writer(logSchema(), {"timestamp", "observed_timestamp", "body", "trace_id", "span_id"}, options) {}
+
+std::unique_ptr<logs_sdk::Recordable> ParquetLogRecordExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<logs_sdk::Recordable>(new otlp_exporter::OtlpLogRecordable());
+}
+
+::opentelemetry::sdk::common::ExportResult ParquetLogRecordExporter::Export(
+		const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    bool ok = Writer.append([&](arrow::RecordBatchBuilder& batch) {
+        auto text = [&batch](int column) { return batch.GetFieldAs<arrow::StringBuilder>(column); };
+        auto time = [&batch](int column) { return batch.GetFieldAs<arrow::TimestampBuilder>(column); };
+        auto list = [&batch](int column) { return batch.GetFieldAs<arrow::ListBuilder>(column); };
+        for (const auto& recordable : records) {
+            auto otlprecord = static_cast<const otlp_exporter::OtlpLogRecordable*>(recordable.get());
+            const logs_proto::LogRecord& record = otlprecord->log_record();
+            ARROW_RETURN_NOT_OK(appendTimestamp(time(Timestamp), record.time_unix_nano()));
+            ARROW_RETURN_NOT_OK(appendTimestamp(time(ObservedTimestamp), record.observed_time_unix_nano()));
+            ARROW_RETURN_NOT_OK(batch.GetFieldAs<arrow::Int32Builder>(SeverityNumber)->Append(
+			    static_cast<int32_t>(record.severity_number())));
+            ARROW_RETURN_NOT_OK(text(SeverityText)->Append(record.severity_text()));
+            ARROW_RETURN_NOT_OK(text(Body)->Append(anyValueToString(record.body())));
+            ARROW_RETURN_NOT_OK(appendId(text(TraceId), record.trace_id()));
+            ARROW_RETURN_NOT_OK(appendId(text(SpanId), record.span_id()));
+
+            const auto& scope = otlprecord->GetInstrumentationScope();
+            ARROW_RETURN_NOT_OK(text(ScopeName)->Append(scope.GetName()));
+            ARROW_RETURN_NOT_OK(text(ScopeVersion)->Append(scope.GetVersion()));
+
+            ARROW_RETURN_NOT_OK(appendAttributes(list(AttributeKeys), list(AttributeValues), record.attributes()));
+            ARROW_RETURN_NOT_OK(appendAttributes(list(ResourceAttributeKeys), list(ResourceAttributeValues),
+			    Resources.get(otlprecord->GetResource())));
+        }
+        return arrow::Status::OK();
+    });
+    return ok ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool ParquetLogRecordExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    return Writer.flush();
+}
+
+bool ParquetLogRecordExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    Writer.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
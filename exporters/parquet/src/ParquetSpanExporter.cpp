@@ -0,0 +1,151 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetSpanExporter.h"
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace trace_proto = ::opentelemetry::proto::trace::v1;
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+enum Column {
+    TraceId, SpanId, ParentSpanId, Name, Kind, StartTime, EndTime, StatusCode, StatusMessage,
+    ScopeName, ScopeVersion, AttributeKeys, AttributeValues, EventNames, EventTimes,
+    LinkTraceIds, LinkSpanIds, ResourceAttributeKeys, ResourceAttributeValues
+};
+
+std::shared_ptr<arrow::Schema> spanSchema() {
+    auto timestamp = arrow::timestamp(arrow::TimeUnit::NANO, "UTC");
+    auto textlist = arrow::list(arrow::utf8());
+    return arrow::schema({
+        arrow::field("trace_id", arrow::utf8()),
+        arrow::field("span_id", arrow::utf8()),
+        arrow::field("parent_span_id", arrow::utf8()),
+        arrow::field("name", arrow::utf8()),
+        arrow::field("kind", arrow::utf8()),
+        arrow::field("start_time", timestamp),
+        arrow::field("end_time", timestamp),
+        arrow::field("status_code", arrow::utf8()),
+        arrow::field("status_message", arrow::utf8()),
+        arrow::field("scope_name", arrow::utf8()),
+        arrow::field("scope_version", arrow::utf8()),
+        arrow::field("attribute_keys", textlist),
+        arrow::field("attribute_values", textlist),
+        arrow::field("event_names", textlist),
+        arrow::field("event_times", arrow::list(timestamp)),
+        arrow::field("link_trace_ids", textlist),
+        arrow::field("link_span_ids", textlist),
+        arrow::field("resource_attribute_keys", textlist),
+        arrow::field("resource_attribute_values", textlist)});
+}
+
+const char* kindName(trace_proto::Span::SpanKind kind) {
+    switch (kind) {
+        case trace_proto::Span::SPAN_KIND_INTERNAL:
+            return "internal";
+        case trace_proto::Span::SPAN_KIND_SERVER:
+            return "server";
+        case trace_proto::Span::SPAN_KIND_CLIENT:
+            return "client";
+        case trace_proto::Span::SPAN_KIND_PRODUCER:
+            return "producer";
+        case trace_proto::Span::SPAN_KIND_CONSUMER:
+            return "consumer";
+        default:
+            return "unspecified";
+    }
+}
+
+const char* statusName(trace_proto::Status::StatusCode code) {
+    switch (code) {
+        case trace_proto::Status::STATUS_CODE_OK:
+            return "ok";
+        case trace_proto::Status::STATUS_CODE_ERROR:
+            return "error";
+        default:
+            return "unset";
+    }
+}
+} // namespace
+
+ParquetSpanExporter::ParquetSpanExporter(const ParquetWriterOptions& options)
+	: Writer(spanSchema(), {"trace_id", "span_id", "parent_span_id", "start_time", "end_time",
+	       "event_times.list.element", "link_trace_ids.list.element", "link_span_ids.list.element"}, options) {}
+
+std::unique_ptr<trace_sdk::Recordable> ParquetSpanExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new otlp_exporter::OtlpRecordable());
+}
+
+::opentelemetry::sdk::common::ExportResult ParquetSpanExporter::Export(
+		const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    bool ok = Writer.append([&](arrow::RecordBatchBuilder& batch) {
+        auto text = [&batch](int column) { return batch.GetFieldAs<arrow::StringBuilder>(column); };
+        auto time = [&batch](int column) { return batch.GetFieldAs<arrow::TimestampBuilder>(column); };
+        auto list = [&batch](int column) { return batch.GetFieldAs<arrow::ListBuilder>(column); };
+        for (const auto& recordable : spans) {
+            auto otlpspan = static_cast<const otlp_exporter::OtlpRecordable*>(recordable.get());
+            const trace_proto::Span& span = otlpspan->span();
+            ARROW_RETURN_NOT_OK(appendId(text(TraceId), span.trace_id()));
+            ARROW_RETURN_NOT_OK(appendId(text(SpanId), span.span_id()));
+            ARROW_RETURN_NOT_OK(appendId(text(ParentSpanId), span.parent_span_id()));
+            ARROW_RETURN_NOT_OK(text(Name)->Append(span.name()));
+            ARROW_RETURN_NOT_OK(text(Kind)->Append(kindName(span.kind())));
+            ARROW_RETURN_NOT_OK(appendTimestamp(time(StartTime), span.start_time_unix_nano()));
+            ARROW_RETURN_NOT_OK(appendTimestamp(time(EndTime), span.end_time_unix_nano()));
+            ARROW_RETURN_NOT_OK(text(StatusCode)->Append(statusName(span.status().code())));
+            ARROW_RETURN_NOT_OK(text(StatusMessage)->Append(span.status().message()));
+
+            auto scope = otlpspan->GetInstrumentationScope();
+            ARROW_RETURN_NOT_OK(text(ScopeName)->Append(scope ? scope->GetName() : std::string()));
+            ARROW_RETURN_NOT_OK(text(ScopeVersion)->Append(scope ? scope->GetVersion() : std::string()));
+
+            ARROW_RETURN_NOT_OK(appendAttributes(list(AttributeKeys), list(AttributeValues), span.attributes()));
+
+            ARROW_RETURN_NOT_OK(list(EventNames)->Append());
+            ARROW_RETURN_NOT_OK(list(EventTimes)->Append());
+            auto eventnames = static_cast<arrow::StringBuilder*>(list(EventNames)->value_builder());
+            auto eventtimes = static_cast<arrow::TimestampBuilder*>(list(EventTimes)->value_builder());
+            for (const auto& event : span.events()) {
+                ARROW_RETURN_NOT_OK(eventnames->Append(event.name()));
+                ARROW_RETURN_NOT_OK(appendTimestamp(eventtimes, event.time_unix_nano()));
+            }
+
+            ARROW_RETURN_NOT_OK(list(LinkTraceIds)->Append());
+            ARROW_RETURN_NOT_OK(list(LinkSpanIds)->Append());
+            auto linktraceids = static_cast<arrow::StringBuilder*>(list(LinkTraceIds)->value_builder());
+            auto linkspanids = static_cast<arrow::StringBuilder*>(list(LinkSpanIds)->value_builder());
+            for (const auto& link : span.links()) {
+                ARROW_RETURN_NOT_OK(appendId(linktraceids, link.trace_id()));
+                ARROW_RETURN_NOT_OK(appendId(linkspanids, link.span_id()));
+            }
+
+            const resource::Resource* res = otlpspan->GetResource();
+            if (res != nullptr) {
+                ARROW_RETURN_NOT_OK(appendAttributes(list(ResourceAttributeKeys),
+				list(ResourceAttributeValues), Resources.get(*res)));
+            } else {
+                ARROW_RETURN_NOT_OK(appendAttributes(list(ResourceAttributeKeys),
+				list(ResourceAttributeValues), ProtoKeyValues()));
+            }
+        }
+        return arrow::Status::OK();
+    });
+    return ok ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool ParquetSpanExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    return Writer.flush();
+}
+
+bool ParquetSpanExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    Writer.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
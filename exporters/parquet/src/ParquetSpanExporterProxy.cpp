@@ -0,0 +1,33 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetSpanExporterProxy.h"
+#include "opentelemetry-matlab/exporters/parquet/ParquetSpanExporter.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::exporters {
+libmexclass::proxy::MakeResult ParquetSpanExporterProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    ParquetWriterOptions options;
+    options.file_name = "trace.parquet";
+    return std::make_shared<ParquetSpanExporterProxy>(options);
+}
+
+std::unique_ptr<trace_sdk::SpanExporter> ParquetSpanExporterProxy::getInstance() {
+    return std::make_unique<ParquetSpanExporter>(CppOptions);
+}
+
+void ParquetSpanExporterProxy::setFileName(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filename_mda = context.inputs[0];
+    CppOptions.file_name = static_cast<std::string>(filename_mda[0]);
+}
+
+void ParquetSpanExporterProxy::setMaxRowGroupSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> rowgroupsize_mda = context.inputs[0];
+    CppOptions.max_row_group_size = static_cast<size_t>(rowgroupsize_mda[0]);
+}
+
+void ParquetSpanExporterProxy::setFlushInterval(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> flushinterval_mda = context.inputs[0];
+    CppOptions.flush_interval = std::chrono::milliseconds(static_cast<int64_t>(flushinterval_mda[0]));
+}
+} // namespace libmexclass::opentelemetry
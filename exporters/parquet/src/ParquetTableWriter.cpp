@@ -0,0 +1,135 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/parquet/ParquetTableWriter.h"
+
+#include <arrow/io/file.h>
+#include <arrow/util/compression.h>
+
+#include <algorithm>
+
+namespace libmexclass::opentelemetry::exporters {
+ParquetTableWriter::ParquetTableWriter(std::shared_ptr<arrow::Schema> schema,
+		const std::vector<std::string>& plaincolumns, const ParquetWriterOptions& options)
+	: Options(options), Schema(std::move(schema)), LastRowGroup(std::chrono::steady_clock::now()) {
+    auto builder = arrow::RecordBatchBuilder::Make(Schema, arrow::default_memory_pool());
+    if (!builder.ok()) {
+        Closed = true;
+        return;
+    }
+    Builder = std::move(builder).ValueUnsafe();
+
+    parquet::WriterProperties::Builder properties;
+    properties.enable_dictionary();
+    for (const auto& column : plaincolumns) {
+        properties.disable_dictionary(column);
+    }
+    if (arrow::util::Codec::IsAvailable(arrow::Compression::SNAPPY)) {
+        properties.compression(arrow::Compression::SNAPPY);
+    }
+    // keep the time zone of timestamp columns
+    auto arrowproperties = parquet::ArrowWriterProperties::Builder().store_schema()->build();
+
+    auto file = arrow::io::FileOutputStream::Open(Options.file_name);
+    if (!file.ok()) {
+        Closed = true;
+        return;
+    }
+    auto writer = parquet::arrow::FileWriter::Open(*Schema, arrow::default_memory_pool(), *file,
+		    properties.build(), arrowproperties);
+    if (!writer.ok()) {
+        Closed = true;
+        return;
+    }
+    Writer = std::move(writer).ValueUnsafe();
+    if (Options.flush_interval.count() > 0) {
+        FlushThread = std::thread(&ParquetTableWriter::flushPeriodically, this);
+    }
+}
+
+ParquetTableWriter::~ParquetTableWriter() {
+    close();
+}
+
+int64_t ParquetTableWriter::pendingRows() const {
+    return Builder->num_fields() > 0 ? Builder->GetField(0)->length() : 0;
+}
+
+bool ParquetTableWriter::append(const FillFunction& fill) {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Closed) {
+        return false;
+    }
+    bool wasempty = pendingRows() == 0;
+    if (!fill(*Builder).ok()) {
+        // columns may be left with different lengths, drop the pending rows
+        (void)Builder->Flush();
+        return false;
+    }
+    if (pendingRows() >= static_cast<int64_t>(Options.max_row_group_size)) {
+        return writeRowGroup();
+    }
+    if (wasempty) {
+        FlushCondition.notify_all();   // start timing the new row group
+    }
+    return true;
+}
+
+bool ParquetTableWriter::writeRowGroup() {
+    LastRowGroup = std::chrono::steady_clock::now();
+    if (pendingRows() == 0) {
+        return true;
+    }
+    auto batch = Builder->Flush();
+    if (!batch.ok()) {
+        return false;
+    }
+    auto table = arrow::Table::FromRecordBatches(Schema, {*batch});
+    if (!table.ok()) {
+        return false;
+    }
+    // every call writes at least one new row group
+    return Writer->WriteTable(**table, (*table)->num_rows()).ok();
+}
+
+bool ParquetTableWriter::flush() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Closed) {
+        return false;
+    }
+    return writeRowGroup();
+}
+
+void ParquetTableWriter::flushPeriodically() {
+    // bound each wait so that very long intervals do not overflow the clock
+    std::chrono::microseconds interval = (std::min)(
+        std::chrono::duration_cast<std::chrono::microseconds>(Options.flush_interval),
+        std::chrono::microseconds(std::chrono::hours(1)));
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (!Closed) {
+        if (pendingRows() == 0) {
+            FlushCondition.wait(lock);   // woken by the first row after a row group, or by close
+        } else if (FlushCondition.wait_until(lock, LastRowGroup + interval) == std::cv_status::timeout) {
+            if (!Closed && pendingRows() > 0
+                    && std::chrono::steady_clock::now() - LastRowGroup >= Options.flush_interval) {
+                writeRowGroup();
+            }
+        }
+    }
+}
+
+void ParquetTableWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (!Closed) {
+            Closed = true;
+            writeRowGroup();
+            // write the footer
+            (void)Writer->Close();
+        }
+    }
+    FlushCondition.notify_all();
+    if (FlushThread.joinable()) {
+        FlushThread.join();
+    }
+}
+} // namespace libmexclass::opentelemetry
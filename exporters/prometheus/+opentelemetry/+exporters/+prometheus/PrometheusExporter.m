@@ -0,0 +1,71 @@
+classdef PrometheusExporter < opentelemetry.sdk.metrics.MetricReader
+% Prometheus exporter serves metrics on a local port, in the Prometheus
+% text format, for a Prometheus server to scrape.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        Host (1,1) string   % Host name or address the endpoint listens on
+        Port (1,1) double   % Port the endpoint listens on
+    end
+
+    methods
+        function obj = PrometheusExporter(optionnames, optionvalues)
+            % Prometheus exporter serves metrics on a local port.
+            %    R = OPENTELEMETRY.EXPORTERS.PROMETHEUS.PROMETHEUSEXPORTER
+            %    creates a metric reader that serves metrics at
+            %    http://localhost:9464/metrics.
+            %
+            %    R = OPENTELEMETRY.EXPORTERS.PROMETHEUS.PROMETHEUSEXPORTER(
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "Host"    - Host name or address to listen on. Use
+            %                   "0.0.0.0" to accept scrapes from other
+            %                   machines. Default is "localhost".
+            %       "Port"    - Port to listen on. If 0, an unused port is
+            %                   chosen, and can be found from the Port
+            %                   property. Default is 9464.
+            %
+            %    Unlike other metric readers, the Prometheus exporter
+            %    collects metrics only when its endpoint is scraped, so
+            %    nothing is collected between scrapes. Metrics are served
+            %    with cumulative aggregation temporality. Monotonic sums
+            %    become counters with a "_total" suffix, other sums and
+            %    gauges become gauges, and histograms become histograms.
+            %
+            %    See also OPENTELEMETRY.SDK.METRICS.METERPROVIDER,
+            %    OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            host = "localhost";
+            port = 9464;
+            validnames = ["Host", "Port"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                if strcmp(namei, "Host")
+                    if ~(isStringScalar(valuei) || (ischar(valuei) && isrow(valuei)))
+                        error("opentelemetry:exporters:prometheus:PrometheusExporter:HostNotScalarText", ...
+                            "Host must be a scalar string.");
+                    end
+                    host = string(valuei);
+                else   % Port
+                    if ~(isnumeric(valuei) && isscalar(valuei) && valuei >= 0 && ...
+                            valuei <= 65535 && round(valuei) == valuei)
+                        error("opentelemetry:exporters:prometheus:PrometheusExporter:InvalidPort", ...
+                            "Port must be an integer between 0 and 65535.");
+                    end
+                    port = double(valuei);
+                end
+            end
+
+            obj.Proxy = libmexclass.proxy.Proxy("Name", "libmexclass.opentelemetry.exporters.PrometheusExporterProxy" , ...
+                "ConstructorArguments", {host, port});
+            obj.Host = host;
+            obj.Port = obj.Proxy.getPort();
+        end
+    end
+end
@@ -0,0 +1,37 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusServer.h"
+
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+
+#include <chrono>
+#include <memory>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Pull-based metric reader that collects metrics only when a Prometheus server scrapes its
+// endpoint, and answers with the text exposition format. Prometheus expects cumulative values.
+class PrometheusExporter : public metric_sdk::MetricReader {
+  public:
+    PrometheusExporter(std::shared_ptr<PrometheusServer> server);
+
+    ~PrometheusExporter() override;
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+		    metric_sdk::InstrumentType instrument_type) const noexcept override;
+
+  private:
+    void OnInitialized() noexcept override;
+
+    bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
+
+    bool OnShutDown(std::chrono::microseconds timeout) noexcept override;
+
+    std::shared_ptr<PrometheusServer> Server;
+};
+} // namespace libmexclass::opentelemetry::exporters
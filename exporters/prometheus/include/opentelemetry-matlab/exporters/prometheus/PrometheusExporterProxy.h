@@ -0,0 +1,31 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/metrics/MetricReaderProxy.h"
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusServer.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::exporters {
+class PrometheusExporterProxy: public libmexclass::opentelemetry::sdk::MetricReaderProxy {
+  public:
+    PrometheusExporterProxy(std::shared_ptr<PrometheusServer> server) : Server(std::move(server)) {
+        REGISTER_METHOD(PrometheusExporterProxy, getPort);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::shared_ptr<metric_sdk::MetricReader> getInstance() override;
+
+    void getPort(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::shared_ptr<PrometheusServer> Server;
+};
+} // namespace libmexclass::opentelemetry::exporters
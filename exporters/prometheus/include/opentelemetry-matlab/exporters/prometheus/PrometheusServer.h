@@ -0,0 +1,57 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Minimal HTTP server that answers GET requests for /metrics on a single background thread. The
+// thread blocks in accept between scrapes, and the response body is rendered into a buffer that
+// is reused across scrapes, so nothing is done between scrapes.
+class PrometheusServer {
+  public:
+    // Append the response body
+    using RenderFunction = std::function<void(std::string&)>;
+
+    // Listen on host and port, or on an unused port if port is 0. Returns null and sets error if
+    // the address cannot be bound.
+    static std::shared_ptr<PrometheusServer> create(const std::string& host, uint16_t port, std::string& error);
+
+    ~PrometheusServer();
+
+    PrometheusServer(const PrometheusServer&) = delete;
+    PrometheusServer& operator=(const PrometheusServer&) = delete;
+
+    uint16_t port() const {
+        return Port;
+    }
+
+    // Set the function that renders scrapes, or clear it to answer with 503 Service Unavailable.
+    // Returns after any scrape in progress.
+    void setRenderer(RenderFunction render);
+
+  private:
+    using Socket = intptr_t;
+
+    PrometheusServer(Socket listener, uint16_t port);
+
+    void run();
+
+    void serve(Socket client);
+
+    Socket Listener;
+    uint16_t Port;
+    std::string Buffer;         // response body, reused across scrapes
+    RenderFunction Render;
+    std::mutex RenderMutex;     // held while rendering
+    std::atomic<bool> Stopping{false};
+    std::thread Worker;
+};
+} // namespace libmexclass::opentelemetry::exporters
@@ -0,0 +1,19 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+
+#include <string>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::exporters {
+
+// Append cumulative metrics in the Prometheus text exposition format, version 0.0.4. Monotonic
+// sums become counters, other sums and last values become gauges, and histograms become
+// histograms. Resource attributes are exposed as the labels of a target_info gauge, and the name
+// and version of each meter as the otel_scope_name and otel_scope_version labels. Units are
+// appended to metric names in Prometheus form, such as _milliseconds for "ms".
+void appendPrometheusText(std::string& out, const metric_sdk::ResourceMetrics& data);
+} // namespace libmexclass::opentelemetry::exporters
@@ -0,0 +1,37 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusExporter.h"
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusText.h"
+
+namespace libmexclass::opentelemetry::exporters {
+PrometheusExporter::PrometheusExporter(std::shared_ptr<PrometheusServer> server) : Server(std::move(server)) {}
+
+PrometheusExporter::~PrometheusExporter() {
+    // the renderer refers to this reader
+    Server->setRenderer(nullptr);
+}
+
+metric_sdk::AggregationTemporality PrometheusExporter::GetAggregationTemporality(
+		metric_sdk::InstrumentType instrument_type) const noexcept {
+    return metric_sdk::AggregationTemporality::kCumulative;
+}
+
+void PrometheusExporter::OnInitialized() noexcept {
+    // scrapes are answered once the reader is attached to a meter provider
+    Server->setRenderer([this](std::string& out) {
+        Collect([&out](metric_sdk::ResourceMetrics& data) {
+            appendPrometheusText(out, data);
+            return true;
+        });
+    });
+}
+
+bool PrometheusExporter::OnForceFlush(std::chrono::microseconds timeout) noexcept {
+    return true;   // nothing is buffered between scrapes
+}
+
+bool PrometheusExporter::OnShutDown(std::chrono::microseconds timeout) noexcept {
+    Server->setRenderer(nullptr);
+    return true;
+}
+} // namespace libmexclass::opentelemetry::exporters
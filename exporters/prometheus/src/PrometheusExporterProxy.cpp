@@ -0,0 +1,29 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusExporterProxy.h"
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusExporter.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::exporters {
+libmexclass::proxy::MakeResult PrometheusExporterProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::StringArray host_mda = constructor_arguments[0];
+    matlab::data::TypedArray<double> port_mda = constructor_arguments[1];
+    std::string host = static_cast<std::string>(host_mda[0]);
+    std::string error;
+    auto server = PrometheusServer::create(host, static_cast<uint16_t>(port_mda[0]), error);
+    if (server == nullptr) {
+        return libmexclass::error::Error{"opentelemetry:exporters:prometheus:PrometheusExporter:ListenFailed", error};
+    }
+    return std::make_shared<PrometheusExporterProxy>(std::move(server));
+}
+
+std::shared_ptr<metric_sdk::MetricReader> PrometheusExporterProxy::getInstance() {
+    return std::make_shared<PrometheusExporter>(Server);
+}
+
+void PrometheusExporterProxy::getPort(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+    context.outputs[0] = factory.createScalar(static_cast<double>(Server->port()));
+}
+} // namespace libmexclass::opentelemetry::exporters
@@ -0,0 +1,251 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusServer.h"
+
+#include <chrono>
+#include <cstring>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+#ifdef _WIN32
+const intptr_t InvalidSocket = static_cast<intptr_t>(INVALID_SOCKET);
+
+const int ShutdownBoth = SD_BOTH;
+
+void closeSocket(intptr_t s) {
+    closesocket(static_cast<SOCKET>(s));
+}
+#else
+const intptr_t InvalidSocket = -1;
+const int ShutdownBoth = SHUT_RDWR;
+
+void closeSocket(intptr_t s) {
+    close(static_cast<int>(s));
+}
+#endif
+
+const size_t MaxRequestSize = 8192;
+
+// time allowed for a client to send its request, and for each send of the response, so that a
+// slow client cannot hold up the single server thread
+const long RequestTimeoutMilliseconds = 5000;
+
+// set SO_RCVTIMEO or SO_SNDTIMEO, so that a blocking recv or send fails after the timeout
+void setTimeout(intptr_t s, int option, long milliseconds) {
+#ifdef _WIN32
+    DWORD timeout = static_cast<DWORD>(milliseconds);
+    setsockopt(static_cast<SOCKET>(s), SOL_SOCKET, option, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+#else
+    timeval timeout;
+    timeout.tv_sec = milliseconds / 1000;
+    timeout.tv_usec = (milliseconds % 1000) * 1000;
+    setsockopt(static_cast<int>(s), SOL_SOCKET, option, &timeout, sizeof(timeout));
+#endif
+}
+
+// Connect to a listening socket, so that a thread blocked in accept on it returns
+void connectToListener(intptr_t listener) {
+    sockaddr_storage address;
+    socklen_t size = sizeof(address);
+    if (getsockname(listener, reinterpret_cast<sockaddr*>(&address), &size) != 0) {
+        return;
+    }
+    // a listener bound to all interfaces is reached through the loopback interface
+    if (address.ss_family == AF_INET6) {
+        auto* address6 = reinterpret_cast<sockaddr_in6*>(&address);
+        if (IN6_IS_ADDR_UNSPECIFIED(&address6->sin6_addr)) {
+            std::memset(&address6->sin6_addr, 0, sizeof(address6->sin6_addr));
+            address6->sin6_addr.s6_addr[15] = 1;    // ::1
+        }
+    } else {
+        auto* address4 = reinterpret_cast<sockaddr_in*>(&address);
+        if (address4->sin_addr.s_addr == htonl(INADDR_ANY)) {
+            address4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        }
+    }
+    intptr_t s = static_cast<intptr_t>(socket(address.ss_family, SOCK_STREAM, 0));
+    if (s == InvalidSocket) {
+        return;
+    }
+    connect(s, reinterpret_cast<sockaddr*>(&address), size);
+    closeSocket(s);
+}
+
+bool sendAll(intptr_t s, const char* data, size_t size) {
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;    // a closed connection should not raise SIGPIPE
+#else
+    const int flags = 0;
+#endif
+    while (size > 0) {
+        auto sent = send(s, data, static_cast<int>(size), flags);
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+void respond(intptr_t s, const char* status, const std::string& body) {
+    std::string header = std::string("HTTP/1.1 ") + status + "\r\n"
+	    "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+	    "Content-Length: " + std::to_string(body.size()) + "\r\n"
+	    "Connection: close\r\n\r\n";
+    if (sendAll(s, header.data(), header.size())) {
+        sendAll(s, body.data(), body.size());
+    }
+}
+} // namespace
+
+std::shared_ptr<PrometheusServer> PrometheusServer::create(const std::string& host, uint16_t port, std::string& error) {
+#ifdef _WIN32
+    static bool initialized = [] {
+        WSADATA wsadata;
+        return WSAStartup(MAKEWORD(2, 2), &wsadata) == 0;
+    }();
+    if (!initialized) {
+        error = "Windows Sockets could not be initialized.";
+        return nullptr;
+    }
+#endif
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo* addresses = nullptr;
+    std::string portstr = std::to_string(port);
+    if (getaddrinfo(host.empty() ? nullptr : host.c_str(), portstr.c_str(), &hints, &addresses) != 0) {
+        error = "Host " + host + " could not be resolved.";
+        return nullptr;
+    }
+    intptr_t listener = InvalidSocket;
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        listener = static_cast<intptr_t>(socket(address->ai_family, address->ai_socktype, address->ai_protocol));
+        if (listener == InvalidSocket) {
+            continue;
+        }
+#ifndef _WIN32
+        // allow restarting on the same port while old connections are in TIME_WAIT
+        int reuse = 1;
+        setsockopt(static_cast<int>(listener), SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+        if (bind(listener, address->ai_addr, static_cast<int>(address->ai_addrlen)) == 0 && listen(listener, 16) == 0) {
+            break;
+        }
+        closeSocket(listener);
+        listener = InvalidSocket;
+    }
+    freeaddrinfo(addresses);
+    if (listener == InvalidSocket) {
+        error = "Could not listen on " + host + ":" + portstr + ".";
+        return nullptr;
+    }
+
+    // find the port chosen by the system if port is 0
+    sockaddr_storage bound;
+    socklen_t boundsize = sizeof(bound);
+    if (getsockname(listener, reinterpret_cast<sockaddr*>(&bound), &boundsize) == 0) {
+        port = ntohs(bound.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+		: reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+    }
+    return std::shared_ptr<PrometheusServer>(new PrometheusServer(listener, port));
+}
+
+PrometheusServer::PrometheusServer(Socket listener, uint16_t port) : Listener(listener), Port(port) {
+    Worker = std::thread(&PrometheusServer::run, this);
+}
+
+PrometheusServer::~PrometheusServer() {
+    Stopping = true;
+    // wake the server thread from accept. Shutting down a listening socket does that on some
+    // platforms only, connecting to it works everywhere.
+    shutdown(Listener, ShutdownBoth);
+    connectToListener(Listener);
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+    closeSocket(Listener);
+}
+
+void PrometheusServer::setRenderer(RenderFunction render) {
+    std::lock_guard<std::mutex> lock(RenderMutex);
+    Render = std::move(render);
+}
+
+void PrometheusServer::run() {
+    while (!Stopping) {
+        // blocks until a scrape or until the destructor wakes the thread
+        Socket client = static_cast<Socket>(accept(Listener, nullptr, nullptr));
+        if (client == InvalidSocket) {
+            continue;
+        }
+        if (!Stopping) {
+            serve(client);
+        }
+        closeSocket(client);
+    }
+}
+
+void PrometheusServer::serve(Socket client) {
+    // read the request line and headers, the request body is ignored. The whole request must
+    // arrive before the deadline, however slowly it is sent.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RequestTimeoutMilliseconds);
+    std::string request;
+    char chunk[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MaxRequestSize) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+		deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0 || Stopping) {
+            return;
+        }
+        setTimeout(client, SO_RCVTIMEO, static_cast<long>(remaining));
+        auto received = recv(client, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            return;
+        }
+        request.append(chunk, static_cast<size_t>(received));
+    }
+    setTimeout(client, SO_SNDTIMEO, RequestTimeoutMilliseconds);
+    size_t methodend = request.find(' ');
+    size_t pathend = methodend == std::string::npos ? std::string::npos : request.find(' ', methodend + 1);
+    if (pathend == std::string::npos) {
+        respond(client, "400 Bad Request", "");
+        return;
+    }
+    std::string method = request.substr(0, methodend);
+    std::string path = request.substr(methodend + 1, pathend - methodend - 1);
+    path = path.substr(0, path.find('?'));
+    if (method != "GET") {
+        respond(client, "405 Method Not Allowed", "");
+        return;
+    }
+    if (path != "/metrics" && path != "/") {
+        respond(client, "404 Not Found", "");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(RenderMutex);
+    if (!Render) {
+        respond(client, "503 Service Unavailable", "");
+        return;
+    }
+    Buffer.clear();    // keeps the capacity of previous scrapes
+    Render(Buffer);
+    respond(client, "200 OK", Buffer);
+}
+} // namespace libmexclass::opentelemetry::exporters
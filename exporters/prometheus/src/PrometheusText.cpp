@@ -0,0 +1,329 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/exporters/prometheus/PrometheusText.h"
+
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/resource/resource.h"
+
+#include <charconv>
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+namespace instrumentationscope = opentelemetry::sdk::instrumentationscope;
+
+namespace libmexclass::opentelemetry::exporters {
+
+namespace {
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T>
+struct IsVector<std::vector<T> > : std::true_type {};
+
+bool isNameChar(char c, bool first) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':' || (!first && c >= '0' && c <= '9');
+}
+
+// metric and label names may only contain letters, digits, underscores, and colons
+void appendName(std::string& out, const std::string& name, bool label) {
+    for (size_t i = 0; i < name.size(); ++i) {
+        bool valid = isNameChar(name[i], i == 0) && !(label && name[i] == ':');
+        if (i == 0 && !valid && name[i] >= '0' && name[i] <= '9') {
+            out.push_back('_');
+            out.push_back(name[i]);
+        } else {
+            out.push_back(valid ? name[i] : '_');
+        }
+    }
+}
+
+void appendNumber(std::string& out, double value) {
+    if (std::isnan(value)) {
+        out += "NaN";
+    } else if (std::isinf(value)) {
+        out += value > 0 ? "+Inf" : "-Inf";
+    } else {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    }
+}
+
+double toDouble(const metric_sdk::ValueType& value) {
+    return nostd::holds_alternative<double>(value) ? nostd::get<double>(value)
+	    : static_cast<double>(nostd::get<int64_t>(value));
+}
+
+void appendEscaped(std::string& out, const std::string& text, bool quotes) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (quotes && c == '"') {
+            out += "\\\"";
+        } else {
+            out.push_back(c);
+        }
+    }
+}
+
+template <typename T>
+void appendScalar(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        out += value;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        out += value ? "true" : "false";
+    } else if constexpr (std::is_floating_point_v<T>) {
+        appendNumber(out, value);
+    } else {
+        out += std::to_string(value);
+    }
+}
+
+std::string valueText(const common_sdk::OwnedAttributeValue& value) {
+    std::string text;
+    nostd::visit([&text](const auto& v) {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (IsVector<T>::value) {
+            text.push_back('[');
+            for (size_t i = 0; i < v.size(); ++i) {
+                if (i > 0) {
+                    text.push_back(',');
+                }
+                appendScalar(text, static_cast<typename T::value_type>(v[i]));
+            }
+            text.push_back(']');
+        } else {
+            appendScalar(text, v);
+        }
+    }, value);
+    return text;
+}
+
+void appendLabel(std::string& out, const std::string& key, const std::string& value, bool& first) {
+    if (!first) {
+        out.push_back(',');
+    }
+    first = false;
+    appendName(out, key, true);
+    out += "=\"";
+    appendEscaped(out, value, true);
+    out.push_back('"');
+}
+
+// {key="value",...}, starting with the name and version of the meter, if any, so that metrics
+// with the same name from different meters are separate series, with an optional le label last
+template <typename AttributeMap>
+void appendLabels(std::string& out, const AttributeMap& attributes,
+		const instrumentationscope::InstrumentationScope* scope = nullptr, const char* le = nullptr) {
+    if (attributes.empty() && scope == nullptr && le == nullptr) {
+        return;
+    }
+    out.push_back('{');
+    bool first = true;
+    if (scope != nullptr) {
+        appendLabel(out, "otel_scope_name", scope->GetName(), first);
+        if (!scope->GetVersion().empty()) {
+            appendLabel(out, "otel_scope_version", scope->GetVersion(), first);
+        }
+    }
+    for (const auto& [key, value] : attributes) {
+        appendLabel(out, key, valueText(value), first);
+    }
+    if (le != nullptr) {
+        if (!first) {
+            out.push_back(',');
+        }
+        out += "le=\"";
+        out += le;
+        out.push_back('"');
+    }
+    out.push_back('}');
+}
+
+void appendSample(std::string& out, const std::string& name, const char* suffix,
+		const metric_sdk::PointAttributes& attributes, const instrumentationscope::InstrumentationScope* scope,
+		double value, const char* le = nullptr) {
+    out += name;
+    out += suffix;
+    appendLabels(out, attributes, scope, le);
+    out.push_back(' ');
+    appendNumber(out, value);
+    out.push_back('\n');
+}
+
+void appendBucket(std::string& out, const std::string& name, const metric_sdk::PointAttributes& attributes,
+		const instrumentationscope::InstrumentationScope* scope, double bound, double cumulative) {
+    std::string le;
+    appendNumber(le, bound);
+    appendSample(out, name, "_bucket", attributes, scope, cumulative, le.c_str());
+}
+
+// Prometheus name of a UCUM unit, following the OpenTelemetry compatibility specification. For
+// example, "ms" becomes "milliseconds" and "By/s" becomes "bytes_per_second". Other units are
+// kept as they are.
+std::string unitName(const std::string& unit) {
+    static const std::unordered_map<std::string, std::string> units = {
+        {"d", "days"}, {"h", "hours"}, {"min", "minutes"}, {"s", "seconds"}, {"ms", "milliseconds"},
+        {"us", "microseconds"}, {"ns", "nanoseconds"}, {"By", "bytes"}, {"KiBy", "kibibytes"},
+        {"MiBy", "mebibytes"}, {"GiBy", "gibibytes"}, {"TiBy", "tibibytes"}, {"KBy", "kilobytes"},
+        {"MBy", "megabytes"}, {"GBy", "gigabytes"}, {"TBy", "terabytes"}, {"m", "meters"}, {"V", "volts"},
+        {"A", "amperes"}, {"J", "joules"}, {"W", "watts"}, {"g", "grams"}, {"Cel", "celsius"},
+        {"Hz", "hertz"}, {"%", "percent"}};
+    static const std::unordered_map<std::string, std::string> perunits = {
+        {"s", "second"}, {"m", "minute"}, {"h", "hour"}, {"d", "day"}, {"w", "week"}, {"mo", "month"},
+        {"y", "year"}};
+    size_t slash = unit.find('/');
+    std::string numerator = unit.substr(0, slash);
+    auto found = units.find(numerator);
+    std::string name = found != units.end() ? found->second : numerator;
+    if (slash == std::string::npos) {
+        return name;
+    }
+    std::string denominator = unit.substr(slash + 1);
+    auto perfound = perunits.find(denominator);
+    if (name == "1") {
+        name.clear();
+    }
+    return (name.empty() ? "" : name + "_") + "per_" + (perfound != perunits.end() ? perfound->second : denominator);
+}
+
+// Prometheus name of a metric, with the unit and the _total suffix of counters
+std::string metricName(const metric_sdk::InstrumentDescriptor& descriptor, bool counter) {
+    std::string name;
+    appendName(name, descriptor.name_, false);
+    // units in braces are annotations, and "1" means dimensionless
+    std::string unit = descriptor.unit_.substr(0, descriptor.unit_.find('{'));
+    if (!unit.empty() && unit != "1") {
+        std::string suffix = "_";
+        appendName(suffix, unitName(unit), true);
+        if (name.size() < suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            name += suffix;
+        }
+    }
+    if (counter) {
+        name += "_total";
+    }
+    return name;
+}
+
+void appendExponentialHistogram(std::string& out, const std::string& name, const metric_sdk::PointAttributes& attributes,
+		const instrumentationscope::InstrumentationScope* scope, const metric_sdk::Base2ExponentialHistogramPointData& hist) {
+    // negative values and the zero bucket are counted at the bucket with bound 0
+    double cumulative = static_cast<double>(hist.zero_count_);
+    const auto& negative = hist.negative_buckets_;
+    if (negative && !negative->Empty()) {
+        for (int32_t i = negative->StartIndex(); i <= negative->EndIndex(); ++i) {
+            cumulative += static_cast<double>(negative->Get(i));
+        }
+    }
+    appendBucket(out, name, attributes, scope, 0, cumulative);
+    const auto& positive = hist.positive_buckets_;
+    if (positive && !positive->Empty()) {
+        double exponent = std::ldexp(1.0, -hist.scale_);   // log2 of the bucket base
+        for (int32_t i = positive->StartIndex(); i <= positive->EndIndex(); ++i) {
+            cumulative += static_cast<double>(positive->Get(i));
+            appendBucket(out, name, attributes, scope, std::exp2((i + 1) * exponent), cumulative);
+        }
+    }
+    appendSample(out, name, "_bucket", attributes, scope, static_cast<double>(hist.count_), "+Inf");
+    appendSample(out, name, "_sum", attributes, scope, hist.sum_);
+    appendSample(out, name, "_count", attributes, scope, static_cast<double>(hist.count_));
+}
+
+// Samples of a metric family, which must be written together
+struct MetricFamily {
+    std::string Type;
+    std::string Text;
+};
+} // namespace
+
+void appendPrometheusText(std::string& out, const metric_sdk::ResourceMetrics& data) {
+    if (data.resource_ != nullptr) {
+        out += "# HELP target_info Target metadata\n# TYPE target_info gauge\ntarget_info";
+        appendLabels(out, data.resource_->GetAttributes());
+        out += " 1\n";
+    }
+    // a metric family is described once and its samples are written together, even if several
+    // meters have metrics with its name
+    std::vector<std::string> names;
+    std::unordered_map<std::string, MetricFamily> families;
+    for (const auto& scopemetrics : data.scope_metric_data_) {
+        const instrumentationscope::InstrumentationScope* scope = scopemetrics.scope_;
+        for (const auto& metric : scopemetrics.metric_data_) {
+            if (metric.point_data_attr_.empty()) {
+                continue;
+            }
+            const auto& first = metric.point_data_attr_.front().point_data;
+            const char* type;
+            bool counter = false;
+            if (nostd::holds_alternative<metric_sdk::SumPointData>(first)) {
+                counter = nostd::get<metric_sdk::SumPointData>(first).is_monotonic_;
+                type = counter ? "counter" : "gauge";
+            } else if (nostd::holds_alternative<metric_sdk::LastValuePointData>(first)) {
+                type = "gauge";
+            } else if (nostd::holds_alternative<metric_sdk::HistogramPointData>(first)
+                    || nostd::holds_alternative<metric_sdk::Base2ExponentialHistogramPointData>(first)) {
+                type = "histogram";
+            } else {
+                continue;   // dropped
+            }
+            std::string name = metricName(metric.instrument_descriptor, counter);
+            auto [family, added] = families.try_emplace(name, MetricFamily{type, std::string()});
+            if (added) {
+                names.push_back(name);
+                std::string& text = family->second.Text;
+                text += "# HELP ";
+                text += name;
+                text.push_back(' ');
+                appendEscaped(text, metric.instrument_descriptor.description_, false);
+                text += "\n# TYPE ";
+                text += name;
+                text.push_back(' ');
+                text += type;
+                text.push_back('\n');
+            } else if (family->second.Type != type) {
+                continue;   // a family has a single type, so a metric of another type cannot join it
+            }
+            std::string& text = family->second.Text;
+            for (const auto& point : metric.point_data_attr_) {
+                if (nostd::holds_alternative<metric_sdk::SumPointData>(point.point_data)) {
+                    appendSample(text, name, "", point.attributes, scope,
+				    toDouble(nostd::get<metric_sdk::SumPointData>(point.point_data).value_));
+                } else if (nostd::holds_alternative<metric_sdk::LastValuePointData>(point.point_data)) {
+                    const auto& lastvalue = nostd::get<metric_sdk::LastValuePointData>(point.point_data);
+                    if (lastvalue.is_lastvalue_valid_) {
+                        appendSample(text, name, "", point.attributes, scope, toDouble(lastvalue.value_));
+                    }
+                } else if (nostd::holds_alternative<metric_sdk::HistogramPointData>(point.point_data)) {
+                    const auto& hist = nostd::get<metric_sdk::HistogramPointData>(point.point_data);
+                    double cumulative = 0;
+                    for (size_t i = 0; i < hist.boundaries_.size() && i < hist.counts_.size(); ++i) {
+                        cumulative += static_cast<double>(hist.counts_[i]);
+                        appendBucket(text, name, point.attributes, scope, hist.boundaries_[i], cumulative);
+                    }
+                    appendSample(text, name, "_bucket", point.attributes, scope, static_cast<double>(hist.count_), "+Inf");
+                    appendSample(text, name, "_sum", point.attributes, scope, toDouble(hist.sum_));
+                    appendSample(text, name, "_count", point.attributes, scope, static_cast<double>(hist.count_));
+                } else if (nostd::holds_alternative<metric_sdk::Base2ExponentialHistogramPointData>(point.point_data)) {
+                    appendExponentialHistogram(text, name, point.attributes, scope,
+				    nostd::get<metric_sdk::Base2ExponentialHistogramPointData>(point.point_data));
+                }
+            }
+        }
+    }
+    for (const auto& name : names) {
+        out += families[name].Text;
+    }
+}
+} // namespace libmexclass::opentelemetry::exporters
@@ -0,0 +1,71 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/variant.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace common = opentelemetry::common;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Converts owned attribute values stored by the SDK back into non-owning attribute values,
+// so that they can be passed on to another recordable. The views remain valid as long as both
+// the owned value and this object are alive.
+class AttributeValueView {
+  public:
+    common::AttributeValue operator()(const common_sdk::OwnedAttributeValue& value) {
+        return nostd::visit(Converter{this}, value);
+    }
+
+  private:
+    struct Converter {
+        AttributeValueView* View;
+
+        common::AttributeValue operator()(bool v) { return v; }
+        common::AttributeValue operator()(int32_t v) { return v; }
+        common::AttributeValue operator()(uint32_t v) { return v; }
+        common::AttributeValue operator()(int64_t v) { return v; }
+        common::AttributeValue operator()(uint64_t v) { return v; }
+        common::AttributeValue operator()(double v) { return v; }
+
+        common::AttributeValue operator()(const std::string& v) {
+            return nostd::string_view(v);
+        }
+
+        // std::vector<bool> is bit packed and cannot be viewed as a span
+        common::AttributeValue operator()(const std::vector<bool>& v) {
+            View->BoolBuffer.push_back(std::unique_ptr<bool[]>(new bool[v.size()]));
+            bool* buffer = View->BoolBuffer.back().get();
+            for (size_t i = 0; i < v.size(); ++i) {
+                buffer[i] = v[i];
+            }
+            return nostd::span<const bool>(buffer, v.size());
+        }
+
+        common::AttributeValue operator()(const std::vector<std::string>& v) {
+            View->StringViewBuffer.push_back(std::vector<nostd::string_view>(v.begin(), v.end()));
+            const std::vector<nostd::string_view>& buffer = View->StringViewBuffer.back();
+            return nostd::span<const nostd::string_view>(buffer.data(), buffer.size());
+        }
+
+        template <typename T>
+        common::AttributeValue operator()(const std::vector<T>& v) {
+            return nostd::span<const T>(v.data(), v.size());
+        }
+    };
+
+    std::list<std::unique_ptr<bool[]> > BoolBuffer;
+    std::list<std::vector<nostd::string_view> > StringViewBuffer;
+};
+} // namespace libmexclass::opentelemetry
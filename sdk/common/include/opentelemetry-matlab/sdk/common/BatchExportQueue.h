@@ -0,0 +1,270 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/RingBuffer.h"
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libmexclass::opentelemetry::sdk {
+
+// What to do with a new record when the queue is full
+enum class FullQueuePolicy {DropNewest, DropOldest, Block};
+
+struct BatchExportQueueOptions {
+    size_t max_queue_size = 2048;      // maximum number of queued records
+    size_t max_queue_bytes = 0;        // maximum total size of queued records, 0 means no limit
+    std::chrono::milliseconds schedule_delay_millis = std::chrono::milliseconds(5000);
+    size_t max_export_batch_size = 512;
+    FullQueuePolicy full_queue_policy = FullQueuePolicy::DropNewest;
+    std::chrono::milliseconds block_timeout_millis = std::chrono::milliseconds(1000);
+};
+
+// Queue of records waiting to be exported in batches by a background thread. Producers add
+// records through a lock-free ring buffer and only take a lock when blocking on a full queue.
+// The queue can be bounded by a record count, a total byte size, or both. Dropped records are
+// counted in the optional pipeline statistics.
+template <typename Record>
+class BatchExportQueue {
+  public:
+    using ExportFunction = std::function<bool(std::vector<std::unique_ptr<Record> >&)>;
+
+    BatchExportQueue(const BatchExportQueueOptions& options, ExportFunction exportfcn,
+            std::shared_ptr<PipelineStats> stats = nullptr)
+        : Options(options), Export(std::move(exportfcn)), Stats(std::move(stats)),
+          Ring((std::max)(options.max_queue_size, static_cast<size_t>(1))) {
+        if (Options.max_queue_size == 0) {
+            Options.max_queue_size = 1;
+        }
+        if (Options.max_export_batch_size == 0 || Options.max_export_batch_size > Options.max_queue_size) {
+            Options.max_export_batch_size = Options.max_queue_size;
+        }
+        Worker = std::thread(&BatchExportQueue::run, this);
+    }
+
+    ~BatchExportQueue() {
+        stop();
+    }
+
+    BatchExportQueue(const BatchExportQueue&) = delete;
+    BatchExportQueue& operator=(const BatchExportQueue&) = delete;
+
+    // Add a record of the given size. Returns false if the record was dropped.
+    bool push(std::unique_ptr<Record>&& record, size_t bytes) {
+        // the worker waits for producers still in here when stopping, so no record is admitted after its final drain
+        ActiveProducers.fetch_add(1);
+        bool admitted = admit(std::move(record), bytes);
+        ActiveProducers.fetch_sub(1, std::memory_order_release);
+        return admitted;
+    }
+
+    // Export all records added before this call. Returns false if not finished within the timeout.
+    bool flush(std::chrono::microseconds timeout) {
+        std::unique_lock<std::mutex> lock(Mutex);
+        uint64_t ticket = ++FlushRequested;
+        Ready.notify_one();
+        auto done = [this, ticket] { return FlushCompleted >= ticket || WorkerExited; };
+        if (timeout == (std::chrono::microseconds::max)()) {
+            Drained.wait(lock, done);
+            return true;
+        }
+        return Drained.wait_for(lock, timeout, done);
+    }
+
+    // Export all remaining records and stop the background thread
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            if (Stopped.exchange(true)) {
+                return;
+            }
+        }
+        Ready.notify_one();
+        SpaceAvailable.notify_all();
+        Worker.join();
+    }
+
+    size_t size() const {
+        return QueuedRecords.load(std::memory_order_relaxed);
+    }
+
+    size_t bytes() const {
+        return QueuedBytes.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Entry {
+        std::unique_ptr<Record> Data;
+        size_t Bytes = 0;
+    };
+
+    bool admit(std::unique_ptr<Record>&& record, size_t bytes) {
+        // sequentially consistent with the increment in push and the exchange in stop
+        if (Stopped.load()) {
+            recordDropped();
+            return false;
+        }
+        Entry entry{std::move(record), bytes};
+        if (tryAdmit(entry)) {
+            return true;
+        }
+        bool admitted = false;
+
+        switch (Options.full_queue_policy) {
+            case FullQueuePolicy::DropOldest: {
+                // evict from the head until the new record fits, bounded in case producers keep refilling the queue
+                const size_t maxattempts = Options.max_queue_size + 1;
+                for (size_t i = 0; i < maxattempts; ++i) {
+                    Entry oldest;
+                    if (Ring.tryPop(oldest)) {
+                        release(oldest);
+                        recordDropped();
+                    }
+                    if (tryAdmit(entry)) {
+                        admitted = true;
+                        break;
+                    }
+                }
+                break;
+            }
+            case FullQueuePolicy::Block: {
+                Ready.notify_one();   // export right away to make room
+                std::unique_lock<std::mutex> lock(Mutex);
+                SpaceAvailable.wait_for(lock, Options.block_timeout_millis, [&] {
+                    admitted = tryAdmit(entry);
+                    return admitted || Stopped.load(std::memory_order_acquire);
+                });
+                break;
+            }
+            default:
+                break;
+        }
+        if (!admitted) {
+            recordDropped();
+        }
+        return admitted;
+    }
+
+    // Reserve room for the entry and move it into the ring. Room is reserved before the ring
+    // push so that concurrent producers cannot overshoot the record or byte limits.
+    bool tryAdmit(Entry& entry) {
+        size_t prevcount = QueuedRecords.fetch_add(1, std::memory_order_acq_rel);
+        if (prevcount >= Options.max_queue_size) {
+            QueuedRecords.fetch_sub(1, std::memory_order_acq_rel);
+            return false;
+        }
+        if (Options.max_queue_bytes > 0) {
+            size_t prevbytes = QueuedBytes.fetch_add(entry.Bytes, std::memory_order_acq_rel);
+            // a record larger than the whole budget is only accepted into an empty queue
+            if (prevbytes > 0 && prevbytes + entry.Bytes > Options.max_queue_bytes) {
+                QueuedBytes.fetch_sub(entry.Bytes, std::memory_order_acq_rel);
+                QueuedRecords.fetch_sub(1, std::memory_order_acq_rel);
+                return false;
+            }
+        }
+        size_t bytes = entry.Bytes;
+        if (!Ring.tryPush(entry)) {
+            // only possible transiently while a consumer has reserved but not yet freed a slot
+            if (Options.max_queue_bytes > 0) {
+                QueuedBytes.fetch_sub(bytes, std::memory_order_acq_rel);
+            }
+            QueuedRecords.fetch_sub(1, std::memory_order_acq_rel);
+            return false;
+        }
+        if (prevcount + 1 >= Options.max_export_batch_size) {
+            Ready.notify_one();
+        }
+        return true;
+    }
+
+    void recordDropped() {
+        if (Stats) {
+            Stats->recordDropped(1);
+        }
+    }
+
+    void release(const Entry& entry) {
+        if (Options.max_queue_bytes > 0) {
+            QueuedBytes.fetch_sub(entry.Bytes, std::memory_order_acq_rel);
+        }
+        QueuedRecords.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // export batches until the queue is empty
+    void drain(std::vector<std::unique_ptr<Record> >& batch) {
+        while (true) {
+            Entry entry;
+            while (batch.size() < Options.max_export_batch_size && Ring.tryPop(entry)) {
+                release(entry);
+                batch.push_back(std::move(entry.Data));
+            }
+            if (batch.empty()) {
+                return;
+            }
+            {
+                // wake up producers blocked on a full queue
+                std::lock_guard<std::mutex> lock(Mutex);
+            }
+            SpaceAvailable.notify_all();
+            Export(batch);
+            batch.clear();
+        }
+    }
+
+    void run() {
+        std::vector<std::unique_ptr<Record> > batch;
+        batch.reserve(Options.max_export_batch_size);
+        std::unique_lock<std::mutex> lock(Mutex);
+        while (true) {
+            Ready.wait_for(lock, Options.schedule_delay_millis, [this] {
+                    return Stopped.load(std::memory_order_acquire) || FlushRequested > FlushCompleted ||
+                        QueuedRecords.load(std::memory_order_relaxed) >= Options.max_export_batch_size; });
+            uint64_t ticket = FlushRequested;
+            bool stopping = Stopped.load(std::memory_order_acquire);
+            lock.unlock();
+            if (stopping) {
+                // producers that saw the queue running finish admitting their records before the final drain
+                while (ActiveProducers.load(std::memory_order_acquire) > 0) {
+                    std::this_thread::yield();
+                }
+            }
+            drain(batch);
+            lock.lock();
+            FlushCompleted = ticket;
+            Drained.notify_all();
+            if (stopping) {
+                break;
+            }
+        }
+        WorkerExited = true;
+        Drained.notify_all();
+    }
+
+    BatchExportQueueOptions Options;
+    ExportFunction Export;
+    std::shared_ptr<PipelineStats> Stats;
+    RingBuffer<Entry> Ring;
+    alignas(RingBuffer<Entry>::CacheLineSize) std::atomic<size_t> QueuedRecords{0};
+    alignas(RingBuffer<Entry>::CacheLineSize) std::atomic<size_t> QueuedBytes{0};
+    alignas(RingBuffer<Entry>::CacheLineSize) std::atomic<size_t> ActiveProducers{0};
+    std::atomic<bool> Stopped{false};
+    std::mutex Mutex;
+    std::condition_variable Ready;
+    std::condition_variable Drained;
+    std::condition_variable SpaceAvailable;
+    uint64_t FlushRequested = 0;
+    uint64_t FlushCompleted = 0;
+    bool WorkerExited = false;
+    std::thread Worker;
+};
+} // namespace libmexclass::opentelemetry::sdk
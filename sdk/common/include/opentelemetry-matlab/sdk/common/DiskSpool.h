@@ -0,0 +1,65 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/FileLock.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace libmexclass::opentelemetry::sdk {
+
+struct DiskSpoolOptions {
+    std::string directory;                      // folder holding the segment files
+    size_t segment_size = 4 * 1024 * 1024;      // size of each memory-mapped segment file
+    size_t max_bytes = 256 * 1024 * 1024;       // disk quota for all segments
+};
+
+// First-in first-out queue of records stored in fixed size, memory-mapped segment files.
+// Records are written straight into the mapping, so they survive a crash of the process, and
+// segments left by an earlier session are picked up again when the spool is opened. When
+// a new segment would exceed the disk quota, the oldest segment is discarded. A lock file keeps
+// other spools, in this process or another, from using the same directory at the same time.
+class DiskSpool {
+  public:
+    explicit DiskSpool(const DiskSpoolOptions& options);
+
+    ~DiskSpool();
+
+    DiskSpool(const DiskSpool&) = delete;
+    DiskSpool& operator=(const DiskSpool&) = delete;
+
+    // Returns false if the record is larger than a segment, cannot be written, or the directory is
+    // locked by another spool
+    bool append(const std::string& record);
+
+    // Copy the oldest record, returns false if the spool is empty
+    bool front(std::string& record);
+
+    // Remove the oldest record
+    void pop();
+
+    bool empty();
+
+    // number of records discarded to stay within the disk quota or because they do not fit in
+    // a segment
+    uint64_t dropped();
+
+  private:
+    class Segment;
+
+    bool addSegment();
+
+    void removeOldestSegment();
+
+    DiskSpoolOptions Options;
+    FileLock DirectoryLock;
+    std::mutex Mutex;
+    std::deque<std::unique_ptr<Segment> > Segments;
+    uint64_t NextSequence = 0;
+    uint64_t Dropped = 0;
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,43 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Exclusive lock on a file, held until the lock is released or the process exits. The lock is
+// advisory on POSIX systems and applies to other processes as well as other locks in this one.
+class FileLock {
+  public:
+    FileLock() = default;
+
+    ~FileLock() {
+        unlock();
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    // Create the file if needed and lock it without waiting. Returns false if it is locked elsewhere.
+    bool tryLock(const std::filesystem::path& path);
+
+    void unlock();
+
+    bool locked() const;
+
+  private:
+#ifdef _WIN32
+    HANDLE File = INVALID_HANDLE_VALUE;
+#else
+    int Fd = -1;
+#endif
+};
+} // namespace libmexclass::opentelemetry::sdk
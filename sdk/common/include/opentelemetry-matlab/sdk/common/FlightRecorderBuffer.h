@@ -0,0 +1,67 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/MappedFile.h"
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libmexclass::opentelemetry::sdk {
+
+struct FlightRecorderOptions {
+    size_t buffer_size = 4 * 1024 * 1024;       // bytes of records kept
+    std::string filename;                       // memory-mapped file holding the records, empty to keep them in memory
+    std::chrono::nanoseconds max_age = (std::chrono::nanoseconds::max)();   // oldest record included in a dump
+};
+
+// Fixed size ring of timestamped records, which overwrites the oldest records when it is full.
+// The ring is either kept in memory or written straight into a memory-mapped file, in which case
+// it survives a crash of the process and its records are picked up again by the next session
+// that opens the same file.
+class FlightRecorderBuffer {
+  public:
+    explicit FlightRecorderBuffer(const FlightRecorderOptions& options);
+
+    ~FlightRecorderBuffer();
+
+    FlightRecorderBuffer(const FlightRecorderBuffer&) = delete;
+    FlightRecorderBuffer& operator=(const FlightRecorderBuffer&) = delete;
+
+    // Append a record made of the concatenation of parts. Returns false if the record is larger
+    // than the buffer.
+    bool push(std::initializer_list<std::string_view> parts);
+
+    // Remove all records, and return the ones no older than the maximum age, oldest first
+    std::vector<std::string> take();
+
+  private:
+    struct Header;
+
+    Header* header() const;
+
+    void write(uint64_t pos, const char* data, size_t len);
+
+    void read(uint64_t pos, char* data, size_t len) const;
+
+    // check the positions of a ring reopened from a file
+    bool valid() const;
+
+    FlightRecorderOptions Options;
+    MappedFile File;
+    std::unique_ptr<char[]> Memory;
+    char* Ring = nullptr;
+    std::mutex Mutex;
+};
+
+// Append the key and length of a length-delimited protobuf field, so that an encoded message can
+// be embedded by appending its bytes
+void appendProtoFieldHeader(std::string& out, uint32_t field, size_t length);
+
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,57 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Read-write shared memory mapping of a file. Data written to the mapping reaches the file even
+// if the process crashes.
+class MappedFile {
+  public:
+    MappedFile() = default;
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map size bytes of a file. If create is true, the file is created or truncated and extended
+    // to size, otherwise the existing file is mapped and must be at least size bytes long.
+    bool open(const std::filesystem::path& path, size_t size, bool create);
+
+    void close();
+
+    char* data() const {
+        return Data;
+    }
+
+    size_t size() const {
+        return Size;
+    }
+
+    // write dirty pages back to the file, without waiting for completion
+    void sync();
+
+  private:
+    char* Data = nullptr;
+    size_t Size = 0;
+#ifdef _WIN32
+    HANDLE File = INVALID_HANDLE_VALUE;
+    HANDLE Mapping = nullptr;
+#else
+    int Fd = -1;
+#endif
+};
+} // namespace libmexclass::opentelemetry
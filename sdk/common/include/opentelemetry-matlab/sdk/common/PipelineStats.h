@@ -0,0 +1,124 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "MatlabDataArray.hpp"
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace common = opentelemetry::common;
+namespace metrics_api = opentelemetry::metrics;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Histogram with fixed bucket boundaries that can be updated concurrently without locking
+template <size_t NBounds>
+class AtomicHistogram {
+  public:
+    explicit AtomicHistogram(const std::array<double, NBounds>& bounds) : Bounds(bounds) {}
+
+    void record(double value) {
+        size_t i = 0;
+        while (i < NBounds && value > Bounds[i]) {
+            ++i;
+        }
+        Counts[i].fetch_add(1, std::memory_order_relaxed);
+        Count.fetch_add(1, std::memory_order_relaxed);
+        // no atomic floating point add before C++20
+        double sum = Sum.load(std::memory_order_relaxed);
+        while (!Sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {}
+    }
+
+    matlab::data::StructArray toStruct(matlab::data::ArrayFactory& factory) const;
+
+  private:
+    const std::array<double, NBounds> Bounds;
+    std::array<std::atomic<uint64_t>, NBounds + 1> Counts{};
+    std::atomic<uint64_t> Count{0};
+    std::atomic<double> Sum{0};
+};
+
+// Counters that describe the health of an export pipeline: how many records were accepted,
+// dropped before reaching the exporter, exported, or failed to export, and how long exports take.
+// Counters are updated by the processor and exporter wrappers on their own threads, and can be
+// read from MATLAB or published as OpenTelemetry metrics.
+class PipelineStats {
+  public:
+    // signal is "traces", "logs", or "metrics". component is the processor or reader class name.
+    PipelineStats(const std::string& signal, const std::string& component);
+
+    ~PipelineStats();
+
+    PipelineStats(const PipelineStats&) = delete;
+    PipelineStats& operator=(const PipelineStats&) = delete;
+
+    void recordEnqueued(uint64_t n) {
+        Enqueued.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void recordDropped(uint64_t n) {
+        Dropped.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // record the outcome of exporting a batch of n records
+    void recordExport(uint64_t n, bool success, std::chrono::steady_clock::duration elapsed);
+
+    // records accepted but not yet exported, including the batch being exported
+    uint64_t queueDepth() const;
+
+    matlab::data::StructArray toStruct() const;
+
+    // create observable counters and histograms for these statistics on the given meter
+    void publish(nostd::shared_ptr<metrics_api::Meter> meter);
+
+  private:
+    enum class Counter {Enqueued, Dropped, Exported, Failed, QueueDepth};
+
+    struct Observation {
+        const PipelineStats* Stats;
+        Counter Which;
+        nostd::shared_ptr<metrics_api::ObservableInstrument> Instrument;
+    };
+
+    struct Publication {
+        std::vector<Observation> Observations;   // callback states, must not move after registration
+        nostd::unique_ptr<metrics_api::Histogram<double> > Duration;
+        nostd::unique_ptr<metrics_api::Histogram<uint64_t> > BatchSize;
+    };
+
+    static void observe(metrics_api::ObserverResult result, void* state);
+
+    uint64_t value(Counter which) const;
+
+    static constexpr size_t NDurationBounds = 13;
+    static constexpr size_t NBatchSizeBounds = 13;
+
+    const std::string Signal;
+    const std::string Component;
+    std::map<std::string, common::AttributeValue> Attributes;   // attached to published metrics
+    std::atomic<uint64_t> Enqueued{0};
+    std::atomic<uint64_t> Dropped{0};
+    std::atomic<uint64_t> Exported{0};
+    std::atomic<uint64_t> Failed{0};
+    AtomicHistogram<NDurationBounds> ExportDuration;   // milliseconds
+    AtomicHistogram<NBatchSizeBounds> BatchSize;
+    std::mutex PublicationMutex;
+    std::list<Publication> Publications;
+};
+} // namespace libmexclass::opentelemetry
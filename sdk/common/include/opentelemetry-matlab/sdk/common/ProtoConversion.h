@@ -0,0 +1,75 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/AttributeValueView.h"
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/common/key_value_iterable_view.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/trace/span_id.h"
+#include "opentelemetry/trace/trace_id.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/common/v1/common.pb.h"
+#include "opentelemetry/proto/resource/v1/resource.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace common = opentelemetry::common;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace resource = opentelemetry::sdk::resource;
+namespace instrumentationscope = opentelemetry::sdk::instrumentationscope;
+namespace nostd = opentelemetry::nostd;
+namespace trace_api = opentelemetry::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Convert an OTLP attribute value. Arrays take the type of their first element, and key-value
+// lists are converted to their text representation.
+common_sdk::OwnedAttributeValue fromAnyValue(const ::opentelemetry::proto::common::v1::AnyValue& value);
+
+// Attributes converted from OTLP key-values, as non-owning attribute values that can be passed
+// to recordables. Keys refer to the OTLP message, which must outlive this object.
+class ProtoAttributeList {
+  public:
+    using Entries = std::vector<std::pair<nostd::string_view, common::AttributeValue> >;
+
+    explicit ProtoAttributeList(
+                    const google::protobuf::RepeatedPtrField< ::opentelemetry::proto::common::v1::KeyValue>& keyvalues);
+
+    const Entries& entries() const {
+        return Items;
+    }
+
+    common::KeyValueIterableView<Entries> view() const {
+        return common::KeyValueIterableView<Entries>(Items);
+    }
+
+  private:
+    std::list<common_sdk::OwnedAttributeValue> Owned;
+    AttributeValueView View;
+    Entries Items;
+};
+
+// Recreate the resource and instrumentation scope described by OTLP messages
+std::unique_ptr<resource::Resource> makeResource(const ::opentelemetry::proto::resource::v1::Resource& proto,
+                const std::string& schemaurl);
+
+std::unique_ptr<instrumentationscope::InstrumentationScope> makeInstrumentationScope(
+                const ::opentelemetry::proto::common::v1::InstrumentationScope& proto, const std::string& schemaurl);
+
+// Trace and span IDs from OTLP byte strings, invalid IDs if the length is wrong
+trace_api::TraceId traceIdFromBytes(const std::string& bytes);
+
+trace_api::SpanId spanIdFromBytes(const std::string& bytes);
+
+} // namespace libmexclass::opentelemetry::sdk
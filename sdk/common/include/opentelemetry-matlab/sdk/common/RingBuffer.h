@@ -0,0 +1,112 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Bounded lock-free queue that supports multiple producers and consumers. Each slot carries a
+// sequence number that tells producers and consumers whether it is free or filled, so that
+// they only contend on a single atomic index each. Slots and indices are padded to separate
+// cache lines to avoid false sharing between producer and consumer threads.
+template <typename T>
+class RingBuffer {
+  public:
+    static constexpr size_t CacheLineSize = 64;
+
+    // capacity is rounded up to a power of two
+    explicit RingBuffer(size_t capacity) {
+        size_t n = 2;
+        while (n < capacity) {
+            n <<= 1;
+        }
+        Mask = n - 1;
+        Cells.reset(new Cell[n]);
+        for (size_t i = 0; i < n; ++i) {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+        EnqueuePosition.store(0, std::memory_order_relaxed);
+        DequeuePosition.store(0, std::memory_order_relaxed);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    // Move value into the buffer. Returns false and leaves value untouched if the buffer is full.
+    bool tryPush(T& value) {
+        Cell* cell;
+        size_t pos = EnqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &Cells[pos & Mask];
+            size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (EnqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->Data = std::move(value);
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Move the oldest element into value. Returns false if the buffer is empty.
+    bool tryPop(T& value) {
+        Cell* cell;
+        size_t pos = DequeuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &Cells[pos & Mask];
+            size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (DequeuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = DequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->Data);
+        cell->Sequence.store(pos + Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // approximate number of elements, exact only when there are no concurrent pushes or pops
+    size_t size() const {
+        size_t head = DequeuePosition.load(std::memory_order_relaxed);
+        size_t tail = EnqueuePosition.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t capacity() const {
+        return Mask + 1;
+    }
+
+  private:
+    struct alignas(CacheLineSize) Cell {
+        std::atomic<size_t> Sequence;
+        T Data;
+    };
+
+    std::unique_ptr<Cell[]> Cells;
+    size_t Mask;
+    alignas(CacheLineSize) std::atomic<size_t> EnqueuePosition;
+    alignas(CacheLineSize) std::atomic<size_t> DequeuePosition;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,81 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/DiskSpool.h"
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace libmexclass::opentelemetry::sdk {
+
+struct SpoolOptions : public DiskSpoolOptions {
+    std::chrono::milliseconds initial_backoff = std::chrono::milliseconds(1000);
+    std::chrono::milliseconds max_backoff = std::chrono::milliseconds(300000);
+};
+
+// Outcome of one delivery attempt. Rejected requests, such as ones the backend answers with
+// HTTP 400, would fail again on retry and are dropped instead of spooled.
+enum class DeliveryResult {Delivered, Retry, Rejected};
+
+// Exporters report a request that is invalid in itself as an invalid argument, any other failure
+// may be temporary
+inline DeliveryResult toDeliveryResult(::opentelemetry::sdk::common::ExportResult result) {
+    switch (result) {
+        case ::opentelemetry::sdk::common::ExportResult::kSuccess:
+            return DeliveryResult::Delivered;
+        case ::opentelemetry::sdk::common::ExportResult::kFailureInvalidArgument:
+            return DeliveryResult::Rejected;
+        default:
+            return DeliveryResult::Retry;
+    }
+}
+
+// Delivers serialized export requests, storing them in a disk spool while delivery fails.
+// A background thread retries the oldest spooled request with exponential backoff, and once it
+// succeeds, replays the rest of the spool in order. New requests are spooled behind any backlog
+// so that they are delivered in the order they were submitted. Rejected requests are dropped.
+class SpoolForwarder {
+  public:
+    // Send one serialized request
+    using DeliverFunction = std::function<DeliveryResult(const std::string&)>;
+
+    SpoolForwarder(const SpoolOptions& options, DeliverFunction deliver);
+
+    ~SpoolForwarder();
+
+    SpoolForwarder(const SpoolForwarder&) = delete;
+    SpoolForwarder& operator=(const SpoolForwarder&) = delete;
+
+    // Deliver a request, or spool it if there is a backlog or delivery fails. Returns false if the
+    // request was rejected or could not be spooled either.
+    bool submit(const std::string& request);
+
+    // Try to deliver all spooled requests, stopping at the first failure or when the timeout
+    // expires. Returns true if the spool is empty.
+    bool drain(std::chrono::microseconds timeout);
+
+    // Stop the retry thread. Requests still spooled stay on disk for the next session.
+    void stop();
+
+  private:
+    void run();
+
+    DiskSpool Spool;
+    DeliverFunction Deliver;
+    std::chrono::milliseconds InitialBackoff;
+    std::chrono::milliseconds MaxBackoff;
+    std::mutex DeliverMutex;     // serializes delivery between submit and the retry thread
+    std::mutex Mutex;
+    std::condition_variable Wake;
+    std::atomic<bool> Stopping{false};
+    std::thread Worker;
+};
+} // namespace libmexclass::opentelemetry::sdk
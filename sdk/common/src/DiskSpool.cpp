@@ -0,0 +1,269 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/DiskSpool.h"
+#include "opentelemetry-matlab/sdk/common/MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+const char SegmentMagic[8] = {'O', 'T', 'M', 'S', 'P', 'O', 'O', 'L'};
+
+// Stored at the start of each segment, followed by records that each consist of a uint32
+// length and the record bytes
+struct SegmentHeader {
+    char Magic[8];
+    uint64_t WriteEnd;   // offset after the last complete record
+    uint64_t ReadPos;    // offset of the oldest record not yet removed
+};
+
+const size_t LengthSize = sizeof(uint32_t);
+
+std::string segmentName(uint64_t sequence) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment-%016llu.spool", static_cast<unsigned long long>(sequence));
+    return name;
+}
+} // namespace
+
+class DiskSpool::Segment {
+  public:
+    // Map a segment file, creating it if size is nonzero. Returns nullptr if the file cannot be
+    // mapped or is not a valid segment.
+    static std::unique_ptr<Segment> open(const fs::path& path, size_t size) {
+        std::unique_ptr<Segment> seg(new Segment(path));
+        bool create = size > 0;
+        if (!create) {
+            std::error_code ec;
+            size = static_cast<size_t>(fs::file_size(path, ec));
+            if (ec || size < sizeof(SegmentHeader)) {
+                return nullptr;
+            }
+        }
+        if (!seg->File.open(path, size, create)) {
+            return nullptr;
+        }
+        SegmentHeader* header = seg->header();
+        if (create) {
+            std::memcpy(header->Magic, SegmentMagic, sizeof(SegmentMagic));
+            header->WriteEnd = sizeof(SegmentHeader);
+            header->ReadPos = sizeof(SegmentHeader);
+        } else if (std::memcmp(header->Magic, SegmentMagic, sizeof(SegmentMagic)) != 0
+                || header->WriteEnd > size || header->ReadPos > header->WriteEnd
+                || header->ReadPos < sizeof(SegmentHeader)) {
+            return nullptr;
+        }
+        return seg;
+    }
+
+    bool fits(size_t len) const {
+        return header()->WriteEnd + LengthSize + len <= File.size();
+    }
+
+    void append(const std::string& record) {
+        SegmentHeader* h = header();
+        uint32_t len = static_cast<uint32_t>(record.size());
+        std::memcpy(data() + h->WriteEnd, &len, LengthSize);
+        std::memcpy(data() + h->WriteEnd + LengthSize, record.data(), record.size());
+        // publish the record only after its bytes are in place
+        h->WriteEnd += LengthSize + record.size();
+    }
+
+    bool front(std::string& record) const {
+        const SegmentHeader* h = header();
+        uint32_t len;
+        if (h->ReadPos + LengthSize > h->WriteEnd) {
+            return false;
+        }
+        std::memcpy(&len, data() + h->ReadPos, LengthSize);
+        if (h->ReadPos + LengthSize + len > h->WriteEnd) {
+            return false;
+        }
+        record.assign(data() + h->ReadPos + LengthSize, len);
+        return true;
+    }
+
+    void pop() {
+        SegmentHeader* h = header();
+        uint32_t len;
+        std::memcpy(&len, data() + h->ReadPos, LengthSize);
+        h->ReadPos = (std::min)(h->ReadPos + LengthSize + len, h->WriteEnd);
+    }
+
+    bool empty() const {
+        return header()->ReadPos >= header()->WriteEnd;
+    }
+
+    void discard() {
+        header()->ReadPos = header()->WriteEnd;
+    }
+
+    uint64_t count() const {
+        uint64_t n = 0;
+        for (uint64_t pos = header()->ReadPos; pos + LengthSize <= header()->WriteEnd; ++n) {
+            uint32_t len;
+            std::memcpy(&len, data() + pos, LengthSize);
+            pos += LengthSize + len;
+        }
+        return n;
+    }
+
+    // write dirty pages back to the file, without waiting for completion
+    void sync() {
+        File.sync();
+    }
+
+    void remove() {
+        File.close();
+        std::error_code ec;
+        fs::remove(Path, ec);
+    }
+
+  private:
+    explicit Segment(const fs::path& path) : Path(path) {}
+
+    SegmentHeader* header() const {
+        return reinterpret_cast<SegmentHeader*>(File.data());
+    }
+
+    char* data() const {
+        return File.data();
+    }
+
+    fs::path Path;
+    MappedFile File;
+};
+
+DiskSpool::DiskSpool(const DiskSpoolOptions& options) : Options(options) {
+    Options.segment_size = (std::max)(Options.segment_size, sizeof(SegmentHeader) + LengthSize + 1);
+    Options.max_bytes = (std::max)(Options.max_bytes, Options.segment_size);
+
+    std::error_code ec;
+    fs::create_directories(Options.directory, ec);
+    // leave the segments alone if another spool is using the directory
+    if (!DirectoryLock.tryLock(fs::path(Options.directory) / "spool.lock")) {
+        return;
+    }
+
+    // reopen segments left by an earlier session, oldest first
+    std::vector<std::pair<uint64_t, fs::path> > existing;
+    for (const auto& entry : fs::directory_iterator(Options.directory, ec)) {
+        unsigned long long sequence;
+        std::string name = entry.path().filename().string();
+        if (std::sscanf(name.c_str(), "segment-%llu.spool", &sequence) == 1) {
+            existing.emplace_back(sequence, entry.path());
+        }
+    }
+    std::sort(existing.begin(), existing.end());
+    for (const auto& [sequence, path] : existing) {
+        std::unique_ptr<Segment> seg = Segment::open(path, 0);
+        if (seg == nullptr) {
+            fs::remove(path, ec);
+            continue;
+        }
+        Segments.push_back(std::move(seg));
+        NextSequence = sequence + 1;
+    }
+    // drop segments that have been fully read, except the last which can still be appended to
+    while (Segments.size() > 1 && Segments.front()->empty()) {
+        Segments.front()->remove();
+        Segments.pop_front();
+    }
+}
+
+DiskSpool::~DiskSpool() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    for (auto& seg : Segments) {
+        seg->sync();
+    }
+}
+
+bool DiskSpool::addSegment() {
+    size_t maxsegments = Options.max_bytes / Options.segment_size;
+    while (!Segments.empty() && Segments.size() >= maxsegments) {
+        removeOldestSegment();
+    }
+    if (!Segments.empty()) {
+        Segments.back()->sync();
+    }
+    fs::path path = fs::path(Options.directory) / segmentName(NextSequence++);
+    std::unique_ptr<Segment> seg = Segment::open(path, Options.segment_size);
+    if (seg == nullptr) {
+        return false;
+    }
+    Segments.push_back(std::move(seg));
+    return true;
+}
+
+void DiskSpool::removeOldestSegment() {
+    Dropped += Segments.front()->count();
+    Segments.front()->remove();
+    Segments.pop_front();
+}
+
+bool DiskSpool::append(const std::string& record) {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (!DirectoryLock.locked()) {
+        return false;
+    }
+    if (record.size() > Options.segment_size - sizeof(SegmentHeader) - LengthSize) {
+        ++Dropped;
+        return false;
+    }
+    if (Segments.empty() || !Segments.back()->fits(record.size())) {
+        if (!addSegment()) {
+            return false;
+        }
+    }
+    Segments.back()->append(record);
+    return true;
+}
+
+bool DiskSpool::front(std::string& record) {
+    std::lock_guard<std::mutex> lock(Mutex);
+    for (const auto& seg : Segments) {
+        if (seg->empty()) {
+            continue;
+        }
+        if (seg->front(record)) {
+            return true;
+        }
+        // a record cut short by a crash ends the segment
+        seg->discard();
+    }
+    return false;
+}
+
+void DiskSpool::pop() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    for (const auto& seg : Segments) {
+        if (!seg->empty()) {
+            seg->pop();
+            break;
+        }
+    }
+    // remove segments that have been fully read, the newest segment is kept to append to
+    while (Segments.size() > 1 && Segments.front()->empty()) {
+        Segments.front()->remove();
+        Segments.pop_front();
+    }
+}
+
+bool DiskSpool::empty() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    return std::all_of(Segments.begin(), Segments.end(), [](const auto& seg) { return seg->empty(); });
+}
+
+uint64_t DiskSpool::dropped() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    return Dropped;
+}
+} // namespace libmexclass::opentelemetry::sdk
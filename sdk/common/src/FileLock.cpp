@@ -0,0 +1,54 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/FileLock.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace libmexclass::opentelemetry::sdk {
+bool FileLock::tryLock(const std::filesystem::path& path) {
+    unlock();
+#ifdef _WIN32
+    // opening without sharing fails while another handle has the file open
+    File = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+    return File != INVALID_HANDLE_VALUE;
+#else
+    Fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (Fd < 0) {
+        return false;
+    }
+    // flock locks belong to the open file, so a second lock in this process fails as well
+    if (flock(Fd, LOCK_EX | LOCK_NB) != 0) {
+        unlock();
+        return false;
+    }
+    return true;
+#endif
+}
+
+void FileLock::unlock() {
+#ifdef _WIN32
+    if (File != INVALID_HANDLE_VALUE) {
+        CloseHandle(File);
+    }
+    File = INVALID_HANDLE_VALUE;
+#else
+    if (Fd >= 0) {
+        ::close(Fd);
+    }
+    Fd = -1;
+#endif
+}
+
+bool FileLock::locked() const {
+#ifdef _WIN32
+    return File != INVALID_HANDLE_VALUE;
+#else
+    return Fd >= 0;
+#endif
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,174 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/FlightRecorderBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+const char BufferMagic[8] = {'O', 'T', 'M', 'F', 'L', 'I', 'G', 'H'};
+
+// each record starts with its uint32 length and a uint64 timestamp in nanoseconds since the epoch
+const size_t RecordHeaderSize = sizeof(uint32_t) + sizeof(uint64_t);
+
+uint64_t nowNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			    std::chrono::system_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+// Positions are byte counts since the ring was created, the offset into the ring is the position
+// modulo the capacity. Records from Head to Tail are valid.
+struct FlightRecorderBuffer::Header {
+    char Magic[8];
+    uint64_t Capacity;
+    uint64_t Head;
+    uint64_t Tail;
+};
+
+FlightRecorderBuffer::FlightRecorderBuffer(const FlightRecorderOptions& options) : Options(options) {
+    Options.buffer_size = (std::max)(Options.buffer_size, RecordHeaderSize + 1);
+    size_t total = sizeof(Header) + Options.buffer_size;
+    char* data = nullptr;
+    bool reopened = false;
+    if (!Options.filename.empty()) {
+        std::error_code ec;
+        uintmax_t existing = fs::file_size(Options.filename, ec);
+        // reuse a ring left by an earlier session if it has the same size
+        reopened = !ec && existing == total && File.open(Options.filename, total, false);
+        if (reopened || File.open(Options.filename, total, true)) {
+            data = File.data();
+        }
+    }
+    if (data == nullptr) {
+        // no file, or the file could not be mapped
+        reopened = false;
+        Memory.reset(new char[total]);
+        data = Memory.get();
+    }
+    Ring = data + sizeof(Header);
+    if (!reopened || !valid()) {
+        Header* h = header();
+        std::memcpy(h->Magic, BufferMagic, sizeof(BufferMagic));
+        h->Capacity = Options.buffer_size;
+        h->Head = 0;
+        h->Tail = 0;
+    }
+}
+
+FlightRecorderBuffer::~FlightRecorderBuffer() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    File.sync();
+}
+
+FlightRecorderBuffer::Header* FlightRecorderBuffer::header() const {
+    return reinterpret_cast<Header*>(Ring - sizeof(Header));
+}
+
+bool FlightRecorderBuffer::valid() const {
+    const Header* h = header();
+    if (std::memcmp(h->Magic, BufferMagic, sizeof(BufferMagic)) != 0 || h->Capacity != Options.buffer_size
+		    || h->Tail < h->Head || h->Tail - h->Head > h->Capacity) {
+        return false;
+    }
+    // the records must end exactly at the tail
+    uint64_t pos = h->Head;
+    while (pos + RecordHeaderSize <= h->Tail) {
+        uint32_t len;
+        read(pos, reinterpret_cast<char*>(&len), sizeof(len));
+        pos += RecordHeaderSize + len;
+    }
+    return pos == h->Tail;
+}
+
+void FlightRecorderBuffer::write(uint64_t pos, const char* data, size_t len) {
+    size_t capacity = Options.buffer_size;
+    size_t offset = static_cast<size_t>(pos % capacity);
+    size_t first = (std::min)(len, capacity - offset);
+    std::memcpy(Ring + offset, data, first);
+    std::memcpy(Ring, data + first, len - first);
+}
+
+void FlightRecorderBuffer::read(uint64_t pos, char* data, size_t len) const {
+    size_t capacity = Options.buffer_size;
+    size_t offset = static_cast<size_t>(pos % capacity);
+    size_t first = (std::min)(len, capacity - offset);
+    std::memcpy(data, Ring + offset, first);
+    std::memcpy(data + first, Ring, len - first);
+}
+
+bool FlightRecorderBuffer::push(std::initializer_list<std::string_view> parts) {
+    size_t len = 0;
+    for (const auto& part : parts) {
+        len += part.size();
+    }
+    size_t needed = RecordHeaderSize + len;
+    if (needed > Options.buffer_size) {
+        return false;
+    }
+    uint32_t len32 = static_cast<uint32_t>(len);
+    uint64_t timestamp = nowNanoseconds();
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    Header* h = header();
+    // overwrite the oldest records, moving the head past them before their bytes are reused
+    while (Options.buffer_size - (h->Tail - h->Head) < needed) {
+        uint32_t oldest;
+        read(h->Head, reinterpret_cast<char*>(&oldest), sizeof(oldest));
+        h->Head += RecordHeaderSize + oldest;
+    }
+    uint64_t pos = h->Tail;
+    write(pos, reinterpret_cast<const char*>(&len32), sizeof(len32));
+    write(pos + sizeof(len32), reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+    pos += RecordHeaderSize;
+    for (const auto& part : parts) {
+        write(pos, part.data(), part.size());
+        pos += part.size();
+    }
+    // publish the record only after its bytes are in place
+    h->Tail = pos;
+    return true;
+}
+
+std::vector<std::string> FlightRecorderBuffer::take() {
+    uint64_t now = nowNanoseconds();
+    uint64_t maxage = static_cast<uint64_t>(Options.max_age.count());
+    std::vector<std::string> records;
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    Header* h = header();
+    for (uint64_t pos = h->Head; pos < h->Tail;) {
+        uint32_t len;
+        uint64_t timestamp;
+        read(pos, reinterpret_cast<char*>(&len), sizeof(len));
+        read(pos + sizeof(len), reinterpret_cast<char*>(&timestamp), sizeof(timestamp));
+        if (timestamp >= now || now - timestamp <= maxage) {
+            std::string record(len, '\0');
+            read(pos + RecordHeaderSize, record.data(), len);
+            records.push_back(std::move(record));
+        }
+        pos += RecordHeaderSize + len;
+    }
+    h->Head = h->Tail;
+    File.sync();
+    return records;
+}
+
+void appendProtoFieldHeader(std::string& out, uint32_t field, size_t length) {
+    // wire type 2 is length-delimited
+    uint64_t values[2] = {(static_cast<uint64_t>(field) << 3) | 2, static_cast<uint64_t>(length)};
+    for (uint64_t value : values) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+}
+} // namespace libmexclass::opentelemetry
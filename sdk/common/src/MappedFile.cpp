@@ -0,0 +1,87 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/MappedFile.h"
+
+#include <cstdint>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace libmexclass::opentelemetry::sdk {
+bool MappedFile::open(const std::filesystem::path& path, size_t size, bool create) {
+    close();
+#ifdef _WIN32
+    File = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+            create ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    // creating the mapping extends a new file to the full size
+    uint64_t size64 = size;
+    Mapping = CreateFileMappingW(File, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32),
+            static_cast<DWORD>(size64 & 0xFFFFFFFF), nullptr);
+    if (Mapping == nullptr) {
+        close();
+        return false;
+    }
+    Data = static_cast<char*>(MapViewOfFile(Mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+#else
+    Fd = ::open(path.c_str(), create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR, 0644);
+    if (Fd < 0) {
+        return false;
+    }
+    if (create && ftruncate(Fd, static_cast<off_t>(size)) != 0) {
+        close();
+        return false;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    Data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+#endif
+    Size = size;
+    if (Data == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (Data != nullptr) {
+        UnmapViewOfFile(Data);
+    }
+    if (Mapping != nullptr) {
+        CloseHandle(Mapping);
+    }
+    if (File != INVALID_HANDLE_VALUE) {
+        CloseHandle(File);
+    }
+    Mapping = nullptr;
+    File = INVALID_HANDLE_VALUE;
+#else
+    if (Data != nullptr) {
+        munmap(Data, Size);
+    }
+    if (Fd >= 0) {
+        ::close(Fd);
+    }
+    Fd = -1;
+#endif
+    Data = nullptr;
+    Size = 0;
+}
+
+void MappedFile::sync() {
+    if (Data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    FlushViewOfFile(Data, 0);
+#else
+    msync(Data, Size, MS_ASYNC);
+#endif
+}
+} // namespace libmexclass::opentelemetry
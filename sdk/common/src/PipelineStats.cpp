@@ -0,0 +1,135 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include "opentelemetry/context/context.h"
+#include "opentelemetry/metrics/observer_result.h"
+#include "opentelemetry/nostd/variant.h"
+
+namespace context_api = opentelemetry::context;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+// export duration bucket boundaries in milliseconds
+const std::array<double, 13> DurationBounds = {1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000};
+// batch size bucket boundaries
+const std::array<double, 13> BatchSizeBounds = {1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+} // namespace
+
+template <size_t NBounds>
+matlab::data::StructArray AtomicHistogram<NBounds>::toStruct(matlab::data::ArrayFactory& factory) const {
+    auto bounds = factory.createArray<double>({1, NBounds}, Bounds.data(), Bounds.data() + NBounds);
+    auto counts = factory.createArray<double>({1, NBounds + 1});
+    for (size_t i = 0; i <= NBounds; ++i) {
+        counts[0][i] = static_cast<double>(Counts[i].load(std::memory_order_relaxed));
+    }
+    matlab::data::StructArray result = factory.createStructArray({1, 1}, {"BucketBoundaries", "BucketCounts", "Count", "Sum"});
+    result[0]["BucketBoundaries"] = bounds;
+    result[0]["BucketCounts"] = counts;
+    result[0]["Count"] = factory.createScalar(static_cast<double>(Count.load(std::memory_order_relaxed)));
+    result[0]["Sum"] = factory.createScalar(Sum.load(std::memory_order_relaxed));
+    return result;
+}
+
+PipelineStats::PipelineStats(const std::string& signal, const std::string& component)
+	: Signal(signal), Component(component), ExportDuration(DurationBounds), BatchSize(BatchSizeBounds) {
+    Attributes["otel.signal"] = nostd::string_view(Signal);
+    Attributes["otel.component.type"] = nostd::string_view(Component);
+}
+
+PipelineStats::~PipelineStats() {
+    std::lock_guard<std::mutex> lock(PublicationMutex);
+    // stop meter providers from calling back into this object
+    for (auto& publication : Publications) {
+        for (auto& observation : publication.Observations) {
+            observation.Instrument->RemoveCallback(observe, static_cast<void*>(&observation));
+        }
+    }
+}
+
+void PipelineStats::recordExport(uint64_t n, bool success, std::chrono::steady_clock::duration elapsed) {
+    if (success) {
+        Exported.fetch_add(n, std::memory_order_relaxed);
+    } else {
+        Failed.fetch_add(n, std::memory_order_relaxed);
+    }
+    double elapsedms = std::chrono::duration<double, std::milli>(elapsed).count();
+    ExportDuration.record(elapsedms);
+    BatchSize.record(static_cast<double>(n));
+
+    std::lock_guard<std::mutex> lock(PublicationMutex);
+    for (auto& publication : Publications) {
+        publication.Duration->Record(elapsedms, Attributes, context_api::Context{});
+        publication.BatchSize->Record(n, Attributes, context_api::Context{});
+    }
+}
+
+uint64_t PipelineStats::queueDepth() const {
+    uint64_t accounted = Exported.load(std::memory_order_relaxed) + Failed.load(std::memory_order_relaxed) +
+        Dropped.load(std::memory_order_relaxed);
+    uint64_t enqueued = Enqueued.load(std::memory_order_relaxed);
+    return enqueued > accounted ? enqueued - accounted : 0;
+}
+
+uint64_t PipelineStats::value(Counter which) const {
+    switch (which) {
+        case Counter::Enqueued:
+            return Enqueued.load(std::memory_order_relaxed);
+        case Counter::Dropped:
+            return Dropped.load(std::memory_order_relaxed);
+        case Counter::Exported:
+            return Exported.load(std::memory_order_relaxed);
+        case Counter::Failed:
+            return Failed.load(std::memory_order_relaxed);
+        default:
+            return queueDepth();
+    }
+}
+
+matlab::data::StructArray PipelineStats::toStruct() const {
+    matlab::data::ArrayFactory factory;
+    matlab::data::StructArray result = factory.createStructArray({1, 1}, {"Enqueued", "Dropped",
+		    "Exported", "Failed", "QueueDepth", "ExportDuration", "BatchSize"});
+    result[0]["Enqueued"] = factory.createScalar(static_cast<double>(value(Counter::Enqueued)));
+    result[0]["Dropped"] = factory.createScalar(static_cast<double>(value(Counter::Dropped)));
+    result[0]["Exported"] = factory.createScalar(static_cast<double>(value(Counter::Exported)));
+    result[0]["Failed"] = factory.createScalar(static_cast<double>(value(Counter::Failed)));
+    result[0]["QueueDepth"] = factory.createScalar(static_cast<double>(value(Counter::QueueDepth)));
+    result[0]["ExportDuration"] = ExportDuration.toStruct(factory);
+    result[0]["BatchSize"] = BatchSize.toStruct(factory);
+    return result;
+}
+
+void PipelineStats::publish(nostd::shared_ptr<metrics_api::Meter> meter) {
+    std::lock_guard<std::mutex> lock(PublicationMutex);
+    Publications.emplace_back();
+    Publication& publication = Publications.back();
+    publication.Observations.reserve(5);
+    publication.Observations.push_back({this, Counter::Enqueued, meter->CreateInt64ObservableCounter(
+		    "otel.matlab.pipeline.enqueued", "Number of records accepted by the processor", "{record}")});
+    publication.Observations.push_back({this, Counter::Dropped, meter->CreateInt64ObservableCounter(
+		    "otel.matlab.pipeline.dropped", "Number of records dropped before reaching the exporter", "{record}")});
+    publication.Observations.push_back({this, Counter::Exported, meter->CreateInt64ObservableCounter(
+		    "otel.matlab.pipeline.exported", "Number of records successfully exported", "{record}")});
+    publication.Observations.push_back({this, Counter::Failed, meter->CreateInt64ObservableCounter(
+		    "otel.matlab.pipeline.failed", "Number of records whose export failed", "{record}")});
+    publication.Observations.push_back({this, Counter::QueueDepth, meter->CreateInt64ObservableUpDownCounter(
+		    "otel.matlab.pipeline.queue.size", "Number of records waiting to be exported", "{record}")});
+    for (auto& observation : publication.Observations) {
+        observation.Instrument->AddCallback(observe, static_cast<void*>(&observation));
+    }
+    publication.Duration = meter->CreateDoubleHistogram("otel.matlab.pipeline.export.duration",
+		    "Duration of export calls", "ms");
+    publication.BatchSize = meter->CreateUInt64Histogram("otel.matlab.pipeline.export.batch_size",
+		    "Number of records per export call", "{record}");
+}
+
+void PipelineStats::observe(metrics_api::ObserverResult result, void* state) {
+    auto observation = static_cast<Observation*>(state);
+    if (nostd::holds_alternative<nostd::shared_ptr<metrics_api::ObserverResultT<int64_t> > >(result)) {
+        nostd::get<nostd::shared_ptr<metrics_api::ObserverResultT<int64_t> > >(result)->Observe(
+		static_cast<int64_t>(observation->Stats->value(observation->Which)), observation->Stats->Attributes);
+    }
+}
+} // namespace libmexclass::opentelemetry
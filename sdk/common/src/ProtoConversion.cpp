@@ -0,0 +1,96 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/ProtoConversion.h"
+
+#include "opentelemetry/sdk/resource/resource.h"
+
+namespace otlp_proto = ::opentelemetry::proto::common::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+template <typename T, typename Getter>
+std::vector<T> convertArray(const otlp_proto::ArrayValue& array, Getter get) {
+    std::vector<T> result;
+    result.reserve(array.values_size());
+    for (const auto& element : array.values()) {
+        result.push_back(get(element));
+    }
+    return result;
+}
+} // namespace
+
+common_sdk::OwnedAttributeValue fromAnyValue(const otlp_proto::AnyValue& value) {
+    switch (value.value_case()) {
+        case otlp_proto::AnyValue::kBoolValue:
+            return value.bool_value();
+        case otlp_proto::AnyValue::kIntValue:
+            return static_cast<int64_t>(value.int_value());
+        case otlp_proto::AnyValue::kDoubleValue:
+            return value.double_value();
+        case otlp_proto::AnyValue::kStringValue:
+            return value.string_value();
+        case otlp_proto::AnyValue::kBytesValue:
+            return std::vector<uint8_t>(value.bytes_value().begin(), value.bytes_value().end());
+        case otlp_proto::AnyValue::kArrayValue: {
+            const otlp_proto::ArrayValue& array = value.array_value();
+            switch (array.values_size() > 0 ? array.values(0).value_case() : otlp_proto::AnyValue::kStringValue) {
+                case otlp_proto::AnyValue::kBoolValue:
+                    return convertArray<bool>(array, [](const otlp_proto::AnyValue& v) { return v.bool_value(); });
+                case otlp_proto::AnyValue::kIntValue:
+                    return convertArray<int64_t>(array, [](const otlp_proto::AnyValue& v) {
+                        return static_cast<int64_t>(v.int_value()); });
+                case otlp_proto::AnyValue::kDoubleValue:
+                    return convertArray<double>(array, [](const otlp_proto::AnyValue& v) { return v.double_value(); });
+                default:
+                    return convertArray<std::string>(array, [](const otlp_proto::AnyValue& v) { return v.string_value(); });
+            }
+        }
+        case otlp_proto::AnyValue::kKvlistValue:
+            return value.kvlist_value().ShortDebugString();
+        default:
+            return std::string();
+    }
+}
+
+ProtoAttributeList::ProtoAttributeList(const google::protobuf::RepeatedPtrField<otlp_proto::KeyValue>& keyvalues) {
+    Items.reserve(keyvalues.size());
+    for (const auto& kv : keyvalues) {
+        Owned.push_back(fromAnyValue(kv.value()));
+        Items.emplace_back(kv.key(), View(Owned.back()));
+    }
+}
+
+std::unique_ptr<resource::Resource> makeResource(const ::opentelemetry::proto::resource::v1::Resource& proto,
+                const std::string& schemaurl) {
+    ProtoAttributeList attrs(proto.attributes());
+    return std::make_unique<resource::Resource>(resource::Resource::Create(attrs.view(), schemaurl));
+}
+
+std::unique_ptr<instrumentationscope::InstrumentationScope> makeInstrumentationScope(
+                const otlp_proto::InstrumentationScope& proto, const std::string& schemaurl) {
+    ProtoAttributeList attrs(proto.attributes());
+    instrumentationscope::InstrumentationScopeAttributes scopeattrs;
+    for (const auto& [key, value] : attrs.entries()) {
+        scopeattrs.SetAttribute(key, value);
+    }
+    return instrumentationscope::InstrumentationScope::Create(proto.name(), proto.version(), schemaurl,
+                    std::move(scopeattrs));
+}
+
+trace_api::TraceId traceIdFromBytes(const std::string& bytes) {
+    if (bytes.size() != trace_api::TraceId::kSize) {
+        return trace_api::TraceId();
+    }
+    return trace_api::TraceId(nostd::span<const uint8_t, trace_api::TraceId::kSize>(
+                reinterpret_cast<const uint8_t*>(bytes.data()), trace_api::TraceId::kSize));
+}
+
+trace_api::SpanId spanIdFromBytes(const std::string& bytes) {
+    if (bytes.size() != trace_api::SpanId::kSize) {
+        return trace_api::SpanId();
+    }
+    return trace_api::SpanId(nostd::span<const uint8_t, trace_api::SpanId::kSize>(
+                reinterpret_cast<const uint8_t*>(bytes.data()), trace_api::SpanId::kSize));
+}
+} // namespace libmexclass::opentelemetry::sdk
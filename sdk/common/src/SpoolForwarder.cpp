@@ -0,0 +1,86 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include <algorithm>
+
+namespace libmexclass::opentelemetry::sdk {
+SpoolForwarder::SpoolForwarder(const SpoolOptions& options, DeliverFunction deliver)
+        : Spool(options), Deliver(std::move(deliver)),
+          InitialBackoff((std::max)(options.initial_backoff, std::chrono::milliseconds(1))),
+          MaxBackoff((std::max)(options.max_backoff, options.initial_backoff)) {
+    Worker = std::thread(&SpoolForwarder::run, this);
+}
+
+SpoolForwarder::~SpoolForwarder() {
+    stop();
+}
+
+bool SpoolForwarder::submit(const std::string& request) {
+    std::lock_guard<std::mutex> lock(DeliverMutex);
+    if (Spool.empty()) {
+        DeliveryResult result = Deliver(request);
+        if (result != DeliveryResult::Retry) {
+            return result == DeliveryResult::Delivered;
+        }
+    }
+    // spooled while delivery is still locked, so that the retry thread cannot send a later request
+    // first. It picks the request up after its backoff delay.
+    return Spool.append(request);
+}
+
+bool SpoolForwarder::drain(std::chrono::microseconds timeout) {
+    auto deadline = timeout == (std::chrono::microseconds::max)() ? (std::chrono::steady_clock::time_point::max)()
+            : std::chrono::steady_clock::now() + timeout;
+    std::string request;
+    std::lock_guard<std::mutex> lock(DeliverMutex);
+    while (Spool.front(request)) {
+        if (std::chrono::steady_clock::now() >= deadline || Deliver(request) == DeliveryResult::Retry) {
+            return false;
+        }
+        Spool.pop();
+    }
+    return true;
+}
+
+void SpoolForwarder::stop() {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (Stopping) {
+            return;
+        }
+        Stopping = true;
+    }
+    Wake.notify_all();
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+}
+
+void SpoolForwarder::run() {
+    std::chrono::milliseconds backoff = InitialBackoff;
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (!Wake.wait_for(lock, backoff, [this] { return Stopping.load(); })) {
+        lock.unlock();
+        bool delivered = true;
+        std::string request;
+        while (delivered && !Stopping.load()) {
+            std::lock_guard<std::mutex> deliverlock(DeliverMutex);
+            if (!Spool.front(request)) {
+                break;
+            }
+            // rejected requests are dropped, so that they do not hold up the rest of the spool
+            delivered = Deliver(request) != DeliveryResult::Retry;
+            if (delivered) {
+                Spool.pop();
+            }
+        }
+        // back off while the backend is unavailable
+        backoff = delivered ? InitialBackoff : (std::min)(backoff * 2, MaxBackoff);
+        lock.lock();
+        if (Stopping) {
+            break;
+        }
+    }
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,134 @@
+classdef FlightRecorderLogRecordProcessor < opentelemetry.sdk.logs.LogRecordProcessor
+% Flight recorder log record processor keeps recently emitted log records
+% in a fixed-size buffer and only passes them to an exporter when dumped,
+% either by calling dump or when a log record has the trigger severity.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        BufferSize (1,1) double = 4194304        % Size of the log record buffer in bytes
+        FileName (1,1) string = ""               % Memory-mapped file holding the buffer, "" to keep it in memory only
+        MaximumAge (1,1) duration = seconds(Inf) % Maximum age of log records included in a dump
+        TriggerSeverity (1,1) string = "fatal"   % Lowest severity of log records that cause a dump, or "none"
+    end
+
+    methods
+        function obj = FlightRecorderLogRecordProcessor(varargin)
+            % Flight recorder log record processor keeps recently emitted
+            % log records in a fixed-size buffer and only passes them to
+            % an exporter when dumped.
+            %    FLP = OPENTELEMETRY.SDK.LOGS.FLIGHTRECORDERLOGRECORDPROCESSOR creates a
+            %    flight recorder log record processor that uses an OTLP HTTP exporter, which
+            %    exports log records in OpenTelemetry Protocol (OTLP) format through HTTP.
+            %
+            %    FLP = OPENTELEMETRY.SDK.LOGS.FLIGHTRECORDERLOGRECORDPROCESSOR(EXP) specifies
+            %    the log record exporter.
+            %
+            %    FLP = OPENTELEMETRY.SDK.LOGS.FLIGHTRECORDERLOGRECORDPROCESSOR(..., PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Parameters are:
+            %       "BufferSize"        - Size of the log record buffer in
+            %                             bytes, measured in OTLP encoded
+            %                             size.
+            %                             When the buffer is full, the
+            %                             oldest log records are
+            %                             overwritten.
+            %                             Default is 4 MB.
+            %       "FileName"          - File that holds the buffer as a
+            %                             memory-mapped file. Log records
+            %                             in the file survive a crash and are
+            %                             included in the next dump of a
+            %                             processor that uses the same
+            %                             file. Default is "", which keeps
+            %                             the buffer in memory only.
+            %       "MaximumAge"        - Only log records emitted within
+            %                             this time before a dump are
+            %                             exported.
+            %                             Default is Inf.
+            %       "TriggerSeverity"   - Lowest severity of log records
+            %                             that cause a dump, one of
+            %                             "trace", "debug", "info", "warn",
+            %                             "error", "fatal" (default), or
+            %                             "none" to never cause a dump.
+            %
+            %    See also DUMP, OPENTELEMETRY.SDK.LOGS.SIMPLELOGRECORDPROCESSOR,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPLOGRECORDEXPORTER,
+            %    OPENTELEMETRY.SDK.LOGS.LOGGERPROVIDER
+
+            if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.logs.LogRecordExporter")
+                exporter = opentelemetry.exporters.otlp.defaultLogRecordExporter;
+            else   % isa(varargin{1}, "opentelemetry.sdk.logs.LogRecordExporter")
+                exporter = varargin{1};
+                varargin(1) = [];
+            end
+            obj = obj@opentelemetry.sdk.logs.LogRecordProcessor(exporter, ...
+                "libmexclass.opentelemetry.sdk.FlightRecorderLogRecordProcessorProxy");
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function success = dump(obj)
+            % DUMP Export the log records in the buffer.
+            %    SUCCESS = DUMP(FLP) passes the log records in the buffer to the
+            %    exporter and clears the buffer. SUCCESS is true if the
+            %    export succeeded.
+            %
+            %    See also OPENTELEMETRY.SDK.LOGS.LOGGERPROVIDER/FORCEFLUSH
+            success = obj.Proxy.dump();
+        end
+
+        function obj = set.BufferSize(obj, bufsize)
+            if ~isnumeric(bufsize) || ~isscalar(bufsize) || bufsize <= 0 || ...
+                    round(bufsize) ~= bufsize
+                error("opentelemetry:sdk:logs:FlightRecorderLogRecordProcessor:InvalidBufferSize", ...
+                    "BufferSize must be a scalar positive integer.");
+            end
+            bufsize = double(bufsize);
+            obj.Proxy.setBufferSize(bufsize);
+            obj.BufferSize = bufsize;
+        end
+
+        function obj = set.FileName(obj, filename)
+            if ~(isStringScalar(filename) || (ischar(filename) && (isrow(filename) || isempty(filename))))
+                error("opentelemetry:sdk:logs:FlightRecorderLogRecordProcessor:InvalidFileName", ...
+                    "FileName must be a string scalar.");
+            end
+            filename = string(filename);
+            obj.Proxy.setFileName(filename);
+            obj.FileName = filename;
+        end
+
+        function obj = set.MaximumAge(obj, maxage)
+            if ~isduration(maxage) || ~isscalar(maxage) || maxage <= 0
+                error("opentelemetry:sdk:logs:FlightRecorderLogRecordProcessor:InvalidMaximumAge", ...
+                    "MaximumAge must be a positive duration scalar.");
+            end
+            obj.Proxy.setMaximumAge(milliseconds(maxage));
+            obj.MaximumAge = maxage;
+        end
+
+        function obj = set.TriggerSeverity(obj, severity)
+            severity = validatestring(severity, ["trace" "debug" "info" "warn" "error" "fatal" "none"]);
+            obj.Proxy.setTriggerSeverity(severity);
+            obj.TriggerSeverity = severity;
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = ["BufferSize", "FileName", "MaximumAge", "TriggerSeverity"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+    end
+end
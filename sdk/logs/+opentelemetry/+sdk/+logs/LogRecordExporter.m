@@ -6,7 +6,10 @@ classdef LogRecordExporter < handle
     properties (GetAccess={?opentelemetry.sdk.logs.LogRecordProcessor, ...
             ?opentelemetry.exporters.otlp.OtlpHttpLogRecordExporter, ...
             ?opentelemetry.exporters.otlp.OtlpGrpcLogRecordExporter, ...
-            ?opentelemetry.exporters.otlp.OtlpFileLogRecordExporter})
+            ?opentelemetry.exporters.otlp.OtlpFileLogRecordExporter, ...
+            ?opentelemetry.exporters.otlp.OtlpFileReplayer, ...
+            ?opentelemetry.exporters.parquet.ParquetLogRecordExporter, ...
+            ?opentelemetry.sdk.logs.SpoolLogRecordExporter})
         Proxy   % Proxy object to interface C++ code
     end
 
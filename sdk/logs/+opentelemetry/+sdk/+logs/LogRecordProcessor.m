@@ -4,7 +4,9 @@ classdef LogRecordProcessor < matlab.mixin.Heterogeneous & handle
 % Copyright 2024-2026 The MathWorks, Inc.
 
     properties (GetAccess={?opentelemetry.sdk.logs.LoggerProvider,...
-		    ?opentelemetry.sdk.logs.BatchLogRecordProcessor})
+		    ?opentelemetry.sdk.logs.BatchLogRecordProcessor,...
+		    ?opentelemetry.sdk.logs.RingBufferLogRecordProcessor,...
+		    ?opentelemetry.sdk.logs.FlightRecorderLogRecordProcessor})
         Proxy  % Proxy object to interface C++ code
     end
 
@@ -23,4 +25,33 @@ classdef LogRecordProcessor < matlab.mixin.Heterogeneous & handle
             obj.LogRecordExporter = exporter;
         end
     end
+
+    methods
+        function stats = getStats(obj)
+            % GETSTATS Statistics of the log record export pipeline.
+            %    STATS = GETSTATS(LP) returns a struct with the number of
+            %    log records enqueued, dropped before export, exported,
+            %    and failed to export, the number of log records waiting
+            %    to be exported, and histograms of export durations in
+            %    milliseconds and export batch sizes. Statistics are
+            %    collected after the log record processor is added to a
+            %    logger provider.
+            %
+            %    See also PUBLISHSTATS
+            stats = obj.Proxy.getStats();
+        end
+
+        function publishStats(obj, mp)
+            % PUBLISHSTATS Publish statistics of the log record export pipeline as metrics.
+            %    PUBLISHSTATS(LP, MP) publishes the statistics returned by
+            %    GETSTATS as metrics through SDK meter provider MP.
+            %
+            %    See also GETSTATS, OPENTELEMETRY.SDK.METRICS.METERPROVIDER
+            arguments
+                obj
+                mp (1,1) opentelemetry.sdk.metrics.MeterProvider
+            end
+            obj.Proxy.publishStats(getProxyID(mp));
+        end
+    end
 end
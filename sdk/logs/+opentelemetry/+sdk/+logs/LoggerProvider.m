@@ -2,7 +2,7 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
     % An SDK implementation of logger provider, which stores a set of configurations used
     % in a logging system.
 
-    % Copyright 2024-2025 The MathWorks, Inc.
+    % Copyright 2024-2026 The MathWorks, Inc.
 
     properties(Access=private)
         isShutdown (1,1) logical = false
@@ -11,6 +11,7 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
     properties (SetAccess=private)
         LogRecordProcessor   % Whether logs should be sent immediately or batched
         Resource             % Attributes attached to all logs
+        ArraySummaryThreshold = Inf   % Numeric array attributes with more elements are summarized
     end
 
     methods
@@ -27,6 +28,9 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
             %    Parameters are:
             %       "Resource"    - Additional resource attributes.
             %                       Specified as a dictionary.
+            %       "ArraySummaryThreshold" - Numeric array attributes with
+            %                       more elements are replaced by summary
+            %                       statistics. Default is Inf. 
             %
             %    See also OPENTELEMETRY.SDK.LOGS.SIMPLELOGRECORDPROCESSOR, 
             %    OPENTELEMETRY.SDK.LOGS.BATCHLOGRECORDPROCESSOR
@@ -119,7 +123,8 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
                 optionvalues
             end
 
-            validnames = "Resource";
+            validnames = ["Resource", "ArraySummaryThreshold"];
+            threshold = Inf;
             resourcekeys = string.empty();
             resourcevalues = {};
 
@@ -140,6 +145,13 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
                     if all(cellfun(@iscell, resourcevalues))
                         resourcevalues = [resourcevalues{:}];
                     end
+                else  % "ArraySummaryThreshold"
+                    if ~(isnumeric(valuei) && isscalar(valuei) && isreal(valuei) && valuei >= 0 && ...
+                            (valuei == round(valuei) || isinf(valuei)))
+                        error("opentelemetry:sdk:logs:LoggerProvider:InvalidArraySummaryThreshold", ...
+                            "ArraySummaryThreshold must be a nonnegative integer or Inf.");
+                    end
+                    threshold = double(valuei);
                 end
             end
 
@@ -150,8 +162,10 @@ classdef LoggerProvider < opentelemetry.logs.LoggerProvider & handle
                 "libmexclass.opentelemetry.sdk.LoggerProviderProxy", ...
                 "ConstructorArguments", {processor.Proxy.ID, resourcekeys, ...
                 resourcevalues});
+            obj.Proxy.setArraySummaryThreshold(threshold);
             obj.LogRecordProcessor = processor;
             obj.Resource = resource;
+            obj.ArraySummaryThreshold = threshold;
         end
     end
 end
@@ -0,0 +1,77 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/FlightRecorderBuffer.h"
+
+#include "opentelemetry/sdk/logs/processor.h"
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Keeps recently emitted log records in a flight recorder buffer and exports them only when
+// dumped. Records are stored as OTLP encoded ResourceLogs, reusing the encoding of their resource
+// and scope.
+class LogFlightRecorder {
+  public:
+    LogFlightRecorder(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter, const FlightRecorderOptions& options);
+
+    // Store a log record created by MakeRecordable. Returns its severity number.
+    int record(std::unique_ptr<logs_sdk::Recordable>&& logrecord);
+
+    // Export the recorded log records and clear the buffer
+    bool dump();
+
+    // Forget the encodings of resources and scopes, which are only valid while the log record
+    // processor that recorded their log records is running
+    void clearEncodings();
+
+    logs_sdk::LogRecordExporter& exporter() {
+        return *Exporter;
+    }
+
+  private:
+    std::unique_ptr<logs_sdk::LogRecordExporter> Exporter;
+    FlightRecorderBuffer Buffer;
+    std::mutex ExportMutex;
+    std::mutex EncodingMutex;
+    // encoded ResourceLogs and ScopeLogs without their log records, by address of resource and
+    // scope. Cleared on every dump and when a processor shuts down, so that addresses are not
+    // reused by other objects while entries refer to them.
+    std::map<std::pair<const void*, const void*>, std::pair<std::string, std::string> > Encodings;
+};
+
+// Log record processor that records emitted log records in a LogFlightRecorder, and dumps it
+// when a log record has at least the trigger severity
+class FlightRecorderLogRecordProcessor : public logs_sdk::LogRecordProcessor {
+  public:
+    // a trigger severity of 0 turns the trigger off
+    FlightRecorderLogRecordProcessor(std::shared_ptr<LogFlightRecorder> recorder, int trigger_severity)
+	    : Recorder(std::move(recorder)), TriggerSeverity(trigger_severity) {}
+
+    ~FlightRecorderLogRecordProcessor() override;
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnEmit(std::unique_ptr<logs_sdk::Recordable>&& record) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    std::shared_ptr<LogFlightRecorder> Recorder;
+    int TriggerSeverity;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
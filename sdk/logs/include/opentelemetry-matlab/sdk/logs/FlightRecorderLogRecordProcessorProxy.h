@@ -0,0 +1,41 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/logs/LogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/FlightRecorderLogRecordProcessor.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/logs/processor.h"
+
+#include <vector>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+class FlightRecorderLogRecordProcessorProxy : public LogRecordProcessorProxy {
+  public:
+    FlightRecorderLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter);
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<logs_sdk::LogRecordProcessor> getInstance() override;
+
+    void setBufferSize(libmexclass::proxy::method::Context& context);
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+    void setMaximumAge(libmexclass::proxy::method::Context& context);
+
+    void setTriggerSeverity(libmexclass::proxy::method::Context& context);
+
+    void dump(libmexclass::proxy::method::Context& context);
+
+  private:
+    FlightRecorderOptions CppOptions;
+    int TriggerSeverity = 21;   // SEVERITY_NUMBER_FATAL
+    std::vector<std::weak_ptr<LogFlightRecorder> > Recorders;   // one per logger provider
+};
+} // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -12,5 +12,10 @@ namespace libmexclass::opentelemetry::sdk {
 class LogRecordExporterProxy : public libmexclass::proxy::Proxy {
   public:
     virtual std::unique_ptr<logs_sdk::LogRecordExporter> getInstance() = 0;
+
+    // whether Export returns before the data is sent, without reporting whether sending failed
+    virtual bool exportsAsynchronously() const {
+        return false;
+    }
 };
 } // namespace libmexclass::opentelemetry
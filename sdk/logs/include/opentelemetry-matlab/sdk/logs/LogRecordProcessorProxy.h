@@ -1,11 +1,13 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
 #include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
 
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/ProxyManager.h"
+#include "libmexclass/proxy/method/Context.h"
 
 #include "opentelemetry/sdk/logs/processor.h"
 
@@ -16,9 +18,24 @@ class LogRecordProcessorProxy : public libmexclass::proxy::Proxy {
   public:
     virtual std::unique_ptr<logs_sdk::LogRecordProcessor> getInstance() = 0;
 
+    void getStats(libmexclass::proxy::method::Context& context);
+
+    void publishStats(libmexclass::proxy::method::Context& context);
+
   protected:
-    LogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter) : LogRecordExporter(exporter) {}
+    // component is the processor class name reported with the pipeline statistics
+    LogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter, const std::string& component);
+
+    // wrap an exporter so that its exports are counted in the pipeline statistics
+    std::unique_ptr<logs_sdk::LogRecordExporter> wrapExporter(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter);
+
+    // wrap a processor so that emitted log records are counted in the pipeline statistics. If countrejected
+    // is set, log records the processor does not take ownership of are counted as dropped.
+    std::unique_ptr<logs_sdk::LogRecordProcessor> wrapProcessor(std::unique_ptr<logs_sdk::LogRecordProcessor>&& processor,
+		    bool countrejected = false);
 
     std::shared_ptr<LogRecordExporterProxy> LogRecordExporter;
+
+    std::shared_ptr<PipelineStats> Stats;
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -14,14 +14,19 @@ class LoggerProviderProxy : public libmexclass::opentelemetry::LoggerProviderPro
         REGISTER_METHOD(LoggerProviderProxy, addProcessor);
         REGISTER_METHOD(LoggerProviderProxy, shutdown);
         REGISTER_METHOD(LoggerProviderProxy, forceFlush);
+        REGISTER_METHOD(LoggerProviderProxy, setArraySummaryThreshold);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
+    ~LoggerProviderProxy();
+
     void addProcessor(libmexclass::proxy::method::Context& context);
 
     void shutdown(libmexclass::proxy::method::Context& context);
 
     void forceFlush(libmexclass::proxy::method::Context& context);
+
+    void setArraySummaryThreshold(libmexclass::proxy::method::Context& context);
 };
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,22 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/logs/v1/logs_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Export the log records in an OTLP request through an exporter, by converting them into
+// recordables created by the exporter
+::opentelemetry::sdk::common::ExportResult exportLogsRequest(
+		const ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request,
+		logs_sdk::LogRecordExporter& exporter);
+
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,40 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/BatchExportQueue.h"
+
+#include "opentelemetry/sdk/logs/processor.h"
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Batch log record processor built on a lock-free ring buffer, with a choice of what to do when
+// the queue is full and an optional byte budget for the queue
+class RingBufferLogRecordProcessor : public logs_sdk::LogRecordProcessor {
+  public:
+    RingBufferLogRecordProcessor(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter,
+		    const BatchExportQueueOptions& options, std::shared_ptr<PipelineStats> stats = nullptr);
+
+    ~RingBufferLogRecordProcessor() override;
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnEmit(std::unique_ptr<logs_sdk::Recordable>&& record) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    std::unique_ptr<logs_sdk::LogRecordExporter> Exporter;
+    std::unique_ptr<BatchExportQueue<logs_sdk::Recordable> > Queue;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
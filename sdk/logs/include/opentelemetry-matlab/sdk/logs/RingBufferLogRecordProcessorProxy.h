@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/logs/LogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/common/BatchExportQueue.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/logs/processor.h"
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+class RingBufferLogRecordProcessorProxy : public LogRecordProcessorProxy {
+  public:
+    RingBufferLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter);
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<logs_sdk::LogRecordProcessor> getInstance() override;
+
+    void setMaximumQueueSize(libmexclass::proxy::method::Context& context);
+
+    void setMaximumQueueBytes(libmexclass::proxy::method::Context& context);
+
+    void setScheduledDelay(libmexclass::proxy::method::Context& context);
+
+    void setMaximumExportBatchSize(libmexclass::proxy::method::Context& context);
+
+    void setFullQueuePolicy(libmexclass::proxy::method::Context& context);
+
+    void setBlockTimeout(libmexclass::proxy::method::Context& context);
+
+  private:
+    BatchExportQueueOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry
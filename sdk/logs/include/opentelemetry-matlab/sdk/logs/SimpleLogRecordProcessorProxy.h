@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -15,12 +15,12 @@ namespace libmexclass::opentelemetry::sdk {
 class SimpleLogRecordProcessorProxy : public LogRecordProcessorProxy {
   public:
     SimpleLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter) 
-	    : LogRecordProcessorProxy(exporter) {}
+	    : LogRecordProcessorProxy(exporter, "SimpleLogRecordProcessor") {}
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<logs_sdk::LogRecordProcessor> getInstance() override {
-        return logs_sdk::SimpleLogRecordProcessorFactory::Create(std::move(LogRecordExporter->getInstance()));
+        return wrapProcessor(logs_sdk::SimpleLogRecordProcessorFactory::Create(wrapExporter(LogRecordExporter->getInstance())));
     }
 };
 } // namespace libmexclass::opentelemetry
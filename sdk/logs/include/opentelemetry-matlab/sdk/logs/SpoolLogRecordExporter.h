@@ -0,0 +1,42 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Log record exporter wrapper that stores batches in a disk spool while the wrapped exporter fails,
+// and replays them once it succeeds again. Batches are kept as serialized OTLP requests, which
+// are converted back into recordables of the wrapped exporter when they are sent.
+class SpoolLogRecordExporter : public logs_sdk::LogRecordExporter {
+  public:
+    SpoolLogRecordExporter(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter, const SpoolOptions& options);
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+                    const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    DeliveryResult deliver(const std::string& request);
+
+    std::unique_ptr<logs_sdk::LogRecordExporter> Exporter;
+    SpoolForwarder Forwarder;    // declared after Exporter, so that it stops first
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry::sdk
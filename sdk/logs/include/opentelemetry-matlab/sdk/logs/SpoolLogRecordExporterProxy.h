@@ -0,0 +1,44 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/logs/exporter.h"
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+
+namespace libmexclass::opentelemetry::sdk {
+class SpoolLogRecordExporterProxy : public LogRecordExporterProxy {
+  public:
+    SpoolLogRecordExporterProxy(std::shared_ptr<LogRecordExporterProxy> exporter) : WrappedExporter(std::move(exporter)) {
+        REGISTER_METHOD(SpoolLogRecordExporterProxy, setDirectory);
+        REGISTER_METHOD(SpoolLogRecordExporterProxy, setSegmentSize);
+        REGISTER_METHOD(SpoolLogRecordExporterProxy, setMaxDiskUsage);
+        REGISTER_METHOD(SpoolLogRecordExporterProxy, setInitialBackoff);
+        REGISTER_METHOD(SpoolLogRecordExporterProxy, setMaxBackoff);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<logs_sdk::LogRecordExporter> getInstance() override;
+
+    void setDirectory(libmexclass::proxy::method::Context& context);
+
+    void setSegmentSize(libmexclass::proxy::method::Context& context);
+
+    void setMaxDiskUsage(libmexclass::proxy::method::Context& context);
+
+    void setInitialBackoff(libmexclass::proxy::method::Context& context);
+
+    void setMaxBackoff(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::shared_ptr<LogRecordExporterProxy> WrappedExporter;
+    SpoolOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,78 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include "opentelemetry/sdk/logs/processor.h"
+#include "opentelemetry/sdk/logs/exporter.h"
+
+#include <chrono>
+#include <memory>
+
+namespace logs_sdk = opentelemetry::sdk::logs;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Log record exporter wrapper that records the number, outcome, and duration of exports
+class StatsLogRecordExporter : public logs_sdk::LogRecordExporter {
+  public:
+    StatsLogRecordExporter(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter, std::shared_ptr<PipelineStats> stats)
+        : Exporter(std::move(exporter)), Stats(std::move(stats)) {}
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override {
+        return Exporter->MakeRecordable();
+    }
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->ForceFlush(timeout);
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->Shutdown(timeout);
+    }
+
+  private:
+    std::unique_ptr<logs_sdk::LogRecordExporter> Exporter;
+    std::shared_ptr<PipelineStats> Stats;
+};
+
+// Log record processor wrapper that counts emitted log records. The stock batch processor leaves
+// a log record it rejects in the caller's pointer, so with countrejected set, a log record still
+// present after OnEmit is counted as dropped.
+class StatsLogRecordProcessor : public logs_sdk::LogRecordProcessor {
+  public:
+    StatsLogRecordProcessor(std::unique_ptr<logs_sdk::LogRecordProcessor>&& processor, std::shared_ptr<PipelineStats> stats,
+		    bool countrejected = false)
+        : Processor(std::move(processor)), Stats(std::move(stats)), CountRejected(countrejected) {}
+
+    std::unique_ptr<logs_sdk::Recordable> MakeRecordable() noexcept override {
+        return Processor->MakeRecordable();
+    }
+
+    void OnEmit(std::unique_ptr<logs_sdk::Recordable>&& record) noexcept override {
+        Stats->recordEnqueued(1);
+        Processor->OnEmit(std::move(record));
+        if (CountRejected && record) {
+            Stats->recordDropped(1);
+        }
+    }
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Processor->ForceFlush(timeout);
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Processor->Shutdown(timeout);
+    }
+
+  private:
+    std::unique_ptr<logs_sdk::LogRecordProcessor> Processor;
+    std::shared_ptr<PipelineStats> Stats;
+    const bool CountRejected;
+};
+} // namespace libmexclass::opentelemetry
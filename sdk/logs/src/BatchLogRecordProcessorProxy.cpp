@@ -1,4 +1,4 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/sdk/logs/BatchLogRecordProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
@@ -9,7 +9,7 @@
 
 namespace libmexclass::opentelemetry::sdk {
 BatchLogRecordProcessorProxy::BatchLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter)
-	: LogRecordProcessorProxy(exporter) {
+	: LogRecordProcessorProxy(exporter, "BatchLogRecordProcessor") {
     REGISTER_METHOD(BatchLogRecordProcessorProxy, setMaximumQueueSize);
     REGISTER_METHOD(BatchLogRecordProcessorProxy, setScheduledDelay);
     REGISTER_METHOD(BatchLogRecordProcessorProxy, setMaximumExportBatchSize);
@@ -24,7 +24,7 @@ libmexclass::proxy::MakeResult BatchLogRecordProcessorProxy::make(const libmexcl
 }
 
 std::unique_ptr<logs_sdk::LogRecordProcessor> BatchLogRecordProcessorProxy::getInstance() {
-    return logs_sdk::BatchLogRecordProcessorFactory::Create(std::move(LogRecordExporter->getInstance()), CppOptions);
+    return wrapProcessor(logs_sdk::BatchLogRecordProcessorFactory::Create(wrapExporter(LogRecordExporter->getInstance()), CppOptions), true);
 }
 
 void BatchLogRecordProcessorProxy::setMaximumQueueSize(libmexclass::proxy::method::Context& context) {
@@ -0,0 +1,143 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/FlightRecorderLogRecordProcessor.h"
+#include "opentelemetry-matlab/sdk/logs/LogsRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+#include "opentelemetry/nostd/span.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+namespace logs_proto = ::opentelemetry::proto::logs::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+LogFlightRecorder::LogFlightRecorder(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter,
+		const FlightRecorderOptions& options) : Exporter(std::move(exporter)), Buffer(options) {}
+
+int LogFlightRecorder::record(std::unique_ptr<logs_sdk::Recordable>&& logrecord) {
+    auto otlprecord = dynamic_cast<otlp_exporter::OtlpLogRecordable*>(logrecord.get());
+    if (otlprecord == nullptr) {
+        return 0;
+    }
+    int severity = static_cast<int>(otlprecord->log_record().severity_number());
+    auto key = std::make_pair(static_cast<const void*>(&otlprecord->GetResource()),
+		    static_cast<const void*>(&otlprecord->GetInstrumentationScope()));
+
+    std::unique_lock<std::mutex> lock(EncodingMutex);
+    auto found = Encodings.find(key);
+    if (found != Encodings.end()) {
+        std::string resourcepart = found->second.first;
+        std::string scopepart = found->second.second;
+        lock.unlock();
+        std::string recordbytes = otlprecord->log_record().SerializeAsString();
+        std::string recordheader, scopeheader;
+        appendProtoFieldHeader(recordheader, 2, recordbytes.size());    // ScopeLogs.log_records
+        appendProtoFieldHeader(scopeheader, 2, scopepart.size() + recordheader.size() + recordbytes.size());  // ResourceLogs.scope_logs
+        Buffer.push({resourcepart, scopeheader, scopepart, recordheader, recordbytes});
+        return severity;
+    }
+
+    // first log record of this resource and scope, encode it in full and keep the resource and scope
+    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(
+		    nostd::span<std::unique_ptr<logs_sdk::Recordable> >(&logrecord, 1), &request);
+    if (request.resource_logs_size() == 0) {
+        return severity;
+    }
+    logs_proto::ResourceLogs& resourcelogs = *request.mutable_resource_logs(0);
+    Buffer.push({resourcelogs.SerializeAsString()});
+    if (resourcelogs.scope_logs_size() > 0) {
+        logs_proto::ScopeLogs scopelogs = resourcelogs.scope_logs(0);
+        scopelogs.clear_log_records();
+        resourcelogs.clear_scope_logs();
+        Encodings.emplace(key, std::make_pair(resourcelogs.SerializeAsString(), scopelogs.SerializeAsString()));
+    }
+    return severity;
+}
+
+bool LogFlightRecorder::dump() {
+    // one dump at a time, so that log records are exported in the order they were emitted
+    std::lock_guard<std::mutex> lock(ExportMutex);
+    std::vector<std::string> records = Buffer.take();
+    clearEncodings();
+    if (records.empty()) {
+        return true;
+    }
+    // regroup the log records by resource and scope
+    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest request;
+    std::unordered_map<std::string, logs_proto::ResourceLogs*> resources;
+    std::unordered_map<std::string, logs_proto::ScopeLogs*> scopes;
+    for (const auto& record : records) {
+        logs_proto::ResourceLogs entry;
+        if (!entry.ParseFromString(record)) {
+            continue;
+        }
+        std::string resourcekey = entry.resource().SerializeAsString() + '\0' + entry.schema_url();
+        logs_proto::ResourceLogs*& resource = resources[resourcekey];
+        if (resource == nullptr) {
+            resource = request.add_resource_logs();
+            *resource->mutable_resource() = entry.resource();
+            resource->set_schema_url(entry.schema_url());
+        }
+        for (auto& scopeentry : *entry.mutable_scope_logs()) {
+            std::string scopekey = resourcekey + '\0' + scopeentry.scope().SerializeAsString() + '\0' + scopeentry.schema_url();
+            logs_proto::ScopeLogs*& scope = scopes[scopekey];
+            if (scope == nullptr) {
+                scope = resource->add_scope_logs();
+                *scope->mutable_scope() = scopeentry.scope();
+                scope->set_schema_url(scopeentry.schema_url());
+            }
+            for (auto& item : *scopeentry.mutable_log_records()) {
+                *scope->add_log_records() = std::move(item);
+            }
+        }
+    }
+    return exportLogsRequest(request, *Exporter) == common_sdk::ExportResult::kSuccess;
+}
+
+void LogFlightRecorder::clearEncodings() {
+    std::lock_guard<std::mutex> lock(EncodingMutex);
+    Encodings.clear();
+}
+
+FlightRecorderLogRecordProcessor::~FlightRecorderLogRecordProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<logs_sdk::Recordable> FlightRecorderLogRecordProcessor::MakeRecordable() noexcept {
+    return std::unique_ptr<logs_sdk::Recordable>(new otlp_exporter::OtlpLogRecordable());
+}
+
+void FlightRecorderLogRecordProcessor::OnEmit(std::unique_ptr<logs_sdk::Recordable>&& record) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !record) {
+        return;
+    }
+    int severity = Recorder->record(std::move(record));
+    if (TriggerSeverity > 0 && severity >= TriggerSeverity) {
+        Recorder->dump();
+    }
+}
+
+bool FlightRecorderLogRecordProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // recorded log records are only exported by a dump
+    return Recorder->exporter().ForceFlush(timeout);
+}
+
+bool FlightRecorderLogRecordProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    // log records still recorded are kept, in the recording file if there is one, but the
+    // resource and scopes of this processor's provider go away
+    Recorder->clearEncodings();
+    return Recorder->exporter().Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry
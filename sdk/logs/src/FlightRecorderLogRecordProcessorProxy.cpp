@@ -0,0 +1,94 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/FlightRecorderLogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+FlightRecorderLogRecordProcessorProxy::FlightRecorderLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter)
+	: LogRecordProcessorProxy(exporter, "FlightRecorderLogRecordProcessor") {
+    REGISTER_METHOD(FlightRecorderLogRecordProcessorProxy, setBufferSize);
+    REGISTER_METHOD(FlightRecorderLogRecordProcessorProxy, setFileName);
+    REGISTER_METHOD(FlightRecorderLogRecordProcessorProxy, setMaximumAge);
+    REGISTER_METHOD(FlightRecorderLogRecordProcessorProxy, setTriggerSeverity);
+    REGISTER_METHOD(FlightRecorderLogRecordProcessorProxy, dump);
+}
+
+libmexclass::proxy::MakeResult FlightRecorderLogRecordProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    std::shared_ptr<LogRecordExporterProxy> exporter = std::static_pointer_cast<LogRecordExporterProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    return std::make_shared<FlightRecorderLogRecordProcessorProxy>(exporter);
+}
+
+std::unique_ptr<logs_sdk::LogRecordProcessor> FlightRecorderLogRecordProcessorProxy::getInstance() {
+    auto recorder = std::make_shared<LogFlightRecorder>(wrapExporter(LogRecordExporter->getInstance()), CppOptions);
+    Recorders.push_back(recorder);
+    return wrapProcessor(std::unique_ptr<logs_sdk::LogRecordProcessor>(new FlightRecorderLogRecordProcessor(
+		    recorder, TriggerSeverity)));
+}
+
+void FlightRecorderLogRecordProcessorProxy::setBufferSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> bufsize_mda = context.inputs[0];
+    double bufsize = bufsize_mda[0];
+    if (bufsize > 0) {
+        CppOptions.buffer_size = static_cast<size_t>(bufsize);
+    }
+}
+
+void FlightRecorderLogRecordProcessorProxy::setFileName(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filename_mda = context.inputs[0];
+    CppOptions.filename = static_cast<std::string>(filename_mda[0]);
+}
+
+void FlightRecorderLogRecordProcessorProxy::setMaximumAge(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxage_mda = context.inputs[0];
+    double maxage = maxage_mda[0];
+    // Inf means no age limit
+    if (maxage >= 0) {
+        CppOptions.max_age = std::isinf(maxage) ? (std::chrono::nanoseconds::max)()
+		: std::chrono::nanoseconds(static_cast<int64_t>(maxage * 1e6));
+    }
+}
+
+void FlightRecorderLogRecordProcessorProxy::setTriggerSeverity(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray severity_mda = context.inputs[0];
+    std::string severity = static_cast<std::string>(severity_mda[0]);
+    // lowest severity number of each level, "none" turns the trigger off
+    if (severity == "trace") {
+        TriggerSeverity = 1;
+    } else if (severity == "debug") {
+        TriggerSeverity = 5;
+    } else if (severity == "info") {
+        TriggerSeverity = 9;
+    } else if (severity == "warn") {
+        TriggerSeverity = 13;
+    } else if (severity == "error") {
+        TriggerSeverity = 17;
+    } else if (severity == "fatal") {
+        TriggerSeverity = 21;
+    } else if (severity == "none") {
+        TriggerSeverity = 0;
+    }
+}
+
+void FlightRecorderLogRecordProcessorProxy::dump(libmexclass::proxy::method::Context& context) {
+    bool success = true;
+    for (auto it = Recorders.begin(); it != Recorders.end();) {
+        std::shared_ptr<LogFlightRecorder> recorder = it->lock();
+        if (!recorder) {
+            // the logger provider has been destroyed
+            it = Recorders.erase(it);
+            continue;
+        }
+        success = recorder->dump() && success;
+        ++it;
+    }
+    matlab::data::ArrayFactory factory;
+    context.outputs[0] = factory.createScalar(success);
+}
+} // namespace libmexclass::opentelemetry
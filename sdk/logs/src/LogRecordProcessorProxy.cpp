@@ -0,0 +1,34 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/LogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/StatsLogRecordProcessor.h"
+#include "opentelemetry-matlab/metrics/MeterProviderProxy.h"
+
+namespace libmexclass::opentelemetry::sdk {
+LogRecordProcessorProxy::LogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter, const std::string& component)
+	: LogRecordExporter(exporter), Stats(std::make_shared<PipelineStats>("logs", component)) {
+    REGISTER_METHOD(LogRecordProcessorProxy, getStats);
+    REGISTER_METHOD(LogRecordProcessorProxy, publishStats);
+}
+
+std::unique_ptr<logs_sdk::LogRecordExporter> LogRecordProcessorProxy::wrapExporter(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter) {
+    return std::unique_ptr<logs_sdk::LogRecordExporter>(new StatsLogRecordExporter(std::move(exporter), Stats));
+}
+
+std::unique_ptr<logs_sdk::LogRecordProcessor> LogRecordProcessorProxy::wrapProcessor(std::unique_ptr<logs_sdk::LogRecordProcessor>&& processor,
+		bool countrejected) {
+    return std::unique_ptr<logs_sdk::LogRecordProcessor>(new StatsLogRecordProcessor(std::move(processor), Stats, countrejected));
+}
+
+void LogRecordProcessorProxy::getStats(libmexclass::proxy::method::Context& context) {
+    context.outputs[0] = Stats->toStruct();
+}
+
+void LogRecordProcessorProxy::publishStats(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<uint64_t> mpid_mda = context.inputs[0];
+    libmexclass::proxy::ID mpid = mpid_mda[0];
+    auto mp = std::static_pointer_cast<libmexclass::opentelemetry::MeterProviderProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(mpid))->getInstance();
+    Stats->publish(mp->GetMeter("opentelemetry-matlab"));
+}
+} // namespace libmexclass::opentelemetry
@@ -1,8 +1,9 @@
-// Copyright 2024 The MathWorks, Inc.
+// Copyright 2024-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/sdk/logs/LoggerProviderProxy.h"
 #include "opentelemetry-matlab/sdk/logs/LogRecordProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/common/resource.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
 
 #include "libmexclass/proxy/ProxyManager.h"
 
@@ -13,6 +14,8 @@
 #include "opentelemetry/logs/noop.h"
 #include "opentelemetry/common/key_value_iterable_view.h"
 
+#include <cmath>
+
 namespace logs_api = opentelemetry::logs;
 namespace logs_sdk = opentelemetry::sdk::logs;
 namespace nostd = opentelemetry::nostd;
@@ -49,11 +52,18 @@ libmexclass::proxy::MakeResult LoggerProviderProxy::make(const libmexclass::prox
 				       std::move(processor), resource_custom);
        nostd::shared_ptr<logs_sdk::LoggerProvider> p_sdk_shared(std::move(p_sdk));
        nostd::shared_ptr<logs_api::LoggerProvider> p_api_shared(std::move(p_sdk_shared));
+       // a new provider may reuse the address of a deleted one
+       AttributeLimitsRegistry::erase(p_api_shared.get());
        out = std::make_shared<LoggerProviderProxy>(p_api_shared);
     }
     return out;
 }
 
+LoggerProviderProxy::~LoggerProviderProxy() {
+    // limits are keyed by provider address, which a later provider may reuse
+    AttributeLimitsRegistry::erase(CppLoggerProvider.get());
+}
+
 void LoggerProviderProxy::addProcessor(libmexclass::proxy::method::Context& context) {
     matlab::data::TypedArray<uint64_t> processorid_mda = context.inputs[0];
     libmexclass::proxy::ID processorid = processorid_mda[0];
@@ -67,6 +77,7 @@ void LoggerProviderProxy::shutdown(libmexclass::proxy::method::Context& context)
     matlab::data::ArrayFactory factory;
     auto result_mda = factory.createScalar(static_cast<logs_sdk::LoggerProvider&>(*CppLoggerProvider).Shutdown());
     context.outputs[0] = result_mda;
+    AttributeLimitsRegistry::erase(CppLoggerProvider.get());
     nostd::shared_ptr<logs_api::LoggerProvider> noop(new logs_api::NoopLoggerProvider);
     CppLoggerProvider.swap(noop);
 }
@@ -82,4 +93,17 @@ void LoggerProviderProxy::forceFlush(libmexclass::proxy::method::Context& contex
         context.outputs[0] = factory.createScalar(static_cast<logs_sdk::LoggerProvider&>(*CppLoggerProvider).ForceFlush(timeout));
     }
 }
+
+void LoggerProviderProxy::setArraySummaryThreshold(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> threshold_mda = context.inputs[0];
+    double threshold = threshold_mda[0];
+    if (std::isinf(threshold)) {
+        AttributeLimitsRegistry::erase(CppLoggerProvider.get());
+    } else {
+        auto limits = std::make_shared<AttributeLimits>();
+        limits->ArraySummaryThreshold = static_cast<size_t>(threshold);
+        // loggers that already exist are not affected
+        AttributeLimitsRegistry::set(CppLoggerProvider.get(), std::move(limits));
+    }
+}
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,68 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/LogsRequestReplay.h"
+#include "opentelemetry-matlab/sdk/common/ProtoConversion.h"
+
+#include "opentelemetry/logs/severity.h"
+#include "opentelemetry/trace/trace_flags.h"
+
+#include <vector>
+
+namespace logs_api = opentelemetry::logs;
+namespace trace_api = opentelemetry::trace;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace logs_proto = ::opentelemetry::proto::logs::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+common::SystemTimestamp toTimestamp(uint64_t nanoseconds) {
+    return common::SystemTimestamp(std::chrono::nanoseconds(nanoseconds));
+}
+
+void replayLogRecord(const logs_proto::LogRecord& record, logs_sdk::Recordable& target) {
+    target.SetTimestamp(toTimestamp(record.time_unix_nano()));
+    target.SetObservedTimestamp(toTimestamp(record.observed_time_unix_nano()));
+    // OTLP severity numbers match the API severity values
+    target.SetSeverity(static_cast<logs_api::Severity>(record.severity_number()));
+    if (record.has_body()) {
+        common_sdk::OwnedAttributeValue body = fromAnyValue(record.body());
+        AttributeValueView view;
+        target.SetBody(view(body));
+    }
+    ProtoAttributeList attrs(record.attributes());
+    for (const auto& [key, value] : attrs.entries()) {
+        target.SetAttribute(key, value);
+    }
+    if (record.trace_id().size() == trace_api::TraceId::kSize) {
+        target.SetTraceId(traceIdFromBytes(record.trace_id()));
+        target.SetSpanId(spanIdFromBytes(record.span_id()));
+        target.SetTraceFlags(trace_api::TraceFlags(static_cast<uint8_t>(record.flags() & 0xFF)));
+    }
+}
+} // namespace
+
+common_sdk::ExportResult exportLogsRequest(
+		const ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request,
+		logs_sdk::LogRecordExporter& exporter) {
+    // resources and scopes are referenced by the recordables until the export completes
+    std::vector<std::unique_ptr<resource::Resource> > resources;
+    std::vector<std::unique_ptr<instrumentationscope::InstrumentationScope> > scopes;
+    std::vector<std::unique_ptr<logs_sdk::Recordable> > recordables;
+    for (const auto& resourcelogs : request.resource_logs()) {
+        resources.push_back(makeResource(resourcelogs.resource(), resourcelogs.schema_url()));
+        for (const auto& scopelogs : resourcelogs.scope_logs()) {
+            scopes.push_back(makeInstrumentationScope(scopelogs.scope(), scopelogs.schema_url()));
+            for (const auto& record : scopelogs.log_records()) {
+                std::unique_ptr<logs_sdk::Recordable> recordable = exporter.MakeRecordable();
+                recordable->SetResource(*resources.back());
+                recordable->SetInstrumentationScope(*scopes.back());
+                replayLogRecord(record, *recordable);
+                recordables.push_back(std::move(recordable));
+            }
+        }
+    }
+    return exporter.Export(nostd::span<std::unique_ptr<logs_sdk::Recordable> >(recordables.data(),
+			    recordables.size()));
+}
+} // namespace libmexclass::opentelemetry
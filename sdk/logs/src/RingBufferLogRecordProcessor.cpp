@@ -0,0 +1,78 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/RingBufferLogRecordProcessor.h"
+
+#include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
+#include "opentelemetry/nostd/span.h"
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+// size assumed for log records whose encoded size is unknown
+const size_t DefaultLogRecordSize = 256;
+
+size_t logRecordSize(logs_sdk::Recordable& record) {
+    auto otlprecord = dynamic_cast<otlp_exporter::OtlpLogRecordable*>(&record);
+    if (otlprecord != nullptr) {
+        return otlprecord->log_record().ByteSizeLong();
+    }
+    return DefaultLogRecordSize;
+}
+} // namespace
+
+RingBufferLogRecordProcessor::RingBufferLogRecordProcessor(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter,
+		const BatchExportQueueOptions& options, std::shared_ptr<PipelineStats> stats) : Exporter(std::move(exporter)) {
+    logs_sdk::LogRecordExporter* exp = Exporter.get();
+    Queue.reset(new BatchExportQueue<logs_sdk::Recordable>(options,
+        [exp](std::vector<std::unique_ptr<logs_sdk::Recordable> >& batch) {
+            return exp->Export(nostd::span<std::unique_ptr<logs_sdk::Recordable> >(batch.data(), batch.size()))
+                == common_sdk::ExportResult::kSuccess;
+        }, std::move(stats)));
+}
+
+RingBufferLogRecordProcessor::~RingBufferLogRecordProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<logs_sdk::Recordable> RingBufferLogRecordProcessor::MakeRecordable() noexcept {
+    return Exporter->MakeRecordable();
+}
+
+void RingBufferLogRecordProcessor::OnEmit(std::unique_ptr<logs_sdk::Recordable>&& record) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !record) {
+        return;
+    }
+    size_t bytes = logRecordSize(*record);
+    Queue->push(std::move(record), bytes);
+}
+
+bool RingBufferLogRecordProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire)) {
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (!Queue->flush(timeout)) {
+        return false;
+    }
+    if (timeout == (std::chrono::microseconds::max)()) {
+        return Exporter->ForceFlush(timeout);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+    return elapsed < timeout && Exporter->ForceFlush(timeout - elapsed);
+}
+
+bool RingBufferLogRecordProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    // exports all queued log records before stopping
+    Queue->stop();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,87 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/RingBufferLogRecordProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/logs/RingBufferLogRecordProcessor.h"
+#include "opentelemetry-matlab/sdk/logs/LogRecordExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+RingBufferLogRecordProcessorProxy::RingBufferLogRecordProcessorProxy(std::shared_ptr<LogRecordExporterProxy> exporter)
+	: LogRecordProcessorProxy(exporter, "RingBufferLogRecordProcessor") {
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setMaximumQueueSize);
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setMaximumQueueBytes);
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setScheduledDelay);
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setMaximumExportBatchSize);
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setFullQueuePolicy);
+    REGISTER_METHOD(RingBufferLogRecordProcessorProxy, setBlockTimeout);
+}
+
+libmexclass::proxy::MakeResult RingBufferLogRecordProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];	
+    std::shared_ptr<LogRecordExporterProxy> exporter = std::static_pointer_cast<LogRecordExporterProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    return std::make_shared<RingBufferLogRecordProcessorProxy>(exporter);
+}
+
+std::unique_ptr<logs_sdk::LogRecordProcessor> RingBufferLogRecordProcessorProxy::getInstance() {
+    return wrapProcessor(std::unique_ptr<logs_sdk::LogRecordProcessor>(new RingBufferLogRecordProcessor(
+		    wrapExporter(LogRecordExporter->getInstance()), CppOptions, Stats)));
+}
+
+void RingBufferLogRecordProcessorProxy::setMaximumQueueSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> qsize_mda = context.inputs[0];
+    double qsize = qsize_mda[0];
+    if (qsize > 0) {
+        CppOptions.max_queue_size = static_cast<size_t>(qsize);
+    }
+}
+
+void RingBufferLogRecordProcessorProxy::setMaximumQueueBytes(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> qbytes_mda = context.inputs[0];
+    double qbytes = qbytes_mda[0];
+    // Inf means no byte limit
+    if (qbytes > 0) {
+        CppOptions.max_queue_bytes = std::isinf(qbytes) ? 0 : static_cast<size_t>(qbytes);
+    }
+}
+
+void RingBufferLogRecordProcessorProxy::setScheduledDelay(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> delay_mda = context.inputs[0];
+    double delay = delay_mda[0];
+    if (delay > 0) {
+        CppOptions.schedule_delay_millis = std::chrono::milliseconds(static_cast<int64_t>(delay));
+    }
+}
+
+void RingBufferLogRecordProcessorProxy::setMaximumExportBatchSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> batchsize_mda = context.inputs[0];
+    double batchsize = batchsize_mda[0];
+    if (batchsize > 0) {
+        CppOptions.max_export_batch_size = static_cast<size_t>(batchsize);
+    }
+}
+
+void RingBufferLogRecordProcessorProxy::setFullQueuePolicy(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray policy_mda = context.inputs[0];
+    std::string policy = static_cast<std::string>(policy_mda[0]);
+    if (policy == "dropnewest") {
+        CppOptions.full_queue_policy = FullQueuePolicy::DropNewest;
+    } else if (policy == "dropoldest") {
+        CppOptions.full_queue_policy = FullQueuePolicy::DropOldest;
+    } else if (policy == "block") {
+        CppOptions.full_queue_policy = FullQueuePolicy::Block;
+    }
+}
+
+void RingBufferLogRecordProcessorProxy::setBlockTimeout(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> timeout_mda = context.inputs[0];
+    double timeout = timeout_mda[0];
+    if (timeout >= 0) {
+        CppOptions.block_timeout_millis = std::chrono::milliseconds(static_cast<int64_t>(timeout));
+    }
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,59 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/SpoolLogRecordExporter.h"
+#include "opentelemetry-matlab/sdk/logs/LogsRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/otlp_log_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+SpoolLogRecordExporter::SpoolLogRecordExporter(std::unique_ptr<logs_sdk::LogRecordExporter>&& exporter,
+                const SpoolOptions& options)
+        : Exporter(std::move(exporter)),
+          Forwarder(options, [this](const std::string& request) { return deliver(request); }) {}
+
+std::unique_ptr<logs_sdk::Recordable> SpoolLogRecordExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<logs_sdk::Recordable>(new otlp_exporter::OtlpLogRecordable());
+}
+
+common_sdk::ExportResult SpoolLogRecordExporter::Export(
+                const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept {
+    if (IsShutdown.load()) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    if (records.empty()) {
+        return common_sdk::ExportResult::kSuccess;
+    }
+    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(records, &request);
+    std::string serialized;
+    if (!request.SerializeToString(&serialized) || !Forwarder.submit(serialized)) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    return common_sdk::ExportResult::kSuccess;
+}
+
+DeliveryResult SpoolLogRecordExporter::deliver(const std::string& serialized) {
+    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest request;
+    if (!request.ParseFromString(serialized)) {
+        return DeliveryResult::Rejected;   // unreadable, discard rather than retry forever
+    }
+    return toDeliveryResult(exportLogsRequest(request, *Exporter));
+}
+
+bool SpoolLogRecordExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    bool drained = Forwarder.drain(timeout);
+    return Exporter->ForceFlush(timeout) && drained;
+}
+
+bool SpoolLogRecordExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    // make one last attempt, anything left stays on disk for the next session
+    Forwarder.drain(timeout);
+    Forwarder.stop();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry::sdk
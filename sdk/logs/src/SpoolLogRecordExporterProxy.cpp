@@ -0,0 +1,50 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/SpoolLogRecordExporterProxy.h"
+#include "opentelemetry-matlab/sdk/logs/SpoolLogRecordExporter.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::sdk {
+libmexclass::proxy::MakeResult SpoolLogRecordExporterProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    auto exporter = std::static_pointer_cast<LogRecordExporterProxy>(
+            libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    // the spool relies on Export reporting failures
+    if (exporter->exportsAsynchronously()) {
+        return libmexclass::error::Error{"opentelemetry:sdk:logs:SpoolLogRecordExporter:AsynchronousExporter",
+                "Exporters that send data asynchronously cannot be spooled."};
+    }
+    return std::make_shared<SpoolLogRecordExporterProxy>(exporter);
+}
+
+std::unique_ptr<logs_sdk::LogRecordExporter> SpoolLogRecordExporterProxy::getInstance() {
+    return std::unique_ptr<logs_sdk::LogRecordExporter>(new SpoolLogRecordExporter(WrappedExporter->getInstance(), CppOptions));
+}
+
+void SpoolLogRecordExporterProxy::setDirectory(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray directory_mda = context.inputs[0];
+    CppOptions.directory = static_cast<std::string>(directory_mda[0]);
+}
+
+void SpoolLogRecordExporterProxy::setSegmentSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> segmentsize_mda = context.inputs[0];
+    CppOptions.segment_size = static_cast<size_t>(segmentsize_mda[0]);
+}
+
+void SpoolLogRecordExporterProxy::setMaxDiskUsage(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxbytes_mda = context.inputs[0];
+    CppOptions.max_bytes = static_cast<size_t>(maxbytes_mda[0]);
+}
+
+void SpoolLogRecordExporterProxy::setInitialBackoff(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> backoff_mda = context.inputs[0];
+    CppOptions.initial_backoff = std::chrono::milliseconds(static_cast<int64_t>(backoff_mda[0]));
+}
+
+void SpoolLogRecordExporterProxy::setMaxBackoff(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> backoff_mda = context.inputs[0];
+    CppOptions.max_backoff = std::chrono::milliseconds(static_cast<int64_t>(backoff_mda[0]));
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,18 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/logs/StatsLogRecordProcessor.h"
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+common_sdk::ExportResult StatsLogRecordExporter::Export(
+		const nostd::span<std::unique_ptr<logs_sdk::Recordable> >& records) noexcept {
+    auto start = std::chrono::steady_clock::now();
+    common_sdk::ExportResult result = Exporter->Export(records);
+    Stats->recordExport(records.size(), result == common_sdk::ExportResult::kSuccess,
+		    std::chrono::steady_clock::now() - start);
+    return result;
+}
+} // namespace libmexclass::opentelemetry
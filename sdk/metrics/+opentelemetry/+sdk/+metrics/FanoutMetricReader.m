@@ -0,0 +1,70 @@
+classdef FanoutMetricReader < opentelemetry.sdk.metrics.MetricReader
+% Fanout metric reader collects metrics once and passes them to several
+% exporters, each exporting at its own time interval.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=private)
+        MetricExporter = {}   % Metric exporters, as a cell array
+        Interval = duration.empty(1,0)   % Time interval between exports of each metric exporter
+    end
+
+    methods
+        function obj = FanoutMetricReader(varargin)
+            % Fanout metric reader collects metrics once and passes them
+            % to several exporters, each exporting at its own time
+            % interval.
+            %    R = OPENTELEMETRY.SDK.METRICS.FANOUTMETRICREADER creates a
+            %    fanout metric reader without exporters. Use
+            %    ADDMETRICEXPORTER to add exporters.
+            %
+            %    R = OPENTELEMETRY.SDK.METRICS.FANOUTMETRICREADER(EXP1,
+            %    INTERVAL1, EXP2, INTERVAL2, ...) adds metric exporters
+            %    EXP1, EXP2, ... exporting every INTERVAL1, INTERVAL2, ...
+            %
+            %    Metrics are collected whenever at least one exporter is
+            %    due, and exporters that are due at the same time share a
+            %    collection. Exporters whose intervals are multiples of each
+            %    other therefore share every collection of the longer
+            %    interval. Each exporter receives metrics in its preferred
+            %    aggregation temporality.
+            %
+            %    See also ADDMETRICEXPORTER,
+            %    OPENTELEMETRY.SDK.METRICS.METERPROVIDER,
+            %    OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER
+
+            if mod(nargin, 2) ~= 0
+                error("opentelemetry:sdk:metrics:FanoutMetricReader:InvalidInput", ...
+                    "Inputs must be pairs of metric exporters and intervals.");
+            end
+            obj.Proxy = libmexclass.proxy.Proxy("Name", "libmexclass.opentelemetry.sdk.FanoutMetricReaderProxy" , ...
+                "ConstructorArguments", {});
+            for i = 1:2:nargin
+                obj.addMetricExporter(varargin{i}, varargin{i+1});
+            end
+        end
+
+        function addMetricExporter(obj, exporter, interval)
+            % ADDMETRICEXPORTER Add a metric exporter
+            %    ADDMETRICEXPORTER(R, EXP, INTERVAL) adds metric exporter
+            %    EXP that exports every INTERVAL, specified as a duration.
+            %    Metric exporters must be added before the reader is added
+            %    to a meter provider.
+            %
+            %    See also OPENTELEMETRY.SDK.METRICS.METRICEXPORTER
+            arguments
+                obj
+                exporter (1,1) {mustBeA(exporter, "opentelemetry.sdk.metrics.MetricExporter")}
+                interval
+            end
+            if ~isduration(interval) || ~isscalar(interval) || interval <= 0 || ...
+                    round(interval) ~= interval
+                error("opentelemetry:sdk:metrics:FanoutMetricReader:InvalidInterval", ...
+                    "Interval must be a positive duration integer.");
+            end
+            obj.Proxy.addMetricExporter(exporter.Proxy.ID, milliseconds(interval));
+            obj.MetricExporter{end+1} = exporter;
+            obj.Interval(end+1) = interval;
+        end
+    end
+end
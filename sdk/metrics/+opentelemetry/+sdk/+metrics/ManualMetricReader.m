@@ -0,0 +1,145 @@
+classdef ManualMetricReader < opentelemetry.sdk.metrics.MetricReader
+% Manual metric reader collects metrics only when its collect method is
+% called, so that collections can be aligned with the steps of a
+% simulation.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        MetricExporter  % Metric exporter object that collected metrics are passed to, or empty if there is none.
+    end
+
+    properties
+        Asynchronous (1,1) logical = false   % Whether collected metrics are exported by a background thread
+        AggregationTemporality (1,1) string = "cumulative"   % Aggregation temporality when there is no exporter
+    end
+
+    methods
+        function obj = ManualMetricReader(varargin)
+            % Manual metric reader collects metrics only when its collect
+            % method is called.
+            %    R = OPENTELEMETRY.SDK.METRICS.MANUALMETRICREADER creates a
+            %    manual metric reader without an exporter. Collected 
+            %    metrics are returned by the collect method.
+            %
+            %    R = OPENTELEMETRY.SDK.METRICS.MANUALMETRICREADER(EXP)
+            %    also passes collected metrics to metric exporter EXP.
+            %
+            %    R = OPENTELEMETRY.SDK.METRICS.MANUALMETRICREADER(
+            %    ..., PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies
+            %    optional parameter name/value pairs. Parameters are:
+            %       "Asynchronous" - If true, collect returns as soon as
+            %                    metrics are collected, and a background 
+            %                    thread exports them in the order they were
+            %                    collected. If false, collect waits for the
+            %                    export to complete. Default is false.
+            %       "AggregationTemporality" - "cumulative" or "delta".
+            %                    Used only when there is no exporter,
+            %                    otherwise the preferred aggregation 
+            %                    temporality of the exporter is used.
+            %                    Default is "cumulative".
+            %
+            %    Options must be set before the reader is added to a meter
+            %    provider.
+            %
+            %    See also COLLECT, OPENTELEMETRY.SDK.METRICS.METERPROVIDER,
+            %    OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER
+
+            if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.metrics.MetricExporter")
+                metricexporter = [];
+                exporterid = uint64.empty;
+            else   % isa(varargin{1}, "opentelemetry.sdk.metrics.MetricExporter")
+                metricexporter = varargin{1};
+                exporterid = metricexporter.Proxy.ID;
+                varargin(1) = [];
+            end
+
+            obj.Proxy = libmexclass.proxy.Proxy("Name", "libmexclass.opentelemetry.sdk.ManualMetricReaderProxy" , ...
+                "ConstructorArguments", {exporterid});
+            obj.MetricExporter = metricexporter;
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function obj = set.Asynchronous(obj, asynchronous)
+            obj.Proxy.setAsynchronous(asynchronous); %#ok<MCSUP>
+            obj.Asynchronous = asynchronous;
+        end
+
+        function obj = set.AggregationTemporality(obj, temporality)
+            temporality = validatestring(temporality, ["cumulative", "delta"]);
+            obj.Proxy.setTemporality(temporality); %#ok<MCSUP>
+            obj.AggregationTemporality = temporality;
+        end
+
+        function [success, data] = collect(obj)
+            % COLLECT Collect metrics.
+            %    SUCCESS = COLLECT(R) collects metrics and passes them to
+            %    the exporter. Returns a logical that indicates whether 
+            %    collection, and export when it is not asynchronous, was 
+            %    successful. Collection fails if the reader has not been
+            %    added to a meter provider or has been shut down.
+            %
+            %    [SUCCESS, DATA] = COLLECT(R) also returns the collected 
+            %    metrics as a struct with one column per field and one row
+            %    per data point. Fields are:
+            %       Name, Unit    - Instrument name and unit
+            %       Scope         - Name of the meter
+            %       Type          - "sum", "gauge", "histogram", or
+            %                       "exponentialhistogram"
+            %       Attributes    - Attributes of the data point, as a
+            %                       cell array of dictionaries
+            %       StartTime, EndTime - Start and end of the aggregation
+            %                       period, as datetime
+            %       Value         - Value of sums and gauges, NaN for
+            %                       histograms
+            %       Count, Sum, Min, Max - Statistics of histograms, NaN
+            %                       for sums and gauges
+            %       BucketBounds, BucketCounts - Bucket boundaries and
+            %                       counts of histograms, as cell arrays. 
+            %                       There is one more count than bounds,
+            %                       the last count is above the last bound.
+            %                       Exponential histogram buckets are
+            %                       expressed the same way.
+            %
+            %    See also OPENTELEMETRY.SDK.METRICS.METERPROVIDER/FORCEFLUSH
+            returndata = nargout > 1;
+            % include increments still held by coalescing counters
+            opentelemetry.metrics.internal.coalescingBuffers("flush");
+            [success, data] = obj.Proxy.collect(returndata);
+            if returndata
+                n = numel(data.Name);
+                attrs = cell(n, 1);
+                for i = 1:n
+                    attrs{i} = dictionary(reshape(data.AttributeKeys{i}, [], 1), ...
+                        reshape(data.AttributeValues{i}, [], 1));
+                end
+                data.Attributes = attrs;
+                data = rmfield(data, ["AttributeKeys", "AttributeValues"]);
+                data = orderfields(data, ["Name", "Unit", "Scope", "Type", "Attributes", ...
+                    "StartTime", "EndTime", "Value", "Count", "Sum", "Min", "Max", ...
+                    "BucketBounds", "BucketCounts"]);
+                data.StartTime = datetime(data.StartTime, "ConvertFrom", "posixtime");
+                data.EndTime = datetime(data.EndTime, "ConvertFrom", "posixtime");
+            end
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = ["Asynchronous", "AggregationTemporality"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+    end
+end
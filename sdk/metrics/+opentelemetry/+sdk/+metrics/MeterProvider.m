@@ -2,7 +2,7 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
     % An SDK implementation of meter provider, which stores a set of configurations used
     % in a metrics system.
 
-    % Copyright 2023-2025 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     properties(Access=private)
         isShutdown (1,1) logical = false
@@ -12,6 +12,9 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
         MetricReader  % Metric reader controls how often metrics are exported
         View          % View object used to customize collected metrics
         Resource      % Attributes attached to all metrics
+        ArraySummaryThreshold = Inf   % Numeric array attributes with more elements are summarized
+        CardinalityLimit = 2000       % Default maximum number of attribute sets per metric in views
+        ExemplarFilter = "traceBased" % Measurements that may be recorded as exemplars
     end
 
     methods
@@ -21,8 +24,9 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             %    provider that uses a periodic exporting metric reader and default configurations.
             %
             %    MP = OPENTELEMETRY.SDK.METRICS.METERPROVIDER(R) uses metric
-            %    reader R. Currently, the only supported metric reader is the periodic
-    	    %    exporting metric reader.
+            %    reader R. Supported metric readers are the periodic
+    	    %    exporting metric reader, the manual metric reader, and the
+    	    %    fanout metric reader.
             %
             %    TP = OPENTELEMETRY.SDK.METRICS.METERPROVIDER(..., PARAM1, VALUE1,
             %    PARAM2, VALUE2, ...) specifies optional parameter name/value pairs.
@@ -30,8 +34,32 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             %       "View"        - View object used to customize collected metrics.
             %       "Resource"    - Additional resource attributes.
             %                       Specified as a dictionary.
+            %       "ArraySummaryThreshold" - Numeric array attributes of
+            %                       synchronous instruments with more elements
+            %                       are replaced by summary statistics. 
+            %                       Default is Inf.
+            %       "CardinalityLimit" - Maximum number of distinct attribute
+            %                       sets kept for each metric of views that
+            %                       do not set their own CardinalityLimit.
+            %                       Values with further attribute sets are
+            %                       aggregated into a series with attribute
+            %                       otel.metric.overflow=true. Inf means no
+            %                       limit. Metrics not matched by any view
+            %                       are limited to 2000 attribute sets.
+            %                       Default is 2000.
+            %       "ExemplarFilter" - Measurements that may be recorded as
+            %                       exemplars, which link metrics to spans.
+            %                       "traceBased" records measurements made
+            %                       in the context of a sampled span,
+            %                       "alwaysOn" records all measurements, and
+            %                       "alwaysOff" disables exemplars. Histograms
+            %                       keep an exemplar for each bucket. Default
+            %                       is "traceBased". Requires a build with
+            %                       WITH_METRICS_EXEMPLAR.
             %
             %    See also OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER
+            %    OPENTELEMETRY.SDK.METRICS.MANUALMETRICREADER
+            %    OPENTELEMETRY.SDK.METRICS.FANOUTMETRICREADER
             %    OPENTELEMETRY.SDK.METRICS.VIEW
 
             % explicit call to superclass constructor to make it a no-op
@@ -48,7 +76,7 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
                     "ConstructorArguments", {mpproxy.ID});
                 % leave other properties unassigned, they won't be used
             else
-                if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.metrics.PeriodicExportingMetricReader")
+                if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.metrics.MetricReader")
                     reader = opentelemetry.sdk.metrics.PeriodicExportingMetricReader();  % default metric reader
                 else
                     reader = varargin{1};
@@ -64,10 +92,11 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             %    R to the list of metric readers used by meter provider
             %    MP.
             %
-            %    See also ADDVIEW, OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER
+            %    See also ADDVIEW, OPENTELEMETRY.SDK.METRICS.PERIODICEXPORTINGMETRICREADER,
+            %    OPENTELEMETRY.SDK.METRICS.MANUALMETRICREADER
             arguments
          	    obj
-                reader (1,1) {mustBeA(reader, "opentelemetry.sdk.metrics.PeriodicExportingMetricReader")}
+                reader (1,1) {mustBeA(reader, "opentelemetry.sdk.metrics.MetricReader")}
             end
             obj.Proxy.addMetricReader(reader.Proxy.ID);
             obj.MetricReader = [obj.MetricReader, reader];
@@ -77,6 +106,11 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             % ADDVIEW Add an additional view
             %    ADDVIEW(MP, V) adds an additional view V. 
             %
+            %    Views, including their attribute rewrite rules, only
+            %    apply to instruments created after they are added.
+            %    Existing instruments keep their aggregation and
+            %    attribute values.
+            %
             %    See also ADDMETRICREADER, OPENTELEMETRY.SDK.METRICS.VIEW
             arguments
          	    obj
@@ -93,6 +127,8 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             %
             %    See also FORCEFLUSH
             if ~obj.isShutdown
+                % include increments still held by coalescing counters
+                opentelemetry.metrics.internal.coalescingBuffers("flush");
                 success = obj.Proxy.shutdown();
                 obj.isShutdown = success;
             else
@@ -113,7 +149,11 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             %    See also SHUTDOWN
             if obj.isShutdown
                 success = false;
-            elseif nargin < 2 || ~isa(timeout, "duration")  % ignore timeout if not a duration
+                return
+            end
+            % include increments still held by coalescing counters
+            opentelemetry.metrics.internal.coalescingBuffers("flush");
+            if nargin < 2 || ~isa(timeout, "duration")  % ignore timeout if not a duration
                 success = obj.Proxy.forceFlush();
             else
                 success = obj.Proxy.forceFlush(milliseconds(timeout)*1000); % convert to microseconds
@@ -122,6 +162,14 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
 
     end
 
+    methods (Access={?opentelemetry.sdk.trace.SpanProcessor, ?opentelemetry.sdk.logs.LogRecordProcessor, ...
+            ?opentelemetry.sdk.metrics.PeriodicExportingMetricReader})
+        function id = getProxyID(obj)
+            % ID of the proxy object, used to publish pipeline statistics
+            id = obj.Proxy.ID;
+        end
+    end
+
     methods(Access=private)
         function processOptions(obj, reader, optionnames, optionvalues)
             arguments
@@ -133,11 +181,16 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
                 optionvalues
             end
 
-            validnames = ["Resource", "View"];
+            validnames = ["Resource", "View", "ArraySummaryThreshold", "CardinalityLimit", ...
+                "ExemplarFilter"];
+            threshold = Inf;
+            cardinalitylimit = 2000;
+            exemplarfilter = "traceBased";
             resourcekeys = string.empty();
             resourcevalues = {};
             resource = dictionary(resourcekeys, resourcevalues);
             suppliedview = false;
+            suppliedexemplarfilter = false;
             viewid = 0;
             for i = 1:length(optionnames)
                 namei = validatestring(optionnames{i}, validnames);
@@ -163,6 +216,27 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
                             "View input must be a opentelemetry.sdk.metrics.View object.");
                     end
                     viewid = view.Proxy.ID;
+                elseif strcmp(namei, "ExemplarFilter")
+                    if ~(isStringScalar(valuei) || (ischar(valuei) && isrow(valuei)))
+                        error("opentelemetry:sdk:metrics:MeterProvider:InvalidExemplarFilter", ...
+                            "ExemplarFilter must be ""traceBased"", ""alwaysOn"", or ""alwaysOff"".");
+                    end
+                    exemplarfilter = validatestring(valuei, ["traceBased", "alwaysOn", "alwaysOff"]);
+                    suppliedexemplarfilter = true;
+                elseif strcmp(namei, "CardinalityLimit")
+                    if ~(isnumeric(valuei) && isscalar(valuei) && isreal(valuei) && valuei >= 1 && ...
+                            (valuei == round(valuei) || isinf(valuei)))
+                        error("opentelemetry:sdk:metrics:MeterProvider:InvalidCardinalityLimit", ...
+                            "CardinalityLimit must be a positive integer or Inf.");
+                    end
+                    cardinalitylimit = double(valuei);
+                else  % "ArraySummaryThreshold"
+                    if ~(isnumeric(valuei) && isscalar(valuei) && isreal(valuei) && valuei >= 0 && ...
+                            (valuei == round(valuei) || isinf(valuei)))
+                        error("opentelemetry:sdk:metrics:MeterProvider:InvalidArraySummaryThreshold", ...
+                            "ArraySummaryThreshold must be a nonnegative integer or Inf.");
+                    end
+                    threshold = double(valuei);
                 end
             end
             
@@ -172,9 +246,20 @@ classdef MeterProvider < opentelemetry.metrics.MeterProvider & handle
             obj.Proxy = libmexclass.proxy.Proxy("Name", ...
                 "libmexclass.opentelemetry.sdk.MeterProviderProxy", ...
                 "ConstructorArguments", {reader.Proxy.ID, resourcekeys, ...
-                resourcevalues, suppliedview, viewid});
+                resourcevalues, suppliedview, viewid, cardinalitylimit});
+            obj.Proxy.setArraySummaryThreshold(threshold);
+            if suppliedexemplarfilter
+                supported = obj.Proxy.setExemplarFilter(lower(exemplarfilter));
+                if ~supported
+                    error("opentelemetry:sdk:metrics:MeterProvider:ExemplarNotSupported", ...
+                        "ExemplarFilter requires a build with the WITH_METRICS_EXEMPLAR option.");
+                end
+            end
             obj.MetricReader = reader;
             obj.Resource = resource;
+            obj.ArraySummaryThreshold = threshold;
+            obj.CardinalityLimit = cardinalitylimit;
+            obj.ExemplarFilter = string(exemplarfilter);
             if suppliedview
                 obj.View = view;
             end
@@ -8,9 +8,13 @@ classdef MetricExporter < handle
     end
 
     properties (Hidden, Access={?opentelemetry.sdk.metrics.PeriodicExportingMetricReader, ...
+            ?opentelemetry.sdk.metrics.ManualMetricReader, ...
+            ?opentelemetry.sdk.metrics.FanoutMetricReader, ...
             ?opentelemetry.exporters.otlp.OtlpHttpMetricExporter, ...
             ?opentelemetry.exporters.otlp.OtlpGrpcMetricExporter, ...
-            ?opentelemetry.exporters.otlp.OtlpFileMetricExporter})
+            ?opentelemetry.exporters.otlp.OtlpFileMetricExporter, ...
+            ?opentelemetry.exporters.otlp.OtlpFileReplayer, ...
+            ?opentelemetry.sdk.metrics.SpoolMetricExporter})
         Proxy   % Proxy object to interface C++ code
     end
 
@@ -0,0 +1,9 @@
+classdef (Abstract) MetricReader < matlab.mixin.Heterogeneous & handle
+% Base class of metric readers
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (GetAccess=?opentelemetry.sdk.metrics.MeterProvider, SetAccess=protected)
+        Proxy  % Proxy object to interface C++ code
+    end
+end
@@ -1,13 +1,9 @@
-classdef PeriodicExportingMetricReader < matlab.mixin.Heterogeneous & handle
+classdef PeriodicExportingMetricReader < opentelemetry.sdk.metrics.MetricReader
 % Periodic exporting metric reader passes collected metrics to an exporter
 % periodically at a fixed time interval.
 
 % Copyright 2023-2026 The MathWorks, Inc.
 
-    properties (GetAccess=?opentelemetry.sdk.metrics.MeterProvider)
-        Proxy  % Proxy object to interface C++ code
-    end
-
     properties (SetAccess=immutable)
         MetricExporter  % Metric exporter object responsible for exporting telemetry data to an OpenTelemetry Collector or a compatible backend.
     end
@@ -75,6 +71,31 @@ classdef PeriodicExportingMetricReader < matlab.mixin.Heterogeneous & handle
             obj.Proxy.setTimeout(milliseconds(timeout)); %#ok<MCSUP>
             obj.Timeout = timeout;
         end
+
+        function stats = getStats(obj)
+            % GETSTATS Statistics of the metric export pipeline.
+            %    STATS = GETSTATS(R) returns a struct with the number of
+            %    metric data points collected, exported, and failed to
+            %    export, and histograms of export durations in
+            %    milliseconds and export batch sizes. Metric readers have
+            %    no queue, so Dropped and QueueDepth are always 0.
+            %
+            %    See also PUBLISHSTATS
+            stats = obj.Proxy.getStats();
+        end
+
+        function publishStats(obj, mp)
+            % PUBLISHSTATS Publish statistics of the metric export pipeline as metrics.
+            %    PUBLISHSTATS(R, MP) publishes the statistics returned by
+            %    GETSTATS as metrics through SDK meter provider MP.
+            %
+            %    See also GETSTATS, OPENTELEMETRY.SDK.METRICS.METERPROVIDER
+            arguments
+                obj
+                mp (1,1) opentelemetry.sdk.metrics.MeterProvider
+            end
+            obj.Proxy.publishStats(getProxyID(mp));
+        end
     end
 
     methods(Access=private)
@@ -4,8 +4,11 @@ classdef View < handle
     %   * Metric name
     %   * Aggregation type
     %   * Histogram bins
+    %   * Exponential histogram scale and size
     %   * Ignore unwanted instruments
     %   * Ignore unwanted attributes
+    %   * Limit the number of attribute sets
+    %   * Group attribute values
 
     % Copyright 2023-2026 The MathWorks, Inc.
 
@@ -25,6 +28,11 @@ classdef View < handle
         AllowedAttributes   (1,:) string                 % List of attribute keys that are kept. All other attributes are ignored.
         Aggregation         (1,1) string                 % Customized aggregation type
         HistogramBinEdges   (1,:) double = zeros(1,0)    % Vector of customized bin edges for histogram  
+        ExponentialHistogramMaxScale (1,1) double = 20   % Maximum scale of exponential histograms
+        ExponentialHistogramMaxSize  (1,1) double = 160  % Maximum number of buckets in exponential histograms
+        CardinalityLimit    double = []                  % Maximum number of attribute sets per metric, Inf for no limit, empty uses the MeterProvider default
+        QuantileRelativeError (1,1) double = 0.01        % Maximum relative error of quantiles of "quantile" aggregation
+        QuantileDynamicRange  (1,1) double = 1e6         % Ratio of largest to smallest value over which QuantileRelativeError holds
     end
 
     methods
@@ -65,9 +73,51 @@ classdef View < handle
             %                               attributes will be dropped.
             %       "Aggregation"     - Change instruments to use a
             %                           different aggregation beahvior.
+            %                           "exponentialhistogram" uses
+            %                           base-2 exponential buckets that
+            %                           adapt to the range of recorded
+            %                           values. "quantile" uses an
+            %                           exponential histogram sized for
+            %                           QuantileRelativeError and
+            %                           QuantileDynamicRange.
             %       "HistogramBinEdges"   - Use a different set of bins
             %                               in all histograms this view
             %                               applies to
+            %       "ExponentialHistogramMaxScale" - Maximum scale of
+            %                               exponential histograms, between
+            %                               -10 and 20. Default is 20.
+            %                               Adjacent bucket boundaries
+            %                               differ by a factor of
+            %                               2^(2^-scale). The scale is
+            %                               reduced as needed to fit the
+            %                               recorded range.
+            %       "ExponentialHistogramMaxSize"  - Maximum number of
+            %                               buckets in exponential
+            %                               histograms. Default is 160.
+            %       "CardinalityLimit"    - Maximum number of distinct
+            %                               attribute sets kept for each
+            %                               metric. Once reached, values
+            %                               with new attribute sets are
+            %                               aggregated into a series with
+            %                               attribute otel.metric.overflow=true.
+            %                               Inf means no limit. Default is
+            %                               empty, which uses the
+            %                               CardinalityLimit of the
+            %                               MeterProvider.
+            %       "QuantileRelativeError" - Maximum relative error of
+            %                               quantiles estimated from
+            %                               histograms of "quantile"
+            %                               aggregation, between 1e-4 and
+            %                               0.5. Default is 0.01.
+            %       "QuantileDynamicRange"  - Ratio between the largest and
+            %                               smallest positive value over
+            %                               which QuantileRelativeError is
+            %                               kept. Together with
+            %                               QuantileRelativeError, it fixes
+            %                               the number of buckets. Wider
+            %                               ranges of values are still
+            %                               recorded, at lower accuracy.
+            %                               Default is 1e6.
             %
             %    Examples:
             %       import opentelemetry.sdk.metrics
@@ -81,7 +131,19 @@ classdef View < handle
             %       v = view(MeterName="xyz", InstrumentType="counter", ...
             %              Aggregation="drop");
             %
-            %    See also OPENTELEMETRY.SDK.METRICS.METERPROVIDER
+            %       % Use exponential histograms with at most 80 buckets
+            %       v = view(InstrumentType="histogram", ...
+            %              Aggregation="exponentialhistogram", ...
+            %              ExponentialHistogramMaxSize=80);
+            %
+            %       % Keep at most 100 attribute sets of counter "requests"
+            %       v = view(InstrumentName="requests", CardinalityLimit=100);
+            %
+            %       % Estimate latency quantiles within 0.5%
+            %       v = view(InstrumentName="latency", InstrumentType="histogram", ...
+            %              Aggregation="quantile", QuantileRelativeError=0.005);
+            %
+            %    See also REWRITEATTRIBUTE, OPENTELEMETRY.SDK.METRICS.METERPROVIDER
             arguments
                 options.Name {mustBeTextScalar}
                 options.Description {mustBeTextScalar}
@@ -94,6 +156,11 @@ classdef View < handle
                 options.AllowedAttributes {mustBeText, mustBeVector} = "*"  
                 options.Aggregation {mustBeTextScalar} = "default"
                 options.HistogramBinEdges {mustBeNumeric, mustBeVector} 
+                options.ExponentialHistogramMaxScale (1,1) {mustBeInteger, mustBeInRange(options.ExponentialHistogramMaxScale, -10, 20)} = 20
+                options.ExponentialHistogramMaxSize (1,1) {mustBeInteger, mustBeGreaterThanOrEqual(options.ExponentialHistogramMaxSize, 2)} = 160
+                options.CardinalityLimit {mustBeNumeric} = []
+                options.QuantileRelativeError (1,1) {mustBeNumeric, mustBeInRange(options.QuantileRelativeError, 1e-4, 0.5)} = 0.01
+                options.QuantileDynamicRange (1,1) {mustBeNumeric, mustBeInRange(options.QuantileDynamicRange, 2, 1e15)} = 1e6
             end
 
             obj.Proxy = libmexclass.proxy.Proxy("Name", "libmexclass.opentelemetry.sdk.ViewProxy", ...
@@ -124,6 +191,90 @@ classdef View < handle
             if isfield(options, "HistogramBinEdges")
                 obj.HistogramBinEdges = options.HistogramBinEdges;
             end
+            obj.ExponentialHistogramMaxScale = options.ExponentialHistogramMaxScale;
+            obj.ExponentialHistogramMaxSize = options.ExponentialHistogramMaxSize;
+            if ~isempty(options.CardinalityLimit)
+                obj.CardinalityLimit = options.CardinalityLimit;
+            end
+            obj.QuantileRelativeError = options.QuantileRelativeError;
+            obj.QuantileDynamicRange = options.QuantileDynamicRange;
+        end
+
+        function rewriteAttribute(obj, key, options)
+            % REWRITEATTRIBUTE Group the values of an attribute
+            %    REWRITEATTRIBUTE(V, KEY, PARAM, VALUE, ...) replaces
+            %    the values of attribute KEY of synchronous instruments
+            %    selected by view V with a small set of groups, before
+            %    measurements are aggregated. Specify exactly one of the
+            %    following rules:
+            %       "Bins"        - Numeric vector of bin edges. Numeric
+            %                       values are replaced by the label of their
+            %                       bin, such as "[100,200)".
+            %       "Prefixes"    - String array of prefixes. String values
+            %                       are replaced by the first prefix they
+            %                       start with.
+            %       "Patterns"    - String array of regular expressions, in
+            %                       ECMAScript syntax. String values are
+            %                       replaced by the group of the first pattern
+            %                       they match. Specify groups with "Groups".
+            %       "TopN"        - Positive integer N. The first N distinct
+            %                       values are kept.
+            %    Other parameters are:
+            %       "Groups"      - String array of group names, one for
+            %                       each pattern.
+            %       "OtherValue"  - Replaces values not matched by any
+            %                       prefix or pattern, or beyond the first
+            %                       TopN. Default is "other".
+            %
+            %    Rules affect all metrics of the selected instruments, and
+            %    must be added before the view is added to a meter provider.
+            %    Instruments created before that are not affected. 
+            %
+            %    Examples:
+            %       import opentelemetry.sdk.metrics
+            %
+            %       % Group request sizes and keep the 20 first file names
+            %       v = view(InstrumentName="requests");
+            %       rewriteAttribute(v, "size", Bins=[0 1e3 1e6]);
+            %       rewriteAttribute(v, "file", TopN=20);
+            %       mp = MeterProvider(View=v);
+            %
+            %    See also OPENTELEMETRY.SDK.METRICS.METERPROVIDER
+            arguments
+                obj
+                key {mustBeTextScalar, mustBeNonzeroLengthText}
+                options.Bins {mustBeNumeric, mustBeVector, mustBeNonNan}
+                options.Prefixes {mustBeText, mustBeVector}
+                options.Patterns {mustBeText, mustBeVector}
+                options.Groups {mustBeText, mustBeVector}
+                options.TopN (1,1) {mustBeInteger, mustBePositive}
+                options.OtherValue {mustBeTextScalar, mustBeNonzeroLengthText} = "other"
+            end
+            ruletypes = intersect(["Bins", "Prefixes", "Patterns", "TopN"], ...
+                string(fieldnames(options)), "stable");
+            if ~isscalar(ruletypes)
+                error("opentelemetry:sdk:metrics:View:InvalidAttributeRewrite", ...
+                    "Specify exactly one of Bins, Prefixes, Patterns, and TopN.");
+            end
+            numbers = zeros(1,0);
+            strs = strings(1,0);
+            groups = strings(1,0);
+            if ruletypes == "Bins"
+                numbers = reshape(double(options.Bins),1,[]);
+            elseif ruletypes == "Prefixes"
+                strs = reshape(string(options.Prefixes),1,[]);
+            elseif ruletypes == "Patterns"
+                strs = reshape(string(options.Patterns),1,[]);
+                if ~isfield(options, "Groups") || numel(options.Groups) ~= numel(strs)
+                    error("opentelemetry:sdk:metrics:View:InvalidAttributeRewrite", ...
+                        "Groups must have one name for each pattern.");
+                end
+                groups = reshape(string(options.Groups),1,[]);
+            else  % "TopN"
+                numbers = double(options.TopN);
+            end
+            obj.Proxy.addAttributeRewrite(string(key), lower(ruletypes), ...
+                numbers, strs, groups, string(options.OtherValue));
         end
 
         function obj = set.Name(obj, name)
@@ -223,7 +374,8 @@ classdef View < handle
                 obj
                 agg  {mustBeTextScalar}
             end            
-            aggregation_types = ["drop", "histogram", "lastvalue", "sum", "default"];
+            aggregation_types = ["drop", "histogram", "exponentialhistogram", ...
+                "quantile", "lastvalue", "sum", "default"];
             agg = validatestring(agg, aggregation_types);
             obj.Proxy.setAggregation(agg);
             obj.Aggregation = agg;
@@ -238,5 +390,64 @@ classdef View < handle
             obj.Proxy.setHistogramBinEdges(binedges);
             obj.HistogramBinEdges = binedges;
         end
+
+        function obj = set.ExponentialHistogramMaxScale(obj, maxscale)
+            arguments
+                obj
+                maxscale (1,1) {mustBeInteger, mustBeInRange(maxscale, -10, 20)}
+            end
+            maxscale = double(maxscale);
+            obj.Proxy.setExponentialHistogramMaxScale(maxscale);
+            obj.ExponentialHistogramMaxScale = maxscale;
+        end
+
+        function obj = set.ExponentialHistogramMaxSize(obj, maxsize)
+            arguments
+                obj
+                maxsize (1,1) {mustBeInteger, mustBeGreaterThanOrEqual(maxsize, 2)}
+            end
+            maxsize = double(maxsize);
+            obj.Proxy.setExponentialHistogramMaxSize(maxsize);
+            obj.ExponentialHistogramMaxSize = maxsize;
+        end
+
+        function obj = set.CardinalityLimit(obj, limit)
+            arguments
+                obj
+                limit {mustBeNumeric}
+            end
+            % empty inherits the CardinalityLimit of the MeterProvider
+            if ~isempty(limit) && ~(isscalar(limit) && isreal(limit) && limit >= 1 && ...
+                    (isinf(limit) || limit == round(limit)))
+                error("opentelemetry:sdk:metrics:View:InvalidCardinalityLimit", ...
+                    "CardinalityLimit must be a positive integer, Inf, or empty.");
+            end
+            if isempty(limit)
+                limit = [];
+            end
+            limit = double(limit);
+            obj.Proxy.setCardinalityLimit(limit);
+            obj.CardinalityLimit = limit;
+        end
+
+        function obj = set.QuantileRelativeError(obj, relerr)
+            arguments
+                obj
+                relerr (1,1) {mustBeNumeric, mustBeInRange(relerr, 1e-4, 0.5)}
+            end
+            relerr = double(relerr);
+            obj.Proxy.setQuantileRelativeError(relerr);
+            obj.QuantileRelativeError = relerr;
+        end
+
+        function obj = set.QuantileDynamicRange(obj, range)
+            arguments
+                obj
+                range (1,1) {mustBeNumeric, mustBeInRange(range, 2, 1e15)}
+            end
+            range = double(range);
+            obj.Proxy.setQuantileDynamicRange(range);
+            obj.QuantileDynamicRange = range;
+        end
     end
 end
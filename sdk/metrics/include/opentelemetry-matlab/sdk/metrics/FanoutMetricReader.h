@@ -0,0 +1,77 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/common/timestamp.h"
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+
+struct FanoutTarget {
+    std::unique_ptr<metric_sdk::PushMetricExporter> exporter;
+    std::chrono::milliseconds interval = std::chrono::milliseconds(60000);
+};
+
+// Metric reader that collects once and passes the result to several exporters, each exporting at
+// its own interval. A collection is made whenever at least one exporter is due, and all exporters
+// due at that time share it, so aggregation is done once per tick rather than once per reader.
+// Metrics are always collected with cumulative temporality, and converted to delta temporality
+// for exporters that prefer it, relative to the previous export to the same exporter.
+class FanoutMetricReader : public metric_sdk::MetricReader {
+  public:
+    explicit FanoutMetricReader(std::vector<FanoutTarget> targets);
+
+    ~FanoutMetricReader() override;
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+		    metric_sdk::InstrumentType instrument_type) const noexcept override;
+
+    // State of the previous export of a series, used to compute delta points
+    struct SeriesState;
+
+  private:
+    struct Target {
+        std::unique_ptr<metric_sdk::PushMetricExporter> Exporter;
+        std::chrono::milliseconds Interval;
+        std::chrono::steady_clock::time_point NextExport;
+        ::opentelemetry::common::SystemTimestamp LastExport;   // end time of the previous export
+        std::unordered_map<std::string, std::shared_ptr<SeriesState> > Previous;   // delta exporters only
+        uint64_t Generation = 0;   // number of converted exports, marks the series collected in each
+    };
+
+    void OnInitialized() noexcept override;
+
+    bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
+
+    bool OnShutDown(std::chrono::microseconds timeout) noexcept override;
+
+    void run();
+
+    // Collect once and export to the targets that are due, or to all targets if force is true.
+    // Returns the time at which the next target is due.
+    std::chrono::steady_clock::time_point collectAndExport(bool force, bool& success);
+
+    bool exportTo(Target& target, const metric_sdk::ResourceMetrics& data);
+
+    std::vector<Target> Targets;
+    std::mutex ExportMutex;    // serializes collections between the worker and force flush
+    std::mutex Mutex;
+    std::condition_variable Wake;
+    bool Stopping = false;
+    std::thread Worker;
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,35 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricReaderProxy.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+class FanoutMetricReaderProxy : public MetricReaderProxy {
+  public:
+    FanoutMetricReaderProxy() {
+        REGISTER_METHOD(FanoutMetricReaderProxy, addMetricExporter);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+        return std::make_shared<FanoutMetricReaderProxy>();
+    }
+
+    std::shared_ptr<metric_sdk::MetricReader> getInstance() override;
+
+    void addMetricExporter(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::vector<std::pair<std::shared_ptr<MetricExporterProxy>, std::chrono::milliseconds> > MetricExporters;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,59 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/metrics/export/metric_producer.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Metric reader that only collects when asked to, so that collections can be aligned with the
+// steps of a simulation. Collected metrics are passed to an optional exporter, either on the
+// calling thread or on a background thread that exports them in the order they were collected.
+class ManualMetricReader : public metric_sdk::MetricReader {
+  public:
+    ManualMetricReader(std::unique_ptr<metric_sdk::PushMetricExporter> exporter, bool asynchronous,
+		    metric_sdk::AggregationTemporality temporality);
+
+    ~ManualMetricReader() override;
+
+    // Collect metrics, and export them if there is an exporter. The callback can inspect the
+    // collected metrics before they are exported. Returns false if collection fails, or if a
+    // synchronous export fails.
+    bool collect(const std::function<void(const metric_sdk::ResourceMetrics&)>& inspect);
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+		    metric_sdk::InstrumentType instrument_type) const noexcept override;
+
+  private:
+    bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
+
+    bool OnShutDown(std::chrono::microseconds timeout) noexcept override;
+
+    void run();
+
+    std::unique_ptr<metric_sdk::PushMetricExporter> Exporter;   // null if metrics are only inspected
+    bool Asynchronous;
+    metric_sdk::AggregationTemporality Temporality;   // used when there is no exporter
+
+    std::deque<metric_sdk::ResourceMetrics> Pending;   // collected, not yet exported
+    bool Exporting = false;
+    bool Stopping = false;
+    std::mutex Mutex;
+    std::condition_variable Wake;
+    std::condition_variable Idle;
+    std::thread Worker;
+};
+} // namespace libmexclass::opentelemetry
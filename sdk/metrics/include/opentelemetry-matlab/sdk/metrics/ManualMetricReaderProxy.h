@@ -0,0 +1,42 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/metrics/ManualMetricReader.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricReaderProxy.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include <string>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+class ManualMetricReaderProxy : public MetricReaderProxy {
+  public:
+    ManualMetricReaderProxy(std::shared_ptr<MetricExporterProxy> exporter) : MetricExporter(std::move(exporter)) {
+        REGISTER_METHOD(ManualMetricReaderProxy, setAsynchronous);
+        REGISTER_METHOD(ManualMetricReaderProxy, setTemporality);
+        REGISTER_METHOD(ManualMetricReaderProxy, collect);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::shared_ptr<metric_sdk::MetricReader> getInstance() override;
+
+    void setAsynchronous(libmexclass::proxy::method::Context& context);
+
+    void setTemporality(libmexclass::proxy::method::Context& context);
+
+    void collect(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::shared_ptr<MetricExporterProxy> MetricExporter;   // null if metrics are only returned to MATLAB
+    bool Asynchronous = false;
+    std::string Temporality = "cumulative";   // used when there is no exporter
+
+    std::shared_ptr<ManualMetricReader> Reader;   // reader most recently added to a meter provider
+};
+} // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -29,6 +29,8 @@
 #include "opentelemetry-matlab/metrics/MeterProxy.h"
 #include "opentelemetry-matlab/metrics/MeterProviderProxy.h"
 #include "opentelemetry-matlab/sdk/common/resource.h"
+#include "opentelemetry-matlab/sdk/metrics/ViewProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/ViewAttributeRewriter.h"
 
 namespace metrics_api = opentelemetry::metrics;
 namespace nostd = opentelemetry::nostd;
@@ -40,15 +42,20 @@ namespace otlpexporter = opentelemetry::exporter::otlp;
 namespace libmexclass::opentelemetry::sdk {
 class MeterProviderProxy : public libmexclass::opentelemetry::MeterProviderProxy {
   public:
-    MeterProviderProxy(nostd::shared_ptr<metrics_api::MeterProvider> mp) : libmexclass::opentelemetry::MeterProviderProxy(mp) {
+    MeterProviderProxy(nostd::shared_ptr<metrics_api::MeterProvider> mp, size_t cardinalitylimit = DefaultCardinalityLimit)
+        : libmexclass::opentelemetry::MeterProviderProxy(mp), CardinalityLimit(cardinalitylimit) {
         REGISTER_METHOD(MeterProviderProxy, addMetricReader);
         REGISTER_METHOD(MeterProviderProxy, addView);
         REGISTER_METHOD(MeterProviderProxy, shutdown);
         REGISTER_METHOD(MeterProviderProxy, forceFlush);
+        REGISTER_METHOD(MeterProviderProxy, setArraySummaryThreshold);
+        REGISTER_METHOD(MeterProviderProxy, setExemplarFilter);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
+    ~MeterProviderProxy();
+
     void addMetricReader(libmexclass::proxy::method::Context& context);
 
     void addView(libmexclass::proxy::method::Context& context);
@@ -56,5 +63,20 @@ class MeterProviderProxy : public libmexclass::opentelemetry::MeterProviderProxy
     void shutdown(libmexclass::proxy::method::Context& context);
 
     void forceFlush(libmexclass::proxy::method::Context& context);
+
+    void setArraySummaryThreshold(libmexclass::proxy::method::Context& context);
+
+    void setExemplarFilter(libmexclass::proxy::method::Context& context);
+
+    // register the attribute rewrite rules of a view
+    void addAttributeRewrites(ViewProxy& view);
+
+  private:
+    // same as the SDK limit used by instruments not matched by any view
+    static constexpr size_t DefaultCardinalityLimit = 2000;
+
+    size_t CardinalityLimit;    // applied to views that do not set their own limit
+
+    std::shared_ptr<const ViewAttributeRewrites> Rewrites;   // rewrite rules of all views added so far
 };
 } // namespace libmexclass::opentelemetry
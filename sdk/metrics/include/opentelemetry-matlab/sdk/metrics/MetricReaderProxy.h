@@ -0,0 +1,19 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "libmexclass/proxy/Proxy.h"
+
+#include "opentelemetry/sdk/metrics/metric_reader.h"
+
+#include <memory>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+class MetricReaderProxy : public libmexclass::proxy::Proxy {
+  public:
+    // Create a reader to be added to a meter provider
+    virtual std::shared_ptr<metric_sdk::MetricReader> getInstance() = 0;
+};
+} // namespace libmexclass::opentelemetry
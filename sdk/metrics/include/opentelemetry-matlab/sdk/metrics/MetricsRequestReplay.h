@@ -0,0 +1,23 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Export the metrics in an OTLP request through an exporter, by converting them into metric data.
+// Each resource is exported separately, stopping at the first failure. Sum, gauge and histogram
+// metrics are supported, other metric types are skipped.
+::opentelemetry::sdk::common::ExportResult exportMetricsRequest(
+		const ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request,
+		metric_sdk::PushMetricExporter& exporter);
+
+} // namespace libmexclass::opentelemetry
@@ -1,8 +1,10 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
 #include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
 
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/method/Context.h"
@@ -13,21 +15,27 @@
 namespace metric_sdk = opentelemetry::sdk::metrics;
 
 namespace libmexclass::opentelemetry::sdk {
-class PeriodicExportingMetricReaderProxy : public libmexclass::proxy::Proxy {
+class PeriodicExportingMetricReaderProxy : public MetricReaderProxy {
   public:
     PeriodicExportingMetricReaderProxy(std::shared_ptr<MetricExporterProxy> exporter);
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
-    std::unique_ptr<metric_sdk::MetricReader> getInstance();
+    std::shared_ptr<metric_sdk::MetricReader> getInstance() override;
 
     void setInterval(libmexclass::proxy::method::Context& context);
 
     void setTimeout(libmexclass::proxy::method::Context& context);
 
+    void getStats(libmexclass::proxy::method::Context& context);
+
+    void publishStats(libmexclass::proxy::method::Context& context);
+
   private:
     metric_sdk::PeriodicExportingMetricReaderOptions CppOptions;
 
     std::shared_ptr<MetricExporterProxy> MetricExporter;
+
+    std::shared_ptr<PipelineStats> Stats;
 };
 } // namespace libmexclass::opentelemetry
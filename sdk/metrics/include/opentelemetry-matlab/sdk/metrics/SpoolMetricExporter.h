@@ -0,0 +1,51 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include "opentelemetry/exporters/otlp/otlp_preferred_temporality.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Metric exporter wrapper that stores collected metrics in a disk spool while the wrapped exporter
+// fails, and replays them once it succeeds again. Metrics are kept as serialized OTLP requests,
+// which are converted back into metric data when they are sent. Unless a temporality is given, the
+// wrapped exporter chooses the aggregation temporality.
+class SpoolMetricExporter : public metric_sdk::PushMetricExporter {
+  public:
+    SpoolMetricExporter(std::unique_ptr<metric_sdk::PushMetricExporter>&& exporter, const SpoolOptions& options);
+
+    SpoolMetricExporter(std::unique_ptr<metric_sdk::PushMetricExporter>&& exporter, const SpoolOptions& options,
+                    otlp_exporter::PreferredAggregationTemporality temporality);
+
+    ::opentelemetry::sdk::common::ExportResult Export(const metric_sdk::ResourceMetrics& data) noexcept override;
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+                    metric_sdk::InstrumentType instrument_type) const noexcept override {
+        return TemporalitySelector ? TemporalitySelector(instrument_type)
+                : Exporter->GetAggregationTemporality(instrument_type);
+    }
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    DeliveryResult deliver(const std::string& request);
+
+    std::unique_ptr<metric_sdk::PushMetricExporter> Exporter;
+    metric_sdk::AggregationTemporalitySelector TemporalitySelector;
+    SpoolForwarder Forwarder;    // declared after Exporter, so that it stops first
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,50 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include <string>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+class SpoolMetricExporterProxy : public MetricExporterProxy {
+  public:
+    SpoolMetricExporterProxy(std::shared_ptr<MetricExporterProxy> exporter) : WrappedExporter(std::move(exporter)) {
+        REGISTER_METHOD(SpoolMetricExporterProxy, setDirectory);
+        REGISTER_METHOD(SpoolMetricExporterProxy, setSegmentSize);
+        REGISTER_METHOD(SpoolMetricExporterProxy, setMaxDiskUsage);
+        REGISTER_METHOD(SpoolMetricExporterProxy, setInitialBackoff);
+        REGISTER_METHOD(SpoolMetricExporterProxy, setMaxBackoff);
+        REGISTER_METHOD(SpoolMetricExporterProxy, setTemporality);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<metric_sdk::PushMetricExporter> getInstance() override;
+
+    void setDirectory(libmexclass::proxy::method::Context& context);
+
+    void setSegmentSize(libmexclass::proxy::method::Context& context);
+
+    void setMaxDiskUsage(libmexclass::proxy::method::Context& context);
+
+    void setInitialBackoff(libmexclass::proxy::method::Context& context);
+
+    void setMaxBackoff(libmexclass::proxy::method::Context& context);
+
+    void setTemporality(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::shared_ptr<MetricExporterProxy> WrappedExporter;
+    SpoolOptions CppOptions;
+    std::string Temporality;    // empty to use the temporality of the wrapped exporter
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,43 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+
+#include <chrono>
+#include <memory>
+
+namespace metric_sdk = opentelemetry::sdk::metrics;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Metric exporter wrapper that records the number of exported data points and the outcome and
+// duration of exports. Metric readers have no queue, so every data point collected is counted
+// as enqueued.
+class StatsMetricExporter : public metric_sdk::PushMetricExporter {
+  public:
+    StatsMetricExporter(std::unique_ptr<metric_sdk::PushMetricExporter>&& exporter, std::shared_ptr<PipelineStats> stats)
+        : Exporter(std::move(exporter)), Stats(std::move(stats)) {}
+
+    ::opentelemetry::sdk::common::ExportResult Export(const metric_sdk::ResourceMetrics& data) noexcept override;
+
+    metric_sdk::AggregationTemporality GetAggregationTemporality(
+		    metric_sdk::InstrumentType instrument_type) const noexcept override {
+        return Exporter->GetAggregationTemporality(instrument_type);
+    }
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->ForceFlush(timeout);
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->Shutdown(timeout);
+    }
+
+  private:
+    std::unique_ptr<metric_sdk::PushMetricExporter> Exporter;
+    std::shared_ptr<PipelineStats> Stats;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,72 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/metrics/AttributeRewriter.h"
+
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Replaces the values of one attribute key by a small set of groups
+struct AttributeRewriteRule {
+    enum class Type {Bins, Prefixes, Patterns, TopN};
+
+    std::string Key;
+    Type RuleType = Type::Bins;
+    std::vector<double> BinEdges;           // Bins: sorted bin edges of numeric values
+    std::vector<std::string> Prefixes;      // Prefixes: a string value becomes its first matching prefix
+    std::vector<std::regex> Patterns;       // Patterns: a string value becomes the group of its first matching pattern
+    std::vector<std::string> Groups;        // Patterns: group names, one per pattern
+    size_t MaxValues = 0;                   // TopN: number of distinct values kept
+    std::string OtherValue = "other";       // replaces values that do not match any group
+};
+
+// Selects the instruments whose rules apply, using the same criteria as a view
+struct AttributeRewriteSelector {
+    SynchronousInstrumentType InstrumentType = SynchronousInstrumentType::Counter;
+    std::string InstrumentName = "*";       // "*" matches all
+    std::string InstrumentUnit;             // empty matches all
+    std::string MeterName;                  // empty matches all
+    std::string MeterVersion;               // empty matches all
+    std::string MeterSchema;                // empty matches all
+    std::vector<std::shared_ptr<const AttributeRewriteRule> > Rules;
+};
+
+// Attribute rewrite rules of the views of a meter provider
+class ViewAttributeRewrites : public AttributeRewriterFactory {
+  public:
+    std::vector<AttributeRewriteSelector> Selectors;
+
+    std::shared_ptr<AttributeRewriter> create(SynchronousInstrumentType type, const std::string& name,
+		    const std::string& unit, const std::string& metername, const std::string& meterversion,
+		    const std::string& meterschema) const override;
+};
+
+// Applies the rewrite rules of the views that select one instrument
+class ViewAttributeRewriter : public AttributeRewriter {
+  public:
+    explicit ViewAttributeRewriter(std::vector<std::shared_ptr<const AttributeRewriteRule> > rules);
+
+    void apply(ProcessedAttributes& attrs) override;
+
+  private:
+    // new value of one attribute, or empty if it is kept
+    std::string rewrite(const std::string& key, const common::AttributeValue& value);
+
+    // the same attribute sets are usually recorded repeatedly, so the new values are cached
+    // for each combination of values of the rewritten keys, to avoid matching patterns again
+    static constexpr size_t MaxCachedSets = 4096;
+
+    std::vector<std::shared_ptr<const AttributeRewriteRule> > Rules;
+    std::vector<std::unordered_set<std::string> > Seen;   // values kept by each TopN rule
+    std::unordered_map<std::string, std::vector<std::string> > Cache;   // new values of the rewritten keys, in order
+    std::mutex Mutex;
+};
+} // namespace libmexclass::opentelemetry::sdk
@@ -7,6 +7,8 @@
 
 #include "libmexclass/proxy/ProxyManager.h"
 
+#include "opentelemetry-matlab/sdk/metrics/ViewAttributeRewriter.h"
+
 #include "opentelemetry/sdk/metrics/view/view.h"
 #include "opentelemetry/sdk/metrics/view/view_factory.h"
 #include "opentelemetry/sdk/metrics/instruments.h"
@@ -19,6 +21,10 @@
 #include "opentelemetry/sdk/metrics/view/meter_selector.h"
 #include "opentelemetry/sdk/metrics/view/meter_selector_factory.h"
 
+#include <cmath>
+#include <limits>
+#include <optional>
+
 namespace metrics_sdk = opentelemetry::sdk::metrics;
 namespace nostd = opentelemetry::nostd;
 
@@ -39,6 +45,12 @@ public:
         REGISTER_METHOD(ViewProxy, setAllowedAttributes);
         REGISTER_METHOD(ViewProxy, setAggregation);
         REGISTER_METHOD(ViewProxy, setHistogramBinEdges);
+        REGISTER_METHOD(ViewProxy, setExponentialHistogramMaxScale);
+        REGISTER_METHOD(ViewProxy, setExponentialHistogramMaxSize);
+        REGISTER_METHOD(ViewProxy, setCardinalityLimit);
+        REGISTER_METHOD(ViewProxy, setQuantileRelativeError);
+        REGISTER_METHOD(ViewProxy, setQuantileDynamicRange);
+        REGISTER_METHOD(ViewProxy, addAttributeRewrite);
     }
     
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
@@ -65,12 +77,33 @@ public:
 
     void setHistogramBinEdges(libmexclass::proxy::method::Context& context);
 
-    std::unique_ptr<metrics_sdk::View> getView();
+    void setExponentialHistogramMaxScale(libmexclass::proxy::method::Context& context);
+
+    void setExponentialHistogramMaxSize(libmexclass::proxy::method::Context& context);
+
+    void setCardinalityLimit(libmexclass::proxy::method::Context& context);
+
+    void setQuantileRelativeError(libmexclass::proxy::method::Context& context);
+
+    void setQuantileDynamicRange(libmexclass::proxy::method::Context& context);
+
+    void addAttributeRewrite(libmexclass::proxy::method::Context& context);
+
+    // default_cardinality_limit applies if the view does not set its own limit
+    std::unique_ptr<metrics_sdk::View> getView(size_t default_cardinality_limit);
+
+    // cardinality limit from a MATLAB value, where Inf means no limit
+    static size_t toCardinalityLimit(double limit) {
+        return std::isinf(limit) ? (std::numeric_limits<size_t>::max)() : static_cast<size_t>(limit);
+    }
 
     std::unique_ptr<metrics_sdk::InstrumentSelector> getInstrumentSelector();
 
     std::unique_ptr<metrics_sdk::MeterSelector> getMeterSelector();
 
+    // Returns false if the view has no attribute rewrite rules, or does not select synchronous instruments
+    bool getAttributeRewriteSelector(AttributeRewriteSelector& selector);
+
 private:
     std::string InstrumentName;
     metrics_sdk::InstrumentType InstrumentType;
@@ -84,6 +117,13 @@ private:
     std::string Description;
     metrics_sdk::AggregationType Aggregation;
     std::vector<double> HistogramBinEdges;
+    int32_t ExponentialHistogramMaxScale = 20;
+    size_t ExponentialHistogramMaxSize = 160;
+    std::optional<size_t> CardinalityLimit;    // unset means use the meter provider default
+    bool QuantileSketch = false;    // exponential histogram sized for QuantileRelativeError and QuantileDynamicRange
+    double QuantileRelativeError = 0.01;
+    double QuantileDynamicRange = 1e6;
+    std::vector<std::shared_ptr<const AttributeRewriteRule> > AttributeRewriteRules;
     metrics_sdk::FilterAttributeMap AllowedAttributes;
     bool FilterAttributes;
 };
@@ -0,0 +1,389 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/FanoutMetricReader.h"
+
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+
+#include <algorithm>
+#include <charconv>
+#include <map>
+#include <type_traits>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+struct FanoutMetricReader::SeriesState {
+    metric_sdk::ValueType Value = int64_t(0);   // sums
+    metric_sdk::ValueType Sum = int64_t(0);     // histograms
+    uint64_t Count = 0;
+    std::vector<uint64_t> Counts;               // explicit bucket histograms
+    int32_t Scale = 0;                          // exponential histograms
+    uint64_t ZeroCount = 0;
+    std::map<int32_t, uint64_t> Positive;
+    std::map<int32_t, uint64_t> Negative;
+    uint64_t LastSeen = 0;                      // export in which the series was last collected
+};
+
+namespace {
+using SeriesState = FanoutMetricReader::SeriesState;
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T>
+struct IsVector<std::vector<T> > : std::true_type {};
+
+template <typename T>
+void appendScalar(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        // length prefixed, so that keys cannot be confused
+        out += std::to_string(value.size());
+        out.push_back(':');
+        out += value;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    } else {
+        out += std::to_string(value);
+    }
+    out.push_back(',');
+}
+
+// identifies a series within a collection, meters with the same name but different versions
+// or schema URLs have separate series
+std::string seriesKey(const ::opentelemetry::sdk::instrumentationscope::InstrumentationScope* scope,
+		const std::string& metric, const metric_sdk::PointAttributes& attributes) {
+    std::string key;
+    appendScalar(key, scope ? scope->GetName() : std::string());
+    appendScalar(key, scope ? scope->GetVersion() : std::string());
+    appendScalar(key, scope ? scope->GetSchemaURL() : std::string());
+    appendScalar(key, metric);
+    for (const auto& [name, value] : attributes) {
+        appendScalar(key, name);
+        key += std::to_string(value.index());
+        key.push_back('=');
+        nostd::visit([&key](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (IsVector<T>::value) {
+                key += std::to_string(v.size());
+                key.push_back('[');
+                for (size_t i = 0; i < v.size(); ++i) {
+                    appendScalar(key, static_cast<typename T::value_type>(v[i]));
+                }
+            } else {
+                appendScalar(key, v);
+            }
+        }, value);
+    }
+    return key;
+}
+
+double toDouble(const metric_sdk::ValueType& value) {
+    return nostd::holds_alternative<double>(value) ? nostd::get<double>(value)
+	    : static_cast<double>(nostd::get<int64_t>(value));
+}
+
+metric_sdk::ValueType subtract(const metric_sdk::ValueType& a, const metric_sdk::ValueType& b) {
+    if (nostd::holds_alternative<int64_t>(a) && nostd::holds_alternative<int64_t>(b)) {
+        return nostd::get<int64_t>(a) - nostd::get<int64_t>(b);
+    }
+    return toDouble(a) - toDouble(b);
+}
+
+std::map<int32_t, uint64_t> bucketMap(metric_sdk::AdaptingCircularBufferCounter* buckets) {
+    std::map<int32_t, uint64_t> result;
+    if (buckets != nullptr && !buckets->Empty()) {
+        for (int32_t i = buckets->StartIndex(); i <= buckets->EndIndex(); ++i) {
+            result[i] = buckets->Get(i);
+        }
+    }
+    return result;
+}
+
+// Buckets minus previous buckets, which are first merged to the current scale. Returns a copy of
+// the buckets if previous is empty.
+std::unique_ptr<metric_sdk::AdaptingCircularBufferCounter> subtractBuckets(
+		metric_sdk::AdaptingCircularBufferCounter* buckets, const std::map<int32_t, uint64_t>& previous, int32_t shift) {
+    if (buckets == nullptr) {
+        return nullptr;
+    }
+    std::map<int32_t, uint64_t> merged;
+    for (const auto& [index, count] : previous) {
+        merged[index >> shift] += count;    // bucket index at the coarser current scale
+    }
+    auto result = std::make_unique<metric_sdk::AdaptingCircularBufferCounter>(buckets->MaxSize());
+    if (!buckets->Empty()) {
+        for (int32_t i = buckets->StartIndex(); i <= buckets->EndIndex(); ++i) {
+            uint64_t count = buckets->Get(i);
+            auto prev = merged.find(i);
+            if (prev != merged.end()) {
+                count -= (std::min)(count, prev->second);
+            }
+            if (count > 0) {
+                result->Increment(i, count);
+            }
+        }
+    }
+    return result;
+}
+
+// Point since the previous export, or a copy of the point if there is no previous export
+metric_sdk::PointType convertPoint(const metric_sdk::PointType& point, const SeriesState* previous) {
+    if (nostd::holds_alternative<metric_sdk::SumPointData>(point)) {
+        const auto& sum = nostd::get<metric_sdk::SumPointData>(point);
+        metric_sdk::SumPointData result;
+        result.is_monotonic_ = sum.is_monotonic_;
+        result.value_ = previous ? subtract(sum.value_, previous->Value) : sum.value_;
+        if (sum.is_monotonic_ && toDouble(result.value_) < 0) {
+            result.value_ = sum.value_;   // the series has been reset
+        }
+        return result;
+    } else if (nostd::holds_alternative<metric_sdk::HistogramPointData>(point)) {
+        const auto& hist = nostd::get<metric_sdk::HistogramPointData>(point);
+        bool reset = previous == nullptr || previous->Counts.size() != hist.counts_.size() || hist.count_ < previous->Count;
+        metric_sdk::HistogramPointData result;
+        result.boundaries_ = hist.boundaries_;
+        result.counts_ = hist.counts_;
+        result.count_ = hist.count_;
+        result.sum_ = hist.sum_;
+        // minimum and maximum since the previous export are unknown
+        result.record_min_max_ = reset && hist.record_min_max_;
+        result.min_ = hist.min_;
+        result.max_ = hist.max_;
+        if (!reset) {
+            for (size_t i = 0; i < result.counts_.size(); ++i) {
+                result.counts_[i] -= (std::min)(result.counts_[i], previous->Counts[i]);
+            }
+            result.count_ -= previous->Count;
+            result.sum_ = subtract(hist.sum_, previous->Sum);
+        }
+        return result;
+    } else if (nostd::holds_alternative<metric_sdk::Base2ExponentialHistogramPointData>(point)) {
+        const auto& hist = nostd::get<metric_sdk::Base2ExponentialHistogramPointData>(point);
+        // the scale of a cumulative histogram can only decrease
+        bool reset = previous == nullptr || hist.count_ < previous->Count || hist.scale_ > previous->Scale;
+        static const std::map<int32_t, uint64_t> none;
+        int32_t shift = reset ? 0 : previous->Scale - hist.scale_;
+        metric_sdk::Base2ExponentialHistogramPointData result;
+        result.scale_ = hist.scale_;
+        result.zero_threshold_ = hist.zero_threshold_;
+        result.count_ = reset ? hist.count_ : hist.count_ - previous->Count;
+        result.zero_count_ = reset ? hist.zero_count_ : hist.zero_count_ - (std::min)(hist.zero_count_, previous->ZeroCount);
+        result.sum_ = reset ? hist.sum_ : hist.sum_ - toDouble(previous->Sum);
+        result.record_min_max_ = reset && hist.record_min_max_;
+        result.min_ = hist.min_;
+        result.max_ = hist.max_;
+        result.positive_buckets_ = subtractBuckets(hist.positive_buckets_.get(), reset ? none : previous->Positive, shift);
+        result.negative_buckets_ = subtractBuckets(hist.negative_buckets_.get(), reset ? none : previous->Negative, shift);
+        return result;
+    } else if (nostd::holds_alternative<metric_sdk::LastValuePointData>(point)) {
+        return nostd::get<metric_sdk::LastValuePointData>(point);
+    }
+    return metric_sdk::DropPointData{};
+}
+
+void updateState(const metric_sdk::PointType& point, SeriesState& state) {
+    if (nostd::holds_alternative<metric_sdk::SumPointData>(point)) {
+        state.Value = nostd::get<metric_sdk::SumPointData>(point).value_;
+    } else if (nostd::holds_alternative<metric_sdk::HistogramPointData>(point)) {
+        const auto& hist = nostd::get<metric_sdk::HistogramPointData>(point);
+        state.Counts = hist.counts_;
+        state.Count = hist.count_;
+        state.Sum = hist.sum_;
+    } else if (nostd::holds_alternative<metric_sdk::Base2ExponentialHistogramPointData>(point)) {
+        const auto& hist = nostd::get<metric_sdk::Base2ExponentialHistogramPointData>(point);
+        state.Count = hist.count_;
+        state.Sum = hist.sum_;
+        state.Scale = hist.scale_;
+        state.ZeroCount = hist.zero_count_;
+        state.Positive = bucketMap(hist.positive_buckets_.get());
+        state.Negative = bucketMap(hist.negative_buckets_.get());
+    }
+}
+} // namespace
+
+FanoutMetricReader::FanoutMetricReader(std::vector<FanoutTarget> targets) {
+    for (auto& target : targets) {
+        Targets.emplace_back();
+        Targets.back().Exporter = std::move(target.exporter);
+        Targets.back().Interval = target.interval;
+    }
+}
+
+FanoutMetricReader::~FanoutMetricReader() {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Stopping = true;
+    }
+    Wake.notify_all();
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+}
+
+metric_sdk::AggregationTemporality FanoutMetricReader::GetAggregationTemporality(
+		metric_sdk::InstrumentType /* instrument_type */) const noexcept {
+    // converted to delta per exporter
+    return metric_sdk::AggregationTemporality::kCumulative;
+}
+
+void FanoutMetricReader::OnInitialized() noexcept {
+    if (Targets.empty()) {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (auto& target : Targets) {
+        // exporters with commensurate intervals become due at the same tick
+        target.NextExport = start + target.Interval;
+    }
+    Worker = std::thread(&FanoutMetricReader::run, this);
+}
+
+bool FanoutMetricReader::OnForceFlush(std::chrono::microseconds timeout) noexcept {
+    bool success = true;
+    collectAndExport(true, success);
+    for (auto& target : Targets) {
+        success = target.Exporter->ForceFlush(timeout) && success;
+    }
+    return success;
+}
+
+bool FanoutMetricReader::OnShutDown(std::chrono::microseconds timeout) noexcept {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Stopping = true;
+    }
+    Wake.notify_all();
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+    // export what has been recorded since the last tick
+    bool success = true;
+    collectAndExport(true, success);
+    for (auto& target : Targets) {
+        success = target.Exporter->Shutdown(timeout) && success;
+    }
+    return success;
+}
+
+void FanoutMetricReader::run() {
+    std::chrono::steady_clock::time_point next;
+    {
+        std::lock_guard<std::mutex> lock(ExportMutex);
+        next = std::min_element(Targets.begin(), Targets.end(), [](const Target& a, const Target& b) {
+            return a.NextExport < b.NextExport; })->NextExport;
+    }
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (!Wake.wait_until(lock, next, [this] { return Stopping; })) {
+        lock.unlock();
+        bool success = true;
+        next = collectAndExport(false, success);
+        lock.lock();
+    }
+}
+
+std::chrono::steady_clock::time_point FanoutMetricReader::collectAndExport(bool force, bool& success) {
+    std::lock_guard<std::mutex> lock(ExportMutex);
+    auto now = std::chrono::steady_clock::now();
+    auto isdue = [force, now](const Target& target) { return force || target.NextExport <= now; };
+    if (std::any_of(Targets.begin(), Targets.end(), isdue)) {
+        success = Collect([this, &isdue, &success](metric_sdk::ResourceMetrics& data) {
+            for (auto& target : Targets) {
+                if (isdue(target)) {
+                    success = exportTo(target, data) && success;
+                }
+            }
+            return true;
+        }) && success;
+    }
+    auto next = (std::chrono::steady_clock::time_point::max)();
+    for (auto& target : Targets) {
+        if (force) {
+            // a forced export starts a new interval
+            target.NextExport = now + target.Interval;
+        }
+        // skip ticks missed while exports were slow
+        while (target.NextExport <= now) {
+            target.NextExport += target.Interval;
+        }
+        next = (std::min)(next, target.NextExport);
+    }
+    return next;
+}
+
+bool FanoutMetricReader::exportTo(Target& target, const metric_sdk::ResourceMetrics& data) {
+    auto isdelta = [&target](const metric_sdk::MetricData& metric) {
+        return target.Exporter->GetAggregationTemporality(metric.instrument_descriptor.type_)
+		== metric_sdk::AggregationTemporality::kDelta;
+    };
+    bool anydelta = false;
+    for (const auto& scopemetrics : data.scope_metric_data_) {
+        anydelta = anydelta || std::any_of(scopemetrics.metric_data_.begin(), scopemetrics.metric_data_.end(), isdelta);
+    }
+    if (!anydelta) {
+        return target.Exporter->Export(data) == common_sdk::ExportResult::kSuccess;
+    }
+
+    metric_sdk::ResourceMetrics converted;
+    converted.resource_ = data.resource_;
+    ::opentelemetry::common::SystemTimestamp exporttime;
+    ++target.Generation;
+    for (const auto& scopemetrics : data.scope_metric_data_) {
+        metric_sdk::ScopeMetrics scopeconverted;
+        scopeconverted.scope_ = scopemetrics.scope_;
+        for (const auto& metric : scopemetrics.metric_data_) {
+            bool delta = isdelta(metric);
+            metric_sdk::MetricData metricconverted;
+            metricconverted.instrument_descriptor = metric.instrument_descriptor;
+            metricconverted.aggregation_temporality = delta ? metric_sdk::AggregationTemporality::kDelta
+		    : metric.aggregation_temporality;
+            metricconverted.start_ts = delta && target.LastExport.time_since_epoch().count() > 0 ? target.LastExport
+		    : metric.start_ts;
+            metricconverted.end_ts = metric.end_ts;
+            exporttime = metric.end_ts;
+            for (const auto& point : metric.point_data_attr_) {
+                const SeriesState* previous = nullptr;
+                std::shared_ptr<SeriesState>* state = nullptr;
+                if (delta) {
+                    state = &target.Previous[seriesKey(scopemetrics.scope_, metric.instrument_descriptor.name_,
+			    point.attributes)];
+                    previous = *state ? state->get() : nullptr;
+                }
+                metric_sdk::PointDataAttributes pointconverted;
+                pointconverted.attributes = point.attributes;
+                pointconverted.point_data = convertPoint(point.point_data, previous);
+                if (delta) {
+                    if (!*state) {
+                        *state = std::make_shared<SeriesState>();
+                    }
+                    updateState(point.point_data, **state);
+                    (*state)->LastSeen = target.Generation;
+                }
+                metricconverted.point_data_attr_.push_back(std::move(pointconverted));
+            }
+            scopeconverted.metric_data_.push_back(std::move(metricconverted));
+        }
+        converted.scope_metric_data_.push_back(std::move(scopeconverted));
+    }
+    // forget series that are no longer collected, such as those of removed instruments
+    for (auto iter = target.Previous.begin(); iter != target.Previous.end();) {
+        if (iter->second->LastSeen != target.Generation) {
+            iter = target.Previous.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    if (exporttime.time_since_epoch().count() > 0) {
+        target.LastExport = exporttime;
+    }
+    return target.Exporter->Export(converted) == common_sdk::ExportResult::kSuccess;
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,27 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/FanoutMetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/FanoutMetricReader.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::sdk {
+std::shared_ptr<metric_sdk::MetricReader> FanoutMetricReaderProxy::getInstance() {
+    std::vector<FanoutTarget> targets;
+    for (const auto& [exporter, interval] : MetricExporters) {
+        FanoutTarget target;
+        target.exporter = exporter->getInstance();
+        target.interval = interval;
+        targets.push_back(std::move(target));
+    }
+    return std::make_shared<FanoutMetricReader>(std::move(targets));
+}
+
+void FanoutMetricReaderProxy::addMetricExporter(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = context.inputs[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    matlab::data::TypedArray<double> interval_mda = context.inputs[1];
+    auto exporter = std::static_pointer_cast<MetricExporterProxy>(libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    MetricExporters.emplace_back(exporter, std::chrono::milliseconds(static_cast<int64_t>(interval_mda[0])));
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,112 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/ManualMetricReader.h"
+
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+ManualMetricReader::ManualMetricReader(std::unique_ptr<metric_sdk::PushMetricExporter> exporter, bool asynchronous,
+		metric_sdk::AggregationTemporality temporality)
+	: Exporter(std::move(exporter)), Asynchronous(asynchronous && Exporter != nullptr), Temporality(temporality) {
+    if (Asynchronous) {
+        Worker = std::thread(&ManualMetricReader::run, this);
+    }
+}
+
+ManualMetricReader::~ManualMetricReader() {
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Stopping = true;
+    }
+    Wake.notify_all();
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+}
+
+bool ManualMetricReader::collect(const std::function<void(const metric_sdk::ResourceMetrics&)>& inspect) {
+    bool exported = true;
+    bool collected = Collect([this, &inspect, &exported](metric_sdk::ResourceMetrics& data) {
+        if (inspect) {
+            inspect(data);
+        }
+        if (Exporter == nullptr) {
+            return true;
+        }
+        if (Asynchronous) {
+            // the collected data only refers to the resource and scopes owned by the meter
+            // provider, which outlive the export thread
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Pending.push_back(std::move(data));
+            }
+            Wake.notify_one();
+        } else {
+            exported = Exporter->Export(data) == common_sdk::ExportResult::kSuccess;
+        }
+        return true;
+    });
+    return collected && exported;
+}
+
+metric_sdk::AggregationTemporality ManualMetricReader::GetAggregationTemporality(
+		metric_sdk::InstrumentType instrument_type) const noexcept {
+    return Exporter == nullptr ? Temporality : Exporter->GetAggregationTemporality(instrument_type);
+}
+
+bool ManualMetricReader::OnForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (Exporter == nullptr) {
+        return true;
+    }
+    if (Asynchronous) {
+        // wait for collections handed to the export thread
+        std::unique_lock<std::mutex> lock(Mutex);
+        auto done = [this] { return Pending.empty() && !Exporting; };
+        if (timeout == (std::chrono::microseconds::max)()) {
+            Idle.wait(lock, done);
+        } else if (!Idle.wait_for(lock, timeout, done)) {
+            return false;
+        }
+    }
+    return Exporter->ForceFlush(timeout);
+}
+
+bool ManualMetricReader::OnShutDown(std::chrono::microseconds timeout) noexcept {
+    if (Exporter == nullptr) {
+        return true;
+    }
+    if (Asynchronous) {
+        // the export thread exports what is still pending before it stops
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Stopping = true;
+        }
+        Wake.notify_all();
+        if (Worker.joinable()) {
+            Worker.join();
+        }
+    }
+    return Exporter->Shutdown(timeout);
+}
+
+void ManualMetricReader::run() {
+    std::unique_lock<std::mutex> lock(Mutex);
+    while (true) {
+        Wake.wait(lock, [this] { return Stopping || !Pending.empty(); });
+        if (Pending.empty()) {
+            break;   // stopping
+        }
+        metric_sdk::ResourceMetrics data = std::move(Pending.front());
+        Pending.pop_front();
+        Exporting = true;
+        lock.unlock();
+        Exporter->Export(data);
+        lock.lock();
+        Exporting = false;
+        if (Pending.empty()) {
+            Idle.notify_all();
+        }
+    }
+    Idle.notify_all();
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,266 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/ManualMetricReaderProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/metrics/data/circular_buffer.h"
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T>
+struct IsVector<std::vector<T> > : std::true_type {};
+
+double toDouble(const metric_sdk::ValueType& value) {
+    return nostd::holds_alternative<double>(value) ? nostd::get<double>(value)
+	    : static_cast<double>(nostd::get<int64_t>(value));
+}
+
+double toSeconds(const ::opentelemetry::common::SystemTimestamp& ts) {
+    return std::chrono::duration<double>(ts.time_since_epoch()).count();
+}
+
+matlab::data::Array toArray(matlab::data::ArrayFactory& factory, const common_sdk::OwnedAttributeValue& value) {
+    return nostd::visit([&factory](const auto& v) -> matlab::data::Array {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+            return factory.createScalar(v);
+        } else if constexpr (std::is_same_v<T, std::vector<std::string> >) {
+            return factory.createArray({1, v.size()}, v.begin(), v.end());
+        } else if constexpr (std::is_same_v<T, std::vector<bool> >) {
+            auto result = factory.createArray<bool>({1, v.size()});
+            for (size_t i = 0; i < v.size(); ++i) {
+                result[0][i] = v[i];
+            }
+            return result;
+        } else if constexpr (IsVector<T>::value) {
+            return factory.createArray<typename T::value_type>({1, v.size()}, v.data(), v.data() + v.size());
+        } else {
+            return factory.createScalar(v);
+        }
+    }, value);
+}
+
+// One row per data point. Histograms fill Count, Sum, Min, Max and the buckets, other
+// aggregations fill Value.
+struct MetricColumns {
+    std::vector<std::string> Name, Unit, Scope, Type;
+    std::vector<matlab::data::Array> AttributeKeys, AttributeValues;
+    std::vector<double> StartTime, EndTime, Value, Count, Sum, Min, Max;
+    std::vector<matlab::data::Array> BucketBounds, BucketCounts;
+
+    void addPoint(matlab::data::ArrayFactory& factory, const std::string& scope, const metric_sdk::MetricData& metric,
+		    const metric_sdk::PointAttributes& attributes) {
+        Name.push_back(metric.instrument_descriptor.name_);
+        Unit.push_back(metric.instrument_descriptor.unit_);
+        Scope.push_back(scope);
+        StartTime.push_back(toSeconds(metric.start_ts));
+        EndTime.push_back(toSeconds(metric.end_ts));
+
+        std::vector<std::string> keys;
+        auto values = factory.createCellArray({1, attributes.size()});
+        size_t i = 0;
+        for (const auto& [key, value] : attributes) {
+            keys.push_back(key);
+            values[0][i++] = toArray(factory, value);
+        }
+        AttributeKeys.push_back(factory.createArray({1, keys.size()}, keys.begin(), keys.end()));
+        AttributeValues.push_back(std::move(values));
+    }
+
+    void setValue(const std::string& type, double value) {
+        Type.push_back(type);
+        Value.push_back(value);
+        Count.push_back(NaN);
+        Sum.push_back(NaN);
+        Min.push_back(NaN);
+        Max.push_back(NaN);
+    }
+
+    void setHistogram(matlab::data::ArrayFactory& factory, const std::string& type, double count, double sum,
+		    double min, double max, const std::vector<double>& bounds, const std::vector<double>& counts) {
+        Type.push_back(type);
+        Value.push_back(NaN);
+        Count.push_back(count);
+        Sum.push_back(sum);
+        Min.push_back(min);
+        Max.push_back(max);
+        BucketBounds.push_back(factory.createArray<double>({1, bounds.size()}, bounds.data(), bounds.data() + bounds.size()));
+        BucketCounts.push_back(factory.createArray<double>({1, counts.size()}, counts.data(), counts.data() + counts.size()));
+    }
+
+    void addMetric(matlab::data::ArrayFactory& factory, const std::string& scope, const metric_sdk::MetricData& metric) {
+        for (const auto& point : metric.point_data_attr_) {
+            if (nostd::holds_alternative<metric_sdk::DropPointData>(point.point_data)) {
+                continue;
+            }
+            addPoint(factory, scope, metric, point.attributes);
+            if (nostd::holds_alternative<metric_sdk::SumPointData>(point.point_data)) {
+                setValue("sum", toDouble(nostd::get<metric_sdk::SumPointData>(point.point_data).value_));
+            } else if (nostd::holds_alternative<metric_sdk::LastValuePointData>(point.point_data)) {
+                const auto& lastvalue = nostd::get<metric_sdk::LastValuePointData>(point.point_data);
+                setValue("gauge", lastvalue.is_lastvalue_valid_ ? toDouble(lastvalue.value_) : NaN);
+            } else if (nostd::holds_alternative<metric_sdk::HistogramPointData>(point.point_data)) {
+                const auto& hist = nostd::get<metric_sdk::HistogramPointData>(point.point_data);
+                std::vector<double> counts(hist.counts_.begin(), hist.counts_.end());
+                setHistogram(factory, "histogram", static_cast<double>(hist.count_), toDouble(hist.sum_),
+				hist.record_min_max_ ? toDouble(hist.min_) : NaN, hist.record_min_max_ ? toDouble(hist.max_) : NaN,
+				hist.boundaries_, counts);
+            } else {
+                const auto& hist = nostd::get<metric_sdk::Base2ExponentialHistogramPointData>(point.point_data);
+                std::vector<double> bounds, counts;
+                exponentialBuckets(hist, bounds, counts);
+                setHistogram(factory, "exponentialhistogram", static_cast<double>(hist.count_), hist.sum_,
+				hist.record_min_max_ ? hist.min_ : NaN, hist.record_min_max_ ? hist.max_ : NaN, bounds, counts);
+            }
+        }
+    }
+
+    // Express exponential buckets like explicit histogram buckets, with the zero bucket between
+    // the negative and positive buckets and an empty bucket beyond each end
+    static void exponentialBuckets(const metric_sdk::Base2ExponentialHistogramPointData& hist,
+		    std::vector<double>& bounds, std::vector<double>& counts) {
+        double exponent = std::ldexp(1.0, -hist.scale_);   // log2 of the bucket base
+        auto edge = [exponent](int32_t index) { return std::exp2(index * exponent); };
+        const auto& negative = hist.negative_buckets_;
+        if (negative && !negative->Empty()) {
+            counts.push_back(0);
+            bounds.push_back(-edge(negative->EndIndex() + 1));
+            for (int32_t i = negative->EndIndex(); i >= negative->StartIndex(); --i) {
+                counts.push_back(static_cast<double>(negative->Get(i)));
+                bounds.push_back(-edge(i));
+            }
+        }
+        counts.push_back(static_cast<double>(hist.zero_count_));
+        const auto& positive = hist.positive_buckets_;
+        if (positive && !positive->Empty()) {
+            for (int32_t i = positive->StartIndex(); i <= positive->EndIndex(); ++i) {
+                bounds.push_back(edge(i));
+                counts.push_back(static_cast<double>(positive->Get(i)));
+            }
+            bounds.push_back(edge(positive->EndIndex() + 1));
+            counts.push_back(0);
+        }
+    }
+
+    matlab::data::StructArray toStruct(matlab::data::ArrayFactory& factory) const {
+        matlab::data::StructArray result = factory.createStructArray({1, 1}, {"Name", "Unit", "Scope", "Type",
+			"AttributeKeys", "AttributeValues", "StartTime", "EndTime", "Value", "Count", "Sum", "Min", "Max",
+			"BucketBounds", "BucketCounts"});
+        result[0]["Name"] = column(factory, Name);
+        result[0]["Unit"] = column(factory, Unit);
+        result[0]["Scope"] = column(factory, Scope);
+        result[0]["Type"] = column(factory, Type);
+        result[0]["AttributeKeys"] = column(factory, AttributeKeys);
+        result[0]["AttributeValues"] = column(factory, AttributeValues);
+        result[0]["StartTime"] = column(factory, StartTime);
+        result[0]["EndTime"] = column(factory, EndTime);
+        result[0]["Value"] = column(factory, Value);
+        result[0]["Count"] = column(factory, Count);
+        result[0]["Sum"] = column(factory, Sum);
+        result[0]["Min"] = column(factory, Min);
+        result[0]["Max"] = column(factory, Max);
+        // buckets are only stored for histograms, other rows get empty buckets
+        std::vector<matlab::data::Array> bounds, counts;
+        auto boundsit = BucketBounds.begin();
+        auto countsit = BucketCounts.begin();
+        for (const auto& type : Type) {
+            bool histogram = type.compare("histogram") == 0 || type.compare("exponentialhistogram") == 0;
+            bounds.push_back(histogram ? *boundsit++ : factory.createArray<double>({1, 0}));
+            counts.push_back(histogram ? *countsit++ : factory.createArray<double>({1, 0}));
+        }
+        result[0]["BucketBounds"] = column(factory, bounds);
+        result[0]["BucketCounts"] = column(factory, counts);
+        return result;
+    }
+
+    static matlab::data::Array column(matlab::data::ArrayFactory& factory, const std::vector<std::string>& values) {
+        return factory.createArray({values.size(), 1}, values.begin(), values.end());
+    }
+
+    static matlab::data::Array column(matlab::data::ArrayFactory& factory, const std::vector<double>& values) {
+        return factory.createArray<double>({values.size(), 1}, values.data(), values.data() + values.size());
+    }
+
+    static matlab::data::Array column(matlab::data::ArrayFactory& factory, const std::vector<matlab::data::Array>& values) {
+        auto result = factory.createCellArray({values.size(), 1});
+        for (size_t i = 0; i < values.size(); ++i) {
+            result[i][0] = values[i];
+        }
+        return result;
+    }
+};
+} // namespace
+
+libmexclass::proxy::MakeResult ManualMetricReaderProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    // the exporter is optional
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    std::shared_ptr<MetricExporterProxy> exporter;
+    if (exporterid_mda.getNumberOfElements() > 0) {
+        libmexclass::proxy::ID exporterid = exporterid_mda[0];
+        exporter = std::static_pointer_cast<MetricExporterProxy>(libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    }
+    return std::make_shared<ManualMetricReaderProxy>(exporter);
+}
+
+std::shared_ptr<metric_sdk::MetricReader> ManualMetricReaderProxy::getInstance() {
+    auto temporality = Temporality.compare("delta") == 0 ? metric_sdk::AggregationTemporality::kDelta
+	    : metric_sdk::AggregationTemporality::kCumulative;
+    Reader = std::make_shared<ManualMetricReader>(MetricExporter ? MetricExporter->getInstance() : nullptr,
+		    Asynchronous, temporality);
+    return Reader;
+}
+
+void ManualMetricReaderProxy::setAsynchronous(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<bool> asynchronous_mda = context.inputs[0];
+    Asynchronous = asynchronous_mda[0];
+}
+
+void ManualMetricReaderProxy::setTemporality(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray temporality_mda = context.inputs[0];
+    Temporality = static_cast<std::string>(temporality_mda[0]);
+}
+
+void ManualMetricReaderProxy::collect(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<bool> returndata_mda = context.inputs[0];
+    bool returndata = returndata_mda[0];
+
+    matlab::data::ArrayFactory factory;
+    MetricColumns columns;
+    bool success = false;
+    if (Reader) {   // not yet added to a meter provider otherwise
+        std::function<void(const metric_sdk::ResourceMetrics&)> inspect;
+        if (returndata) {
+            inspect = [&factory, &columns](const metric_sdk::ResourceMetrics& data) {
+                for (const auto& scopemetrics : data.scope_metric_data_) {
+                    std::string scope = scopemetrics.scope_ ? scopemetrics.scope_->GetName() : "";
+                    for (const auto& metric : scopemetrics.metric_data_) {
+                        columns.addMetric(factory, scope, metric);
+                    }
+                }
+            };
+        }
+        success = Reader->collect(inspect);
+    }
+    context.outputs[0] = factory.createScalar(success);
+    context.outputs[1] = columns.toStruct(factory);
+}
+} // namespace libmexclass::opentelemetry
@@ -1,12 +1,18 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/sdk/metrics/MeterProviderProxy.h"
-#include "opentelemetry-matlab/sdk/metrics/PeriodicExportingMetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricReaderProxy.h"
 #include "opentelemetry-matlab/sdk/metrics/ViewProxy.h"
+#include "opentelemetry-matlab/common/AttributeLimits.h"
 
 #include "libmexclass/proxy/ProxyManager.h"
 
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+#include "opentelemetry/sdk/metrics/exemplar/filter_type.h"
+#endif
+
 #include <chrono>
+#include <cmath>
 
 namespace libmexclass::opentelemetry::sdk {
 libmexclass::proxy::MakeResult MeterProviderProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
@@ -35,35 +41,52 @@ libmexclass::proxy::MakeResult MeterProviderProxy::make(const libmexclass::proxy
     
         auto resource_custom = createResource(resourcenames_mda, resourcevalues_mda);
 
-        auto reader = std::static_pointer_cast<PeriodicExportingMetricReaderProxy>(
+        auto reader = std::static_pointer_cast<MetricReaderProxy>(
 	            libmexclass::proxy::ProxyManager::getProxy(readerid))->getInstance();
         
+        matlab::data::TypedArray<double> cardinalitylimit_mda = constructor_arguments[5];
+        size_t cardinalitylimit = ViewProxy::toCardinalityLimit(cardinalitylimit_mda[0]);
+
         auto view_registry = metrics_sdk::ViewRegistryFactory::Create();
         auto p_sdk = metrics_sdk::MeterProviderFactory::Create(std::move(view_registry), resource_custom);
         p_sdk->AddMetricReader(std::move(reader));
 
 	// View
+        std::shared_ptr<ViewProxy> view;
         matlab::data::TypedArray<bool> supplied_view_mda = constructor_arguments[3];
 	if (supplied_view_mda[0]) {   // process the supplied View
             matlab::data::TypedArray<uint64_t> viewid_mda = constructor_arguments[4];
 	    libmexclass::proxy::ID viewid = viewid_mda[0];
-            auto view = std::static_pointer_cast<ViewProxy>(libmexclass::proxy::ProxyManager::getProxy(viewid));
-            p_sdk->AddView(view->getInstrumentSelector(), view->getMeterSelector(), view->getView());
+            view = std::static_pointer_cast<ViewProxy>(libmexclass::proxy::ProxyManager::getProxy(viewid));
+            p_sdk->AddView(view->getInstrumentSelector(), view->getMeterSelector(), view->getView(cardinalitylimit));
 	}
 
 	nostd::shared_ptr<metrics_sdk::MeterProvider> p_sdk_shared(std::move(p_sdk));
 	nostd::shared_ptr<metrics_api::MeterProvider> p_api_shared(std::move(p_sdk_shared));
-        out = std::make_shared<MeterProviderProxy>(p_api_shared);
+        // a new provider may reuse the address of a deleted one
+        AttributeLimitsRegistry::erase(p_api_shared.get());
+        AttributeRewriteRegistry::erase(p_api_shared.get());
+        auto mpproxy = std::make_shared<MeterProviderProxy>(p_api_shared, cardinalitylimit);
+        if (view) {
+            mpproxy->addAttributeRewrites(*view);
+        }
+        out = mpproxy;
     }
     return out;
 }
 
+MeterProviderProxy::~MeterProviderProxy() {
+    // limits and rewrite rules are keyed by provider address, which a later provider may reuse
+    AttributeLimitsRegistry::erase(CppMeterProvider.get());
+    AttributeRewriteRegistry::erase(CppMeterProvider.get());
+}
+
 void MeterProviderProxy::addMetricReader(libmexclass::proxy::method::Context& context) {
     matlab::data::TypedArray<uint64_t> readerid_mda = context.inputs[0];
     libmexclass::proxy::ID readerid = readerid_mda[0];
 
     static_cast<metrics_sdk::MeterProvider&>(*CppMeterProvider).AddMetricReader(
-		    std::static_pointer_cast<PeriodicExportingMetricReaderProxy>(
+		    std::static_pointer_cast<MetricReaderProxy>(
 			    libmexclass::proxy::ProxyManager::getProxy(readerid))->getInstance());
    return;
 }
@@ -72,14 +95,53 @@ void MeterProviderProxy::addView(libmexclass::proxy::method::Context& context) {
     matlab::data::TypedArray<uint64_t> viewid_mda = context.inputs[0];
     std::shared_ptr<ViewProxy> view = std::static_pointer_cast<ViewProxy>(libmexclass::proxy::ProxyManager::getProxy(viewid_mda[0]));
     static_cast<metrics_sdk::MeterProvider&>(*CppMeterProvider).AddView(
-		    view->getInstrumentSelector(), view->getMeterSelector(), view->getView());
+		    view->getInstrumentSelector(), view->getMeterSelector(), view->getView(CardinalityLimit));
+    addAttributeRewrites(*view);
    return;
 }
 
+void MeterProviderProxy::setExemplarFilter(libmexclass::proxy::method::Context& context) {
+    matlab::data::ArrayFactory factory;
+#ifdef ENABLE_METRICS_EXEMPLAR_PREVIEW
+    matlab::data::StringArray filter_mda = context.inputs[0];
+    matlab::data::String filter_str = filter_mda[0];
+    metrics_sdk::ExemplarFilterType filter;
+    if (filter_str.compare(u"alwayson") == 0) {
+        filter = metrics_sdk::ExemplarFilterType::kAlwaysOn;
+    } else if (filter_str.compare(u"alwaysoff") == 0) {
+        filter = metrics_sdk::ExemplarFilterType::kAlwaysOff;
+    } else {
+        assert(filter_str.compare(u"tracebased") == 0);
+        // measurements recorded while a sampled span is active
+        filter = metrics_sdk::ExemplarFilterType::kTraceBased;
+    }
+    // only instruments created afterwards use the new filter
+    static_cast<metrics_sdk::MeterProvider&>(*CppMeterProvider).SetExemplarFilter(filter);
+    context.outputs[0] = factory.createScalar(true);
+#else
+    // exemplars need the WITH_METRICS_EXEMPLAR option, so report that they are not supported
+    context.outputs[0] = factory.createScalar(false);
+#endif
+}
+
+void MeterProviderProxy::addAttributeRewrites(ViewProxy& view) {
+    AttributeRewriteSelector selector;
+    if (!view.getAttributeRewriteSelector(selector)) {
+        return;
+    }
+    auto rewrites = Rewrites ? std::make_shared<ViewAttributeRewrites>(*Rewrites) : std::make_shared<ViewAttributeRewrites>();
+    rewrites->Selectors.push_back(std::move(selector));
+    Rewrites = rewrites;
+    // instruments that already exist are not affected
+    AttributeRewriteRegistry::set(CppMeterProvider.get(), Rewrites);
+}
+
 void MeterProviderProxy::shutdown(libmexclass::proxy::method::Context& context) {
     matlab::data::ArrayFactory factory;
     auto result_mda = factory.createScalar(static_cast<metrics_sdk::MeterProvider&>(*CppMeterProvider).Shutdown());
     context.outputs[0] = result_mda;
+    AttributeLimitsRegistry::erase(CppMeterProvider.get());
+    AttributeRewriteRegistry::erase(CppMeterProvider.get());
     nostd::shared_ptr<metrics_api::MeterProvider> noop(new metrics_api::NoopMeterProvider);
     CppMeterProvider.swap(noop);
 }
@@ -96,5 +158,18 @@ void MeterProviderProxy::forceFlush(libmexclass::proxy::method::Context& context
     }
 }
 
+void MeterProviderProxy::setArraySummaryThreshold(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> threshold_mda = context.inputs[0];
+    double threshold = threshold_mda[0];
+    if (std::isinf(threshold)) {
+        AttributeLimitsRegistry::erase(CppMeterProvider.get());
+    } else {
+        auto limits = std::make_shared<AttributeLimits>();
+        limits->ArraySummaryThreshold = static_cast<size_t>(threshold);
+        // meters that already exist are not affected
+        AttributeLimitsRegistry::set(CppMeterProvider.get(), std::move(limits));
+    }
+}
+
 
 } // namespace libmexclass::opentelemetry
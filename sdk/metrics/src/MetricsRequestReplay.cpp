@@ -0,0 +1,142 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/MetricsRequestReplay.h"
+#include "opentelemetry-matlab/sdk/common/ProtoConversion.h"
+
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/data/point_data.h"
+
+#include <vector>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace metrics_proto = ::opentelemetry::proto::metrics::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+common::SystemTimestamp toTimestamp(uint64_t nanoseconds) {
+    return common::SystemTimestamp(std::chrono::nanoseconds(nanoseconds));
+}
+
+metric_sdk::ValueType numberValue(const metrics_proto::NumberDataPoint& point) {
+    if (point.value_case() == metrics_proto::NumberDataPoint::kAsInt) {
+        return static_cast<int64_t>(point.as_int());
+    }
+    return point.as_double();
+}
+
+metric_sdk::PointAttributes pointAttributes(
+		const google::protobuf::RepeatedPtrField< ::opentelemetry::proto::common::v1::KeyValue>& keyvalues) {
+    metric_sdk::PointAttributes attributes;
+    ProtoAttributeList attrs(keyvalues);
+    for (const auto& [key, value] : attrs.entries()) {
+        attributes.SetAttribute(key, value);
+    }
+    return attributes;
+}
+
+template <typename Point>
+void setTimes(const Point& point, metric_sdk::MetricData& data) {
+    data.start_ts = toTimestamp(point.start_time_unix_nano());
+    data.end_ts = toTimestamp(point.time_unix_nano());
+}
+
+// Convert one OTLP metric, returns false for data types that cannot be replayed
+bool replayMetric(const metrics_proto::Metric& metric, metric_sdk::MetricData& data) {
+    data.instrument_descriptor.name_ = metric.name();
+    data.instrument_descriptor.description_ = metric.description();
+    data.instrument_descriptor.unit_ = metric.unit();
+    data.instrument_descriptor.value_type_ = metric_sdk::InstrumentValueType::kDouble;
+    if (metric.has_sum()) {
+        const metrics_proto::Sum& sum = metric.sum();
+        data.instrument_descriptor.type_ = sum.is_monotonic() ? metric_sdk::InstrumentType::kCounter
+		: metric_sdk::InstrumentType::kUpDownCounter;
+        // OTLP and SDK number temporalities the same way
+        data.aggregation_temporality = static_cast<metric_sdk::AggregationTemporality>(sum.aggregation_temporality());
+        for (const auto& point : sum.data_points()) {
+            metric_sdk::SumPointData pointdata;
+            pointdata.value_ = numberValue(point);
+            pointdata.is_monotonic_ = sum.is_monotonic();
+            if (point.value_case() == metrics_proto::NumberDataPoint::kAsInt) {
+                data.instrument_descriptor.value_type_ = metric_sdk::InstrumentValueType::kLong;
+            }
+            data.point_data_attr_.push_back({pointAttributes(point.attributes()), pointdata});
+        }
+        if (sum.data_points_size() > 0) {
+            setTimes(sum.data_points(0), data);
+        }
+    } else if (metric.has_gauge()) {
+        const metrics_proto::Gauge& gauge = metric.gauge();
+        data.instrument_descriptor.type_ = metric_sdk::InstrumentType::kObservableGauge;
+        data.aggregation_temporality = metric_sdk::AggregationTemporality::kCumulative;
+        for (const auto& point : gauge.data_points()) {
+            metric_sdk::LastValuePointData pointdata;
+            pointdata.value_ = numberValue(point);
+            pointdata.is_lastvalue_valid_ = true;
+            pointdata.sample_ts_ = toTimestamp(point.time_unix_nano());
+            if (point.value_case() == metrics_proto::NumberDataPoint::kAsInt) {
+                data.instrument_descriptor.value_type_ = metric_sdk::InstrumentValueType::kLong;
+            }
+            data.point_data_attr_.push_back({pointAttributes(point.attributes()), pointdata});
+        }
+        if (gauge.data_points_size() > 0) {
+            setTimes(gauge.data_points(0), data);
+        }
+    } else if (metric.has_histogram()) {
+        const metrics_proto::Histogram& histogram = metric.histogram();
+        data.instrument_descriptor.type_ = metric_sdk::InstrumentType::kHistogram;
+        data.aggregation_temporality = static_cast<metric_sdk::AggregationTemporality>(
+			histogram.aggregation_temporality());
+        for (const auto& point : histogram.data_points()) {
+            metric_sdk::HistogramPointData pointdata;
+            pointdata.boundaries_.assign(point.explicit_bounds().begin(), point.explicit_bounds().end());
+            pointdata.counts_.assign(point.bucket_counts().begin(), point.bucket_counts().end());
+            pointdata.count_ = point.count();
+            pointdata.sum_ = point.sum();
+            pointdata.record_min_max_ = point.has_min() && point.has_max();
+            if (pointdata.record_min_max_) {
+                pointdata.min_ = point.min();
+                pointdata.max_ = point.max();
+            }
+            data.point_data_attr_.push_back({pointAttributes(point.attributes()), pointdata});
+        }
+        if (histogram.data_points_size() > 0) {
+            setTimes(histogram.data_points(0), data);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+common_sdk::ExportResult exportMetricsRequest(
+		const ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest& request,
+		metric_sdk::PushMetricExporter& exporter) {
+    for (const auto& resourcemetrics : request.resource_metrics()) {
+        // the metric data refers to the resource and scopes until the export completes
+        std::unique_ptr<resource::Resource> res = makeResource(resourcemetrics.resource(),
+			resourcemetrics.schema_url());
+        std::vector<std::unique_ptr<instrumentationscope::InstrumentationScope> > scopes;
+        metric_sdk::ResourceMetrics data;
+        data.resource_ = res.get();
+        for (const auto& scopemetrics : resourcemetrics.scope_metrics()) {
+            scopes.push_back(makeInstrumentationScope(scopemetrics.scope(), scopemetrics.schema_url()));
+            metric_sdk::ScopeMetrics scopedata;
+            scopedata.scope_ = scopes.back().get();
+            for (const auto& metric : scopemetrics.metrics()) {
+                metric_sdk::MetricData metricdata;
+                if (replayMetric(metric, metricdata)) {
+                    scopedata.metric_data_.push_back(std::move(metricdata));
+                }
+            }
+            data.scope_metric_data_.push_back(std::move(scopedata));
+        }
+        common_sdk::ExportResult result = exporter.Export(data);
+        if (result != common_sdk::ExportResult::kSuccess) {
+            return result;
+        }
+    }
+    return common_sdk::ExportResult::kSuccess;
+}
+} // namespace libmexclass::opentelemetry
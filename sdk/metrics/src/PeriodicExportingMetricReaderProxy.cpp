@@ -1,9 +1,11 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
 #include "opentelemetry-matlab/sdk/metrics/MetricExporterProxy.h"
 #include "opentelemetry-matlab/sdk/metrics/PeriodicExportingMetricReaderProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/StatsMetricExporter.h"
+#include "opentelemetry-matlab/metrics/MeterProviderProxy.h"
 
 #include "libmexclass/proxy/ProxyManager.h"
 
@@ -11,9 +13,11 @@
 namespace libmexclass::opentelemetry::sdk {
 
 PeriodicExportingMetricReaderProxy::PeriodicExportingMetricReaderProxy(std::shared_ptr<MetricExporterProxy> exporter)
-	: MetricExporter(exporter) {
+	: MetricExporter(exporter), Stats(std::make_shared<PipelineStats>("metrics", "PeriodicExportingMetricReader")) {
     REGISTER_METHOD(PeriodicExportingMetricReaderProxy, setInterval);
     REGISTER_METHOD(PeriodicExportingMetricReaderProxy, setTimeout);
+    REGISTER_METHOD(PeriodicExportingMetricReaderProxy, getStats);
+    REGISTER_METHOD(PeriodicExportingMetricReaderProxy, publishStats);
 }
 
 
@@ -27,9 +31,10 @@ libmexclass::proxy::MakeResult PeriodicExportingMetricReaderProxy::make(const li
 }
 
 
-std::unique_ptr<metric_sdk::MetricReader> PeriodicExportingMetricReaderProxy::getInstance(){
-    return std::unique_ptr<metric_sdk::MetricReader> (
-        metric_sdk::PeriodicExportingMetricReaderFactory::Create(std::move(MetricExporter->getInstance()), CppOptions));
+std::shared_ptr<metric_sdk::MetricReader> PeriodicExportingMetricReaderProxy::getInstance(){
+    return std::shared_ptr<metric_sdk::MetricReader> (
+        metric_sdk::PeriodicExportingMetricReaderFactory::Create(std::unique_ptr<metric_sdk::PushMetricExporter>(
+            new StatsMetricExporter(MetricExporter->getInstance(), Stats)), CppOptions));
 }
 
 
@@ -43,4 +48,16 @@ void PeriodicExportingMetricReaderProxy::setTimeout(libmexclass::proxy::method::
     CppOptions.export_timeout_millis = std::chrono::milliseconds(static_cast<int64_t>(timeout_mda[0]));
 }
 
+void PeriodicExportingMetricReaderProxy::getStats(libmexclass::proxy::method::Context& context) {
+    context.outputs[0] = Stats->toStruct();
+}
+
+void PeriodicExportingMetricReaderProxy::publishStats(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<uint64_t> mpid_mda = context.inputs[0];
+    libmexclass::proxy::ID mpid = mpid_mda[0];
+    auto mp = std::static_pointer_cast<libmexclass::opentelemetry::MeterProviderProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(mpid))->getInstance();
+    Stats->publish(mp->GetMeter("opentelemetry-matlab"));
+}
+
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,59 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/SpoolMetricExporter.h"
+#include "opentelemetry-matlab/sdk/metrics/MetricsRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/otlp_metric_utils.h"
+
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+SpoolMetricExporter::SpoolMetricExporter(std::unique_ptr<metric_sdk::PushMetricExporter>&& exporter,
+                const SpoolOptions& options)
+        : Exporter(std::move(exporter)),
+          Forwarder(options, [this](const std::string& request) { return deliver(request); }) {}
+
+SpoolMetricExporter::SpoolMetricExporter(std::unique_ptr<metric_sdk::PushMetricExporter>&& exporter,
+                const SpoolOptions& options, otlp_exporter::PreferredAggregationTemporality temporality)
+        : SpoolMetricExporter(std::move(exporter), options) {
+    TemporalitySelector = otlp_exporter::OtlpMetricUtils::ChooseTemporalitySelector(temporality);
+}
+
+common_sdk::ExportResult SpoolMetricExporter::Export(const metric_sdk::ResourceMetrics& data) noexcept {
+    if (IsShutdown.load()) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+    otlp_exporter::OtlpMetricUtils::PopulateRequest(data, &request);
+    if (request.resource_metrics_size() == 0) {
+        return common_sdk::ExportResult::kSuccess;
+    }
+    std::string serialized;
+    if (!request.SerializeToString(&serialized) || !Forwarder.submit(serialized)) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    return common_sdk::ExportResult::kSuccess;
+}
+
+DeliveryResult SpoolMetricExporter::deliver(const std::string& serialized) {
+    ::opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+    if (!request.ParseFromString(serialized)) {
+        return DeliveryResult::Rejected;   // unreadable, discard rather than retry forever
+    }
+    // requests written by Export hold a single resource, so nothing is sent twice on retry
+    return toDeliveryResult(exportMetricsRequest(request, *Exporter));
+}
+
+bool SpoolMetricExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    bool drained = Forwarder.drain(timeout);
+    return Exporter->ForceFlush(timeout) && drained;
+}
+
+bool SpoolMetricExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    // make one last attempt, anything left stays on disk for the next session
+    Forwarder.drain(timeout);
+    Forwarder.stop();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,61 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/SpoolMetricExporterProxy.h"
+#include "opentelemetry-matlab/sdk/metrics/SpoolMetricExporter.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::sdk {
+libmexclass::proxy::MakeResult SpoolMetricExporterProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    auto exporter = std::static_pointer_cast<MetricExporterProxy>(
+            libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    // the spool relies on Export reporting failures
+    if (exporter->exportsAsynchronously()) {
+        return libmexclass::error::Error{"opentelemetry:sdk:metrics:SpoolMetricExporter:AsynchronousExporter",
+                "Exporters that send data asynchronously cannot be spooled."};
+    }
+    return std::make_shared<SpoolMetricExporterProxy>(exporter);
+}
+
+std::unique_ptr<metric_sdk::PushMetricExporter> SpoolMetricExporterProxy::getInstance() {
+    if (Temporality.empty()) {
+        return std::unique_ptr<metric_sdk::PushMetricExporter>(new SpoolMetricExporter(WrappedExporter->getInstance(), CppOptions));
+    }
+    auto temporality = Temporality.compare("delta") == 0 ? otlp_exporter::PreferredAggregationTemporality::kDelta
+            : otlp_exporter::PreferredAggregationTemporality::kCumulative;
+    return std::unique_ptr<metric_sdk::PushMetricExporter>(new SpoolMetricExporter(WrappedExporter->getInstance(),
+            CppOptions, temporality));
+}
+
+void SpoolMetricExporterProxy::setDirectory(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray directory_mda = context.inputs[0];
+    CppOptions.directory = static_cast<std::string>(directory_mda[0]);
+}
+
+void SpoolMetricExporterProxy::setSegmentSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> segmentsize_mda = context.inputs[0];
+    CppOptions.segment_size = static_cast<size_t>(segmentsize_mda[0]);
+}
+
+void SpoolMetricExporterProxy::setMaxDiskUsage(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxbytes_mda = context.inputs[0];
+    CppOptions.max_bytes = static_cast<size_t>(maxbytes_mda[0]);
+}
+
+void SpoolMetricExporterProxy::setInitialBackoff(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> backoff_mda = context.inputs[0];
+    CppOptions.initial_backoff = std::chrono::milliseconds(static_cast<int64_t>(backoff_mda[0]));
+}
+
+void SpoolMetricExporterProxy::setMaxBackoff(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> backoff_mda = context.inputs[0];
+    CppOptions.max_backoff = std::chrono::milliseconds(static_cast<int64_t>(backoff_mda[0]));
+}
+
+void SpoolMetricExporterProxy::setTemporality(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray temporality_mda = context.inputs[0];
+    Temporality = static_cast<std::string>(temporality_mda[0]);
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,24 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/StatsMetricExporter.h"
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+common_sdk::ExportResult StatsMetricExporter::Export(const metric_sdk::ResourceMetrics& data) noexcept {
+    uint64_t npoints = 0;
+    for (const auto& scope : data.scope_metric_data_) {
+        for (const auto& metric : scope.metric_data_) {
+            npoints += metric.point_data_attr_.size();
+        }
+    }
+    Stats->recordEnqueued(npoints);
+    auto start = std::chrono::steady_clock::now();
+    common_sdk::ExportResult result = Exporter->Export(data);
+    Stats->recordExport(npoints, result == common_sdk::ExportResult::kSuccess,
+		    std::chrono::steady_clock::now() - start);
+    return result;
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,209 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/metrics/ViewAttributeRewriter.h"
+
+#include "opentelemetry/nostd/variant.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+bool matches(const std::string& selector, const std::string& value, bool wildcard) {
+    return selector.empty() || (wildcard && selector == "*") || selector == value;
+}
+
+// numeric value of a scalar attribute, returns false for other types
+bool toDouble(const common::AttributeValue& value, double& out) {
+    if (nostd::holds_alternative<double>(value)) {
+        out = nostd::get<double>(value);
+    } else if (nostd::holds_alternative<int32_t>(value)) {
+        out = nostd::get<int32_t>(value);
+    } else if (nostd::holds_alternative<uint32_t>(value)) {
+        out = nostd::get<uint32_t>(value);
+    } else if (nostd::holds_alternative<int64_t>(value)) {
+        out = static_cast<double>(nostd::get<int64_t>(value));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// text of a scalar string or numeric attribute, returns false for other types
+bool toString(const common::AttributeValue& value, std::string& out) {
+    if (nostd::holds_alternative<nostd::string_view>(value)) {
+        nostd::string_view str = nostd::get<nostd::string_view>(value);
+        out.assign(str.data(), str.size());
+        return true;
+    }
+    double num;
+    if (!toDouble(value, num)) {
+        return false;
+    }
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), num);
+    out.assign(buf, result.ptr);
+    return true;
+}
+
+std::string formatEdge(double edge) {
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), edge);
+    return std::string(buf, result.ptr);
+}
+
+// label of the bin containing value, bins include their lower edge
+std::string binLabel(const std::vector<double>& edges, double value) {
+    if (std::isnan(value)) {
+        return "NaN";
+    }
+    auto upper = std::upper_bound(edges.begin(), edges.end(), value);
+    std::string lower = upper == edges.begin() ? "-Inf" : formatEdge(*(upper - 1));
+    std::string higher = upper == edges.end() ? "Inf" : formatEdge(*upper);
+    return "[" + lower + "," + higher + ")";
+}
+
+// appends an attribute to the key of a cached attribute set, values that no rule applies to
+// are left out, since they are not rewritten
+void appendCacheKey(std::string& cachekey, const std::string& key, const common::AttributeValue& value) {
+    std::string text;
+    char type = 'x';
+    if (nostd::holds_alternative<nostd::string_view>(value)) {
+        type = 's';
+        toString(value, text);
+    } else if (toString(value, text)) {
+        type = 'n';
+    }
+    // lengths keep keys unambiguous for any content
+    cachekey += std::to_string(key.size());
+    cachekey.push_back(':');
+    cachekey += key;
+    cachekey.push_back(type);
+    cachekey += std::to_string(text.size());
+    cachekey.push_back(':');
+    cachekey += text;
+}
+} // namespace
+
+ViewAttributeRewriter::ViewAttributeRewriter(std::vector<std::shared_ptr<const AttributeRewriteRule> > rules)
+	: Rules(std::move(rules)), Seen(Rules.size()) {}
+
+std::shared_ptr<AttributeRewriter> ViewAttributeRewrites::create(SynchronousInstrumentType type, const std::string& name,
+		const std::string& unit, const std::string& metername, const std::string& meterversion,
+		const std::string& meterschema) const {
+    std::vector<std::shared_ptr<const AttributeRewriteRule> > rules;
+    for (const auto& selector : Selectors) {
+        if (selector.InstrumentType == type && matches(selector.InstrumentName, name, true)
+		&& matches(selector.InstrumentUnit, unit, false) && matches(selector.MeterName, metername, false)
+		&& matches(selector.MeterVersion, meterversion, false) && matches(selector.MeterSchema, meterschema, false)) {
+            rules.insert(rules.end(), selector.Rules.begin(), selector.Rules.end());
+        }
+    }
+    return rules.empty() ? nullptr : std::make_shared<ViewAttributeRewriter>(std::move(rules));
+}
+
+void ViewAttributeRewriter::apply(ProcessedAttributes& attrs) {
+    std::vector<std::pair<std::string, common::AttributeValue>*> rewritten;   // attributes with rules
+    std::string cachekey;
+    for (auto& attr : attrs.Attributes) {
+        if (std::any_of(Rules.begin(), Rules.end(), [&attr](const auto& rule) { return rule->Key == attr.first; })) {
+            rewritten.push_back(&attr);
+            appendCacheKey(cachekey, attr.first, attr.second);
+        }
+    }
+    if (rewritten.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    auto iter = Cache.find(cachekey);
+    if (iter == Cache.end()) {
+        std::vector<std::string> newvalues;
+        newvalues.reserve(rewritten.size());
+        for (const auto* attr : rewritten) {
+            newvalues.push_back(rewrite(attr->first, attr->second));
+        }
+        if (Cache.size() >= MaxCachedSets) {
+            Cache.clear();
+        }
+        iter = Cache.emplace(std::move(cachekey), std::move(newvalues)).first;
+    }
+    for (size_t i = 0; i < rewritten.size(); ++i) {
+        if (!iter->second[i].empty()) {
+            attrs.StringBuffer.push_back(iter->second[i]);
+            rewritten[i]->second = nostd::string_view(attrs.StringBuffer.back());
+        }
+    }
+}
+
+std::string ViewAttributeRewriter::rewrite(const std::string& key, const common::AttributeValue& value) {
+    for (size_t r = 0; r < Rules.size(); ++r) {
+        const AttributeRewriteRule& rule = *Rules[r];
+        if (key != rule.Key) {
+            continue;
+        }
+        std::string newvalue;
+        bool applicable = true;
+        switch (rule.RuleType) {
+            case AttributeRewriteRule::Type::Bins:
+            {
+                double num;
+                applicable = toDouble(value, num);
+                if (applicable) {
+                    newvalue = binLabel(rule.BinEdges, num);
+                }
+            }
+                break;
+            case AttributeRewriteRule::Type::Prefixes:
+            case AttributeRewriteRule::Type::Patterns:
+            {
+                applicable = nostd::holds_alternative<nostd::string_view>(value);
+                if (!applicable) {
+                    break;
+                }
+                nostd::string_view str = nostd::get<nostd::string_view>(value);
+                newvalue = rule.OtherValue;
+                if (rule.RuleType == AttributeRewriteRule::Type::Prefixes) {
+                    for (const auto& prefix : rule.Prefixes) {
+                        if (str.size() >= prefix.size() && str.substr(0, prefix.size()) == prefix) {
+                            newvalue = prefix;
+                            break;
+                        }
+                    }
+                } else {
+                    for (size_t p = 0; p < rule.Patterns.size(); ++p) {
+                        if (std::regex_search(str.data(), str.data() + str.size(), rule.Patterns[p])) {
+                            newvalue = rule.Groups[p];
+                            break;
+                        }
+                    }
+                }
+            }
+                break;
+            case AttributeRewriteRule::Type::TopN:
+            {
+                // the first distinct values seen are kept, later ones are grouped together. Values
+                // are only counted once, so cached results stay valid.
+                std::string str;
+                applicable = toString(value, str);
+                if (!applicable) {
+                    break;
+                }
+                if (Seen[r].count(str) > 0 || Seen[r].size() < rule.MaxValues) {
+                    Seen[r].insert(std::move(str));
+                } else {
+                    newvalue = rule.OtherValue;
+                }
+            }
+                break;
+        }
+        // a key is handled by its first applicable rule only
+        if (applicable) {
+            return newvalue;
+        }
+    }
+    return "";   // no rule applies to this type of value
+}
+} // namespace libmexclass::opentelemetry::sdk
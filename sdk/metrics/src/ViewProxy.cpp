@@ -4,6 +4,9 @@
 
 #include "libmexclass/proxy/ProxyManager.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace libmexclass::opentelemetry::sdk {
 libmexclass::proxy::MakeResult ViewProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
     return std::make_shared<ViewProxy>();
@@ -85,6 +88,7 @@ void ViewProxy::setAllowedAttributes(libmexclass::proxy::method::Context& contex
 void ViewProxy::setAggregation(libmexclass::proxy::method::Context& context) {
     matlab::data::StringArray aggregation_type_mda = context.inputs[0];
     matlab::data::String aggregation_type_str = aggregation_type_mda[0];
+    QuantileSketch = false;
     if (aggregation_type_str.compare(u"sum") == 0) {
         Aggregation = metrics_sdk::AggregationType::kSum;
     } else if (aggregation_type_str.compare(u"drop") == 0) {
@@ -93,6 +97,11 @@ void ViewProxy::setAggregation(libmexclass::proxy::method::Context& context) {
         Aggregation = metrics_sdk::AggregationType::kLastValue;
     } else if (aggregation_type_str.compare(u"histogram") == 0) {
         Aggregation = metrics_sdk::AggregationType::kHistogram;
+    } else if (aggregation_type_str.compare(u"exponentialhistogram") == 0) {
+        Aggregation = metrics_sdk::AggregationType::kBase2ExponentialHistogram;
+    } else if (aggregation_type_str.compare(u"quantile") == 0) {
+        Aggregation = metrics_sdk::AggregationType::kBase2ExponentialHistogram;
+        QuantileSketch = true;
     } else {
         assert(aggregation_type_str.compare(u"default") == 0);
         Aggregation = metrics_sdk::AggregationType::kDefault;
@@ -105,9 +114,83 @@ void ViewProxy::setHistogramBinEdges(libmexclass::proxy::method::Context& contex
         HistogramBinEdges.push_back(h);
     }
 }
+
+void ViewProxy::setExponentialHistogramMaxScale(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxscale_mda = context.inputs[0];
+    ExponentialHistogramMaxScale = static_cast<int32_t>(maxscale_mda[0]);
+}
+
+void ViewProxy::setExponentialHistogramMaxSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxsize_mda = context.inputs[0];
+    ExponentialHistogramMaxSize = static_cast<size_t>(maxsize_mda[0]);
+}
+
+void ViewProxy::setCardinalityLimit(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> limit_mda = context.inputs[0];
+    if (limit_mda.getNumberOfElements() == 0) {
+        CardinalityLimit.reset();    // inherit from the meter provider
+    } else {
+        CardinalityLimit = toCardinalityLimit(limit_mda[0]);
+    }
+}
+
+void ViewProxy::setQuantileRelativeError(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> error_mda = context.inputs[0];
+    QuantileRelativeError = error_mda[0];
+}
+
+void ViewProxy::setQuantileDynamicRange(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> range_mda = context.inputs[0];
+    QuantileDynamicRange = range_mda[0];
+}
+
+void ViewProxy::addAttributeRewrite(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray key_mda = context.inputs[0];
+    matlab::data::StringArray type_mda = context.inputs[1];
+    matlab::data::TypedArray<double> numbers_mda = context.inputs[2];
+    matlab::data::StringArray strings_mda = context.inputs[3];
+    matlab::data::StringArray groups_mda = context.inputs[4];
+    matlab::data::StringArray other_mda = context.inputs[5];
+
+    auto rule = std::make_shared<AttributeRewriteRule>();
+    rule->Key = static_cast<std::string>(key_mda[0]);
+    rule->OtherValue = static_cast<std::string>(other_mda[0]);
+    matlab::data::String type_str = type_mda[0];
+    if (type_str.compare(u"bins") == 0) {
+        rule->RuleType = AttributeRewriteRule::Type::Bins;
+        for (auto edge : numbers_mda) {
+            rule->BinEdges.push_back(edge);
+        }
+        std::sort(rule->BinEdges.begin(), rule->BinEdges.end());
+    } else if (type_str.compare(u"prefixes") == 0) {
+        rule->RuleType = AttributeRewriteRule::Type::Prefixes;
+        for (size_t i = 0; i < strings_mda.getNumberOfElements(); ++i) {
+            rule->Prefixes.push_back(static_cast<std::string>(strings_mda[i]));
+        }
+    } else if (type_str.compare(u"patterns") == 0) {
+        rule->RuleType = AttributeRewriteRule::Type::Patterns;
+        for (size_t i = 0; i < strings_mda.getNumberOfElements(); ++i) {
+            std::string pattern = static_cast<std::string>(strings_mda[i]);
+            try {
+                rule->Patterns.emplace_back(pattern, std::regex::ECMAScript | std::regex::optimize);
+            } catch (const std::regex_error&) {
+                // reject the whole rule, rather than silently grouping values as OtherValue
+                context.error = libmexclass::error::Error{"opentelemetry:sdk:metrics:View:InvalidAttributeRewrite",
+                    "Invalid regular expression \"" + pattern + "\" in Patterns."};
+                return;
+            }
+            rule->Groups.push_back(static_cast<std::string>(groups_mda[i]));
+        }
+    } else {
+        assert(type_str.compare(u"topn") == 0);
+        rule->RuleType = AttributeRewriteRule::Type::TopN;
+        rule->MaxValues = static_cast<size_t>(numbers_mda[0]);
+    }
+    AttributeRewriteRules.push_back(std::move(rule));
+}
     
 // Methods to generate input objects for MeterProvider.addView
-std::unique_ptr<metrics_sdk::View> ViewProxy::getView(){
+std::unique_ptr<metrics_sdk::View> ViewProxy::getView(size_t default_cardinality_limit){
     // AttributesProcessor
     std::unique_ptr<metrics_sdk::AttributesProcessor> attributes_processor;
     if(FilterAttributes){
@@ -123,9 +206,32 @@ std::unique_ptr<metrics_sdk::View> ViewProxy::getView(){
 	auto histogram_aggregation_config = std::make_shared<metrics_sdk::HistogramAggregationConfig>();
         histogram_aggregation_config->boundaries_ = HistogramBinEdges;
 	aggregation_config = histogram_aggregation_config;
+    } else if (Aggregation == metrics_sdk::AggregationType::kBase2ExponentialHistogram) {
+        // bucket index is computed directly from the exponent and mantissa of each value, and the
+        // scale is lowered whenever the recorded range needs more than the maximum number of buckets
+	auto exponential_aggregation_config = std::make_shared<metrics_sdk::Base2ExponentialHistogramAggregationConfig>();
+        if (QuantileSketch) {
+            // Estimating a quantile by the harmonic mean of its bucket boundaries has a relative error of
+            // (b-1)/(b+1), with b = 2^(2^-scale) the ratio of the boundaries. Pick the smallest scale that
+            // meets the requested error, and enough buckets to keep it over the dynamic range, which fixes
+            // the memory of each series like a DDSketch with a bounded number of bins.
+            double ratio = (1 + QuantileRelativeError) / (1 - QuantileRelativeError);
+            double scale = std::ceil(-std::log2(std::log2(ratio)) - 1e-9);
+            int32_t max_scale = static_cast<int32_t>((std::min)((std::max)(scale, -10.0), 20.0));
+            double buckets = std::ceil(std::log2(QuantileDynamicRange) * std::ldexp(1.0, max_scale));
+            exponential_aggregation_config->max_scale_ = max_scale;
+            exponential_aggregation_config->max_buckets_ = static_cast<size_t>((std::max)(buckets, 2.0));
+        } else {
+            exponential_aggregation_config->max_scale_ = ExponentialHistogramMaxScale;
+            exponential_aggregation_config->max_buckets_ = ExponentialHistogramMaxSize;
+        }
+	aggregation_config = exponential_aggregation_config;
     } else {
 	aggregation_config = std::make_shared<metrics_sdk::AggregationConfig>();
     }
+    // attribute sets beyond the limit are merged into a single series with the attribute
+    // otel.metric.overflow=true
+    aggregation_config->cardinality_limit_ = CardinalityLimit.value_or(default_cardinality_limit);
 
     // View
     return metrics_sdk::ViewFactory::Create(Name, Description, Aggregation, aggregation_config, std::move(attributes_processor));
@@ -139,4 +245,34 @@ std::unique_ptr<metrics_sdk::MeterSelector> ViewProxy::getMeterSelector(){
     return metrics_sdk::MeterSelectorFactory::Create(MeterName, MeterVersion, MeterSchema);
 }
 
+bool ViewProxy::getAttributeRewriteSelector(AttributeRewriteSelector& selector){
+    if (AttributeRewriteRules.empty()) {
+        return false;
+    }
+    switch (InstrumentType) {
+        case metrics_sdk::InstrumentType::kCounter:
+            selector.InstrumentType = SynchronousInstrumentType::Counter;
+            break;
+        case metrics_sdk::InstrumentType::kUpDownCounter:
+            selector.InstrumentType = SynchronousInstrumentType::UpDownCounter;
+            break;
+        case metrics_sdk::InstrumentType::kHistogram:
+            selector.InstrumentType = SynchronousInstrumentType::Histogram;
+            break;
+        case metrics_sdk::InstrumentType::kGauge:
+            selector.InstrumentType = SynchronousInstrumentType::Gauge;
+            break;
+        default:
+            // attributes of observable instruments are not rewritten
+            return false;
+    }
+    selector.InstrumentName = InstrumentName;
+    selector.InstrumentUnit = InstrumentUnit;
+    selector.MeterName = MeterName;
+    selector.MeterVersion = MeterVersion;
+    selector.MeterSchema = MeterSchema;
+    selector.Rules = AttributeRewriteRules;
+    return true;
+}
+
 }
@@ -0,0 +1,65 @@
+classdef ChromeTraceSpanExporter < opentelemetry.sdk.trace.SpanExporter
+% Chrome trace span exporter writes spans to a file in the Chrome trace
+% event format, which can be opened in Perfetto or chrome://tracing.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        FileName (1,1) string = "trace.json"    % Output file name
+    end
+
+    methods
+        function obj = ChromeTraceSpanExporter(optionnames, optionvalues)
+            % Chrome trace span exporter writes spans to a file in the
+            % Chrome trace event format.
+            %    EXP = OPENTELEMETRY.SDK.TRACE.CHROMETRACESPANEXPORTER
+            %    creates an exporter that writes to "trace.json". Each span
+            %    is written as a complete event with its attributes as
+            %    args, and each span event as an instant event. Nested
+            %    spans of a trace share a track, so that they are shown as
+            %    a call stack. Spans with a "thread.id" attribute are
+            %    placed on the track of that thread instead. The file can
+            %    be opened in Perfetto (https://ui.perfetto.dev) or
+            %    chrome://tracing without running a collector, for example
+            %    to profile code instrumented with AutoTrace.
+            %
+            %    Spans are written to the file as they are exported. The
+            %    file is completed when the tracer provider is shut down,
+            %    but can be viewed before that.
+            %
+            %    EXP = OPENTELEMETRY.SDK.TRACE.CHROMETRACESPANEXPORTER(
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "FileName"          - Output file name. Default is
+            %                             "trace.json".
+            %
+            %    See also OPENTELEMETRY.AUTOINSTRUMENT.AUTOTRACE,
+            %    OPENTELEMETRY.SDK.TRACE.SIMPLESPANPROCESSOR,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILESPANEXPORTER
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            obj = obj@opentelemetry.sdk.trace.SpanExporter(...
+                "libmexclass.opentelemetry.sdk.ChromeTraceSpanExporterProxy");
+
+            validnames = "FileName";
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function obj = set.FileName(obj, fn)
+            if ~(isStringScalar(fn) || (ischar(fn) && isrow(fn))) || strlength(fn) == 0
+                error("opentelemetry:sdk:trace:ChromeTraceSpanExporter:InvalidFileName", ...
+                    "FileName must be a nonempty string scalar.");
+            end
+            fn = string(fn);
+            obj.Proxy.setFileName(fn);
+            obj.FileName = fn;
+        end
+    end
+end
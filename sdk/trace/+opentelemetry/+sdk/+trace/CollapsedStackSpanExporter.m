@@ -0,0 +1,70 @@
+classdef CollapsedStackSpanExporter < opentelemetry.sdk.trace.SpanExporter
+% Collapsed stack span exporter writes the profile records of a
+% CollapsedStackSpanProcessor to a collapsed stack file, which is the
+% input format of flame graph tools.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        FileName (1,1) string = "stacks.folded"    % Output file name
+        Metric (1,1) string = "SelfTime"           % Value written for each stack, "SelfTime", "TotalTime", or "Count"
+    end
+
+    methods
+        function obj = CollapsedStackSpanExporter(optionnames, optionvalues)
+            % Collapsed stack span exporter writes profile records to a
+            % collapsed stack file.
+            %    EXP = OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANEXPORTER
+            %    creates an exporter that writes to "stacks.folded". The
+            %    file has one line per stack, consisting of the stack and
+            %    a value separated by a space, for example
+            %    "main;solve;step 1520". It can be read by flame graph
+            %    tools such as flamegraph.pl and speedscope. Values are
+            %    summed over all exports, and the file is replaced after
+            %    each export.
+            %
+            %    EXP = OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANEXPORTER(
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "FileName"          - Output file name. Default is
+            %                             "stacks.folded".
+            %       "Metric"            - Value written for each stack.
+            %                             "SelfTime" and "TotalTime" are
+            %                             in microseconds, and "Count" is
+            %                             the number of spans. Default is
+            %                             "SelfTime".
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANPROCESSOR
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            obj = obj@opentelemetry.sdk.trace.SpanExporter(...
+                "libmexclass.opentelemetry.sdk.CollapsedStackSpanExporterProxy");
+
+            validnames = ["FileName", "Metric"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function obj = set.FileName(obj, fn)
+            if ~(isStringScalar(fn) || (ischar(fn) && isrow(fn))) || strlength(fn) == 0
+                error("opentelemetry:sdk:trace:CollapsedStackSpanExporter:InvalidFileName", ...
+                    "FileName must be a nonempty string scalar.");
+            end
+            fn = string(fn);
+            obj.Proxy.setFileName(fn);
+            obj.FileName = fn;
+        end
+
+        function obj = set.Metric(obj, metric)
+            metric = string(validatestring(metric, ["SelfTime", "TotalTime", "Count"]));
+            obj.Proxy.setMetric(metric);
+            obj.Metric = metric;
+        end
+    end
+end
@@ -0,0 +1,87 @@
+classdef CollapsedStackSpanProcessor < opentelemetry.sdk.trace.SpanProcessor
+% Collapsed stack span processor folds spans into call stacks and exports
+% one profile record per stack, with summed self time and total time,
+% instead of exporting every span.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        ExportInterval (1,1) duration = seconds(Inf)   % Time between exports of profile records, Inf to export only on flush
+    end
+
+    methods
+        function obj = CollapsedStackSpanProcessor(varargin)
+            % Collapsed stack span processor folds spans into call stacks
+            % and exports one profile record per stack.
+            %    CSP = OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANPROCESSOR
+            %    creates a collapsed stack span processor that writes a
+            %    collapsed stack file using a CollapsedStackSpanExporter.
+            %
+            %    The stack of a span is the chain of span names from its
+            %    root span, joined by semicolons, such as "main;solve;step".
+            %    For each stack, the processor sums the number of spans,
+            %    the total time, and the self time, which excludes the
+            %    time of child spans. This makes it suitable for profiling
+            %    code instrumented with AutoTrace, which creates one span
+            %    per function call.
+            %
+            %    CSP = OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANPROCESSOR(EXP)
+            %    specifies the span exporter. Each profile record is passed
+            %    to EXP as a span named after its stack, with attributes
+            %    "profile.self_time_ns", "profile.total_time_ns", and
+            %    "profile.count".
+            %
+            %    CSP = OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANPROCESSOR(...,
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "ExportInterval"    - Time between exports of profile
+            %                             records. The sums are reset after
+            %                             each export. Default is Inf,
+            %                             which exports only when the
+            %                             tracer provider is flushed or
+            %                             shut down.
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.COLLAPSEDSTACKSPANEXPORTER,
+            %    OPENTELEMETRY.AUTOINSTRUMENT.AUTOTRACE,
+            %    OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER
+
+            if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = opentelemetry.sdk.trace.CollapsedStackSpanExporter;
+            else   % isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = varargin{1};
+                varargin(1) = [];
+            end
+            obj = obj@opentelemetry.sdk.trace.SpanProcessor(spanexporter, ...
+                "libmexclass.opentelemetry.sdk.CollapsedStackSpanProcessorProxy");
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function obj = set.ExportInterval(obj, interval)
+            if ~isduration(interval) || ~isscalar(interval) || interval <= 0
+                error("opentelemetry:sdk:trace:CollapsedStackSpanProcessor:InvalidExportInterval", ...
+                    "ExportInterval must be a positive duration scalar.");
+            end
+            obj.Proxy.setExportInterval(milliseconds(interval));
+            obj.ExportInterval = interval;
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = "ExportInterval";
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+    end
+end
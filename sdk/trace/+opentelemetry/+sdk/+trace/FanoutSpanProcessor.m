@@ -0,0 +1,139 @@
+classdef FanoutSpanProcessor < opentelemetry.sdk.trace.SpanProcessor
+% Fan-out span processor records each span once and exports it through
+% multiple exporters, each with its own queue.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        MaximumQueueSize (1,:) double = 2048       % Maximum queue size of each exporter. After queue size is reached, spans are dropped according to DropPolicy.
+        ScheduledDelay (1,:) duration = seconds(5) % Time interval between span exports
+        MaximumExportBatchSize (1,:) double = 512  % Maximum batch size to export.
+        DropPolicy (1,:) string = "dropnewest"     % Which spans to drop when a queue is full, "dropnewest" or "dropoldest"
+    end
+
+    methods
+        function obj = FanoutSpanProcessor(spanexporters, varargin)
+            % Fan-out span processor records each span once and exports it
+            % through multiple exporters, each with its own queue.
+            %    FSP = OPENTELEMETRY.SDK.TRACE.FANOUTSPANPROCESSOR(EXPS)
+            %    creates a fan-out span processor that exports spans
+            %    through the span exporters in cell array EXPS. Each
+            %    exporter has its own bounded queue and export thread, so
+            %    that a slow exporter does not delay the other exporters.
+            %
+            %    FSP = OPENTELEMETRY.SDK.TRACE.FANOUTSPANPROCESSOR(..., PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Each value can either be a scalar that
+            %    applies to all exporters, or a vector with one element
+            %    per exporter. Parameters are:
+            %       "MaximumQueueSize"  - Maximum queue size. After queue
+            %                             size is reached, spans are dropped.
+            %                             Default value is 2048.
+            %       "ScheduledDelay"    - Time interval between span
+            %                             exports. Default interval is 5 seconds.
+            %       "MaximumExportBatchSize"  - Maximum batch size to export.
+            %                                   Default size is 512.
+            %       "DropPolicy"        - Spans to drop when a queue is
+            %                             full, "dropnewest" (default) or
+            %                             "dropoldest".
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.BATCHSPANPROCESSOR,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPSPANEXPORTER,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPGRPCSPANEXPORTER,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPFILESPANEXPORTER,
+            %    OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER
+
+            if isa(spanexporters, "opentelemetry.sdk.trace.SpanExporter") && isscalar(spanexporters)
+                spanexporters = {spanexporters};
+            end
+            if ~iscell(spanexporters) || isempty(spanexporters) || ...
+                    ~all(cellfun(@(e)isa(e, "opentelemetry.sdk.trace.SpanExporter") && isscalar(e), spanexporters))
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidExporters", ...
+                    "Span exporters must be specified as a nonempty cell array of SpanExporter objects.");
+            end
+            obj = obj@opentelemetry.sdk.trace.SpanProcessor(reshape(spanexporters, 1, []), ...
+                "libmexclass.opentelemetry.sdk.FanoutSpanProcessorProxy");
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function obj = set.MaximumQueueSize(obj, maxqsz)
+            if ~isnumeric(maxqsz) || ~isreal(maxqsz) || isempty(maxqsz) || any(maxqsz <= 0) || ...
+                    any(~isfinite(maxqsz)) || any(round(maxqsz) ~= maxqsz) || ~obj.isValidLength(maxqsz)
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidMaxQueueSize", ...
+                    "MaximumQueueSize must be a positive integer scalar or a vector with one element per exporter.");
+            end
+            maxqsz = double(maxqsz);
+            obj.Proxy.setMaximumQueueSize(obj.expand(maxqsz));
+            obj.MaximumQueueSize = maxqsz;
+        end
+
+        function obj = set.ScheduledDelay(obj, delay)
+            if ~isduration(delay) || isempty(delay) || any(delay <= 0) || ...
+                    any(~isfinite(delay)) || ~obj.isValidLength(delay)
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidScheduledDelay", ...
+                    "ScheduledDelay must be a positive duration scalar or a vector with one element per exporter.");
+            end
+            obj.Proxy.setScheduledDelay(milliseconds(obj.expand(delay)));
+            obj.ScheduledDelay = delay;
+        end
+
+        function obj = set.MaximumExportBatchSize(obj, maxbatch)
+            if ~isnumeric(maxbatch) || ~isreal(maxbatch) || isempty(maxbatch) || any(maxbatch <= 0) || ...
+                    any(~isfinite(maxbatch)) || any(round(maxbatch) ~= maxbatch) || ~obj.isValidLength(maxbatch)
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidMaxExportBatchSize", ...
+                    "MaximumExportBatchSize must be a positive integer scalar or a vector with one element per exporter.");
+            end
+            maxbatch = double(maxbatch);
+            obj.Proxy.setMaximumExportBatchSize(obj.expand(maxbatch));
+            obj.MaximumExportBatchSize = maxbatch;
+        end
+
+        function obj = set.DropPolicy(obj, policy)
+            if ~(isstring(policy) || ischar(policy) || iscellstr(policy))
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidDropPolicy", ...
+                    "DropPolicy must be ""dropnewest"" or ""dropoldest"", either as a scalar or with one element per exporter.");
+            end
+            policy = string(policy);
+            if isempty(policy) || ~all(ismember(lower(policy), ["dropnewest" "dropoldest"])) || ...
+                    ~obj.isValidLength(policy)
+                error("opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidDropPolicy", ...
+                    "DropPolicy must be ""dropnewest"" or ""dropoldest"", either as a scalar or with one element per exporter.");
+            end
+            policy = lower(policy);
+            obj.Proxy.setDropPolicy(obj.expand(policy));
+            obj.DropPolicy = policy;
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = ["MaximumQueueSize", "ScheduledDelay", ...
+                "MaximumExportBatchSize", "DropPolicy"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function tf = isValidLength(obj, value)
+            tf = isscalar(value) || numel(value) == numel(obj.SpanExporter);
+        end
+
+        function value = expand(obj, value)
+            % expand scalar values to one element per exporter
+            if isscalar(value)
+                value = repmat(value, 1, numel(obj.SpanExporter));
+            end
+            value = reshape(value, 1, []);
+        end
+    end
+end
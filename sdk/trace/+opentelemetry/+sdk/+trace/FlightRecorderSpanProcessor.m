@@ -0,0 +1,133 @@
+classdef FlightRecorderSpanProcessor < opentelemetry.sdk.trace.SpanProcessor
+% Flight recorder span processor keeps recently ended spans in a fixed-size
+% buffer and only passes them to an exporter when dumped, either by calling
+% dump or when a span ends with an error status.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        BufferSize (1,1) double = 4194304        % Size of the span buffer in bytes
+        FileName (1,1) string = ""               % Memory-mapped file holding the buffer, "" to keep it in memory only
+        MaximumAge (1,1) duration = seconds(Inf) % Maximum age of spans included in a dump
+        TriggerOnError (1,1) logical = true      % Whether a span with an error status causes a dump
+    end
+
+    methods
+        function obj = FlightRecorderSpanProcessor(varargin)
+            % Flight recorder span processor keeps recently ended spans in
+            % a fixed-size buffer and only passes them to an exporter when
+            % dumped.
+            %    FSP = OPENTELEMETRY.SDK.TRACE.FLIGHTRECORDERSPANPROCESSOR creates a
+            %    flight recorder span processor that uses an OTLP HTTP exporter, which
+            %    exports spans in OpenTelemetry Protocol (OTLP) format through HTTP.
+            %
+            %    FSP = OPENTELEMETRY.SDK.TRACE.FLIGHTRECORDERSPANPROCESSOR(EXP) specifies
+            %    the span exporter.
+            %
+            %    FSP = OPENTELEMETRY.SDK.TRACE.FLIGHTRECORDERSPANPROCESSOR(..., PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Parameters are:
+            %       "BufferSize"        - Size of the span buffer in bytes,
+            %                             measured in OTLP encoded size.
+            %                             When the buffer is full, the
+            %                             oldest spans are overwritten.
+            %                             Default is 4 MB.
+            %       "FileName"          - File that holds the buffer as a
+            %                             memory-mapped file. Spans in the
+            %                             file survive a crash and are
+            %                             included in the next dump of a
+            %                             processor that uses the same
+            %                             file. Default is "", which keeps
+            %                             the buffer in memory only.
+            %       "MaximumAge"        - Only spans that ended within this
+            %                             time before a dump are exported.
+            %                             Default is Inf.
+            %       "TriggerOnError"    - Whether a span that ends with an
+            %                             error status causes a dump.
+            %                             Default is true.
+            %
+            %    See also DUMP, OPENTELEMETRY.SDK.TRACE.SIMPLESPANPROCESSOR,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPSPANEXPORTER,
+            %    OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER
+
+            if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = opentelemetry.exporters.otlp.defaultSpanExporter;
+            else   % isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = varargin{1};
+                varargin(1) = [];
+            end
+            obj = obj@opentelemetry.sdk.trace.SpanProcessor(spanexporter, ...
+                "libmexclass.opentelemetry.sdk.FlightRecorderSpanProcessorProxy");
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function success = dump(obj)
+            % DUMP Export the spans in the buffer.
+            %    SUCCESS = DUMP(FSP) passes the spans in the buffer to the
+            %    exporter and clears the buffer. SUCCESS is true if the
+            %    export succeeded.
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER/FORCEFLUSH
+            success = obj.Proxy.dump();
+        end
+
+        function obj = set.BufferSize(obj, bufsize)
+            if ~isnumeric(bufsize) || ~isscalar(bufsize) || bufsize <= 0 || ...
+                    round(bufsize) ~= bufsize
+                error("opentelemetry:sdk:trace:FlightRecorderSpanProcessor:InvalidBufferSize", ...
+                    "BufferSize must be a scalar positive integer.");
+            end
+            bufsize = double(bufsize);
+            obj.Proxy.setBufferSize(bufsize);
+            obj.BufferSize = bufsize;
+        end
+
+        function obj = set.FileName(obj, filename)
+            if ~(isStringScalar(filename) || (ischar(filename) && (isrow(filename) || isempty(filename))))
+                error("opentelemetry:sdk:trace:FlightRecorderSpanProcessor:InvalidFileName", ...
+                    "FileName must be a string scalar.");
+            end
+            filename = string(filename);
+            obj.Proxy.setFileName(filename);
+            obj.FileName = filename;
+        end
+
+        function obj = set.MaximumAge(obj, maxage)
+            if ~isduration(maxage) || ~isscalar(maxage) || maxage <= 0
+                error("opentelemetry:sdk:trace:FlightRecorderSpanProcessor:InvalidMaximumAge", ...
+                    "MaximumAge must be a positive duration scalar.");
+            end
+            obj.Proxy.setMaximumAge(milliseconds(maxage));
+            obj.MaximumAge = maxage;
+        end
+
+        function obj = set.TriggerOnError(obj, trigger)
+            if ~((islogical(trigger) || isnumeric(trigger)) && isscalar(trigger))
+                error("opentelemetry:sdk:trace:FlightRecorderSpanProcessor:InvalidTriggerOnError", ...
+                    "TriggerOnError must be a scalar logical.");
+            end
+            trigger = logical(trigger);
+            obj.Proxy.setTriggerOnError(trigger);
+            obj.TriggerOnError = trigger;
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = ["BufferSize", "FileName", "MaximumAge", "TriggerOnError"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+    end
+end
@@ -0,0 +1,145 @@
+classdef RingBufferSpanProcessor < opentelemetry.sdk.trace.SpanProcessor
+% Ring buffer span processor creates batches of spans and passes them to
+% an exporter, using a lock-free queue with a configurable full-queue policy.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        MaximumQueueSize (1,1) double = 2048       % Maximum number of queued spans
+        MaximumQueueBytes (1,1) double = Inf       % Maximum total size of queued spans in bytes
+        ScheduledDelay (1,1) duration = seconds(5) % Time interval between span exports
+        MaximumExportBatchSize (1,1) double = 512  % Maximum batch size to export.
+        FullQueuePolicy (1,1) string = "dropnewest"  % Action when queue is full, "dropnewest", "dropoldest", or "block"
+        BlockTimeout (1,1) duration = seconds(1)   % Maximum time to wait for space in the queue when FullQueuePolicy is "block"
+    end
+
+    methods
+        function obj = RingBufferSpanProcessor(varargin)
+            % Ring buffer span processor creates batches of spans and
+            % passes them to an exporter, using a lock-free queue with a
+            % configurable full-queue policy.
+            %    RSP = OPENTELEMETRY.SDK.TRACE.RINGBUFFERSPANPROCESSOR creates a
+            %    ring buffer span processor that uses an OTLP HTTP exporter, which
+            %    exports spans in OpenTelemetry Protocol (OTLP) format through HTTP.
+            %
+            %    RSP = OPENTELEMETRY.SDK.TRACE.RINGBUFFERSPANPROCESSOR(EXP) specifies
+            %    the span exporter.
+            %
+            %    RSP = OPENTELEMETRY.SDK.TRACE.RINGBUFFERSPANPROCESSOR(..., PARAM1,
+            %    VALUE1, PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Parameters are:
+            %       "MaximumQueueSize"  - Maximum number of queued spans.
+            %                             Default value is 2048.
+            %       "MaximumQueueBytes" - Maximum total size of queued
+            %                             spans in bytes, measured in OTLP
+            %                             encoded size, or estimated from
+            %                             the name, attributes, events, and
+            %                             links for exporters that do not
+            %                             use OTLP. Default is Inf, which
+            %                             means no byte limit.
+            %       "ScheduledDelay"    - Time interval between span
+            %                             exports. Default interval is 5 seconds.
+            %       "MaximumExportBatchSize"  - Maximum batch size to export.
+            %                                   Default size is 512.
+            %       "FullQueuePolicy"   - Action when the queue is full.
+            %                             "dropnewest" (default) drops the
+            %                             new span, "dropoldest" drops the
+            %                             oldest queued spans, and "block"
+            %                             waits for space up to BlockTimeout.
+            %       "BlockTimeout"      - Maximum wait time for the "block"
+            %                             policy. Default is 1 second.
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.BATCHSPANPROCESSOR,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPSPANEXPORTER,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPGRPCSPANEXPORTER,
+            %    OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER
+
+            if nargin == 0 || ~isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = opentelemetry.exporters.otlp.defaultSpanExporter;
+            else   % isa(varargin{1}, "opentelemetry.sdk.trace.SpanExporter")
+                spanexporter = varargin{1};
+                varargin(1) = [];
+            end
+            obj = obj@opentelemetry.sdk.trace.SpanProcessor(spanexporter, ...
+                "libmexclass.opentelemetry.sdk.RingBufferSpanProcessorProxy");
+
+            obj = obj.processOptions(varargin{:});
+        end
+
+        function obj = set.MaximumQueueSize(obj, maxqsz)
+            if ~isnumeric(maxqsz) || ~isscalar(maxqsz) || maxqsz <= 0 || ...
+                    round(maxqsz) ~= maxqsz
+                error("opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidMaxQueueSize", ...
+                    "MaximumQueueSize must be a scalar positive integer.");
+            end
+            maxqsz = double(maxqsz);
+            obj.Proxy.setMaximumQueueSize(maxqsz);
+            obj.MaximumQueueSize = maxqsz;
+        end
+
+        function obj = set.MaximumQueueBytes(obj, maxqbytes)
+            if ~isnumeric(maxqbytes) || ~isscalar(maxqbytes) || maxqbytes <= 0 || ...
+                    (isfinite(maxqbytes) && round(maxqbytes) ~= maxqbytes)
+                error("opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidMaxQueueBytes", ...
+                    "MaximumQueueBytes must be a scalar positive integer or Inf.");
+            end
+            maxqbytes = double(maxqbytes);
+            obj.Proxy.setMaximumQueueBytes(maxqbytes);
+            obj.MaximumQueueBytes = maxqbytes;
+        end
+
+        function obj = set.ScheduledDelay(obj, delay)
+            if ~isduration(delay) || ~isscalar(delay) || delay <= 0
+                error("opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidScheduledDelay", ...
+                    "ScheduledDelay must be a positive duration scalar.");
+            end
+            obj.Proxy.setScheduledDelay(milliseconds(delay));
+            obj.ScheduledDelay = delay;
+        end
+
+        function obj = set.MaximumExportBatchSize(obj, maxbatch)
+            if ~isnumeric(maxbatch) || ~isscalar(maxbatch) || maxbatch <= 0 || ...
+                    round(maxbatch) ~= maxbatch
+                error("opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidMaxExportBatchSize", ...
+                    "MaximumExportBatchSize must be a scalar positive integer.");
+            end
+            maxbatch = double(maxbatch);
+            obj.Proxy.setMaximumExportBatchSize(maxbatch);
+            obj.MaximumExportBatchSize = maxbatch;
+        end
+
+        function obj = set.FullQueuePolicy(obj, policy)
+            policy = validatestring(policy, ["dropnewest" "dropoldest" "block"]);
+            obj.Proxy.setFullQueuePolicy(policy);
+            obj.FullQueuePolicy = policy;
+        end
+
+        function obj = set.BlockTimeout(obj, timeout)
+            if ~isduration(timeout) || ~isscalar(timeout) || timeout < 0
+                error("opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidBlockTimeout", ...
+                    "BlockTimeout must be a nonnegative duration scalar.");
+            end
+            obj.Proxy.setBlockTimeout(milliseconds(timeout));
+            obj.BlockTimeout = timeout;
+        end
+    end
+
+    methods(Access=private)
+        function obj = processOptions(obj, optionnames, optionvalues)
+            arguments
+      	       obj
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+            validnames = ["MaximumQueueSize", "MaximumQueueBytes", "ScheduledDelay", ...
+                "MaximumExportBatchSize", "FullQueuePolicy", "BlockTimeout"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+    end
+end
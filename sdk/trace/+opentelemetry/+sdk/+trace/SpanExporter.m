@@ -6,7 +6,12 @@ classdef SpanExporter < handle
     properties (Hidden, GetAccess={?opentelemetry.sdk.trace.SpanProcessor, ...
             ?opentelemetry.exporters.otlp.OtlpHttpSpanExporter, ...
             ?opentelemetry.exporters.otlp.OtlpGrpcSpanExporter, ...
-            ?opentelemetry.exporters.otlp.OtlpFileSpanExporter})
+            ?opentelemetry.exporters.otlp.OtlpFileSpanExporter, ...
+            ?opentelemetry.exporters.otlp.OtlpFileReplayer, ...
+            ?opentelemetry.exporters.parquet.ParquetSpanExporter, ...
+            ?opentelemetry.sdk.trace.SpoolSpanExporter, ...
+            ?opentelemetry.sdk.trace.ChromeTraceSpanExporter, ...
+            ?opentelemetry.sdk.trace.CollapsedStackSpanExporter})
         Proxy   % Proxy object to interface C++ code
     end
 
@@ -0,0 +1,94 @@
+classdef SpanLimits
+% SpanLimits bounds the number and size of attributes, events, and links recorded on a span.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties
+        MaximumAttributes (1,1) double = Inf            % Maximum attributes per span, and per event or link
+        MaximumEvents (1,1) double = Inf                % Maximum events per span
+        MaximumLinks (1,1) double = Inf                 % Maximum links per span
+        MaximumAttributeValueLength (1,1) double = Inf  % Maximum characters in each string attribute value
+        MaximumSpanBytes (1,1) double = Inf             % Maximum estimated size of span name, attributes, events, and links
+        ArraySummaryThreshold (1,1) double = Inf        % Numeric array attributes with more elements are summarized
+    end
+
+    methods
+        function obj = SpanLimits(optionnames, optionvalues)
+            % Limits on span contents
+            %    L = OPENTELEMETRY.SDK.TRACE.SPANLIMITS creates span limits
+            %    that do not restrict spans.
+            %
+            %    L = OPENTELEMETRY.SDK.TRACE.SPANLIMITS(PARAM1, VALUE1,
+            %    PARAM2, VALUE2, ...) specifies optional parameter
+            %    name/value pairs. Parameters are:
+            %       "MaximumAttributes"           - Maximum number of attributes
+            %                                       per span, and per event or link.
+            %                                       Additional attributes are dropped.
+            %       "MaximumEvents"               - Maximum number of events per span.
+            %       "MaximumLinks"                - Maximum number of links per span.
+            %       "MaximumAttributeValueLength" - Maximum number of characters in
+            %                                       string attribute values. Longer
+            %                                       strings are truncated.
+            %       "MaximumSpanBytes"            - Maximum estimated size in bytes of
+            %                                       the span name, attributes, events,
+            %                                       and links. Attributes, events, and
+            %                                       links that do not fit are dropped.
+            %       "ArraySummaryThreshold"       - Numeric array attributes with more
+            %                                       elements are replaced by summary
+            %                                       statistics. See below.
+            %    All limits default to Inf, which means unlimited.
+            %
+            %    A summarized array attribute NAME is replaced by attributes
+            %    NAME.min, NAME.max, NAME.mean, NAME.std, NAME.nan_count,
+            %    NAME.l2norm, and NAME.hash, along with NAME.size. NaN
+            %    values are excluded from the statistics. NAME.hash is a
+            %    hexadecimal hash of the array data.
+            %
+            %    See also OPENTELEMETRY.SDK.TRACE.TRACERPROVIDER
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            validnames = ["MaximumAttributes", "MaximumEvents", "MaximumLinks", ...
+                "MaximumAttributeValueLength", "MaximumSpanBytes", "ArraySummaryThreshold"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                obj.(namei) = optionvalues{i};
+            end
+        end
+
+        function obj = set.MaximumAttributes(obj, value)
+            obj.MaximumAttributes = validateLimit(value, "MaximumAttributes");
+        end
+
+        function obj = set.MaximumEvents(obj, value)
+            obj.MaximumEvents = validateLimit(value, "MaximumEvents");
+        end
+
+        function obj = set.MaximumLinks(obj, value)
+            obj.MaximumLinks = validateLimit(value, "MaximumLinks");
+        end
+
+        function obj = set.MaximumAttributeValueLength(obj, value)
+            obj.MaximumAttributeValueLength = validateLimit(value, "MaximumAttributeValueLength");
+        end
+
+        function obj = set.MaximumSpanBytes(obj, value)
+            obj.MaximumSpanBytes = validateLimit(value, "MaximumSpanBytes");
+        end
+
+        function obj = set.ArraySummaryThreshold(obj, value)
+            obj.ArraySummaryThreshold = validateLimit(value, "ArraySummaryThreshold");
+        end
+    end
+end
+
+function value = validateLimit(value, name)
+if ~(isnumeric(value) && isscalar(value) && isreal(value) && value >= 0 && ...
+        (value == round(value) || isinf(value)))
+    error("opentelemetry:sdk:trace:SpanLimits:Invalid" + name, ...
+        name + " must be a nonnegative integer or Inf.");
+end
+value = double(value);
+end
@@ -1,15 +1,19 @@
 classdef SpanProcessor < matlab.mixin.Heterogeneous
 % Base class of span processors
 
-% Copyright 2023 The MathWorks, Inc.
+% Copyright 2023-2026 The MathWorks, Inc.
 
     properties (GetAccess={?opentelemetry.sdk.trace.TracerProvider,...
-		    ?opentelemetry.sdk.trace.BatchSpanProcessor})
+		    ?opentelemetry.sdk.trace.BatchSpanProcessor,...
+		    ?opentelemetry.sdk.trace.FanoutSpanProcessor,...
+		    ?opentelemetry.sdk.trace.RingBufferSpanProcessor,...
+		    ?opentelemetry.sdk.trace.FlightRecorderSpanProcessor,...
+		    ?opentelemetry.sdk.trace.CollapsedStackSpanProcessor})
         Proxy  % Proxy object to interface C++ code
     end
 
     properties (SetAccess=immutable)
-        SpanExporter  % Span exporter object responsible for exporting telemetry data to an OpenTelemetry Collector or a compatible backend.
+        SpanExporter  % Span exporter object responsible for exporting telemetry data to an OpenTelemetry Collector or a compatible backend. FanoutSpanProcessor holds a cell array of span exporters.
     end
 
     methods (Access=protected)
@@ -17,10 +21,46 @@ classdef SpanProcessor < matlab.mixin.Heterogeneous
             % Base class constructor
 
             % Append SpanExporter proxy ID as the first input argument of 
-            % proxy class constructor
+            % proxy class constructor. Multiple span exporters can be 
+            % specified as a cell array.
+            if iscell(spanexporter)
+                exporterid = cellfun(@(e)e.Proxy.ID, spanexporter);
+            else
+                exporterid = spanexporter.Proxy.ID;
+            end
             obj.Proxy = libmexclass.proxy.Proxy("Name", proxyname, ...
-                "ConstructorArguments", [spanexporter.Proxy.ID varargin]);
+                "ConstructorArguments", [{exporterid} varargin]);
             obj.SpanExporter = spanexporter;
         end
     end
+
+    methods
+        function stats = getStats(obj)
+            % GETSTATS Statistics of the span export pipeline.
+            %    STATS = GETSTATS(SP) returns a struct with the number of
+            %    spans enqueued, dropped before export, exported, and
+            %    failed to export, the number of spans waiting to be
+            %    exported, and histograms of export durations in
+            %    milliseconds and export batch sizes. Statistics are
+            %    collected after the span processor is added to a tracer
+            %    provider. For FanoutSpanProcessor, each span is counted
+            %    once per exporter.
+            %
+            %    See also PUBLISHSTATS
+            stats = obj.Proxy.getStats();
+        end
+
+        function publishStats(obj, mp)
+            % PUBLISHSTATS Publish statistics of the span export pipeline as metrics.
+            %    PUBLISHSTATS(SP, MP) publishes the statistics returned by
+            %    GETSTATS as metrics through SDK meter provider MP.
+            %
+            %    See also GETSTATS, OPENTELEMETRY.SDK.METRICS.METERPROVIDER
+            arguments
+                obj
+                mp (1,1) opentelemetry.sdk.metrics.MeterProvider
+            end
+            obj.Proxy.publishStats(getProxyID(mp));
+        end
+    end
 end
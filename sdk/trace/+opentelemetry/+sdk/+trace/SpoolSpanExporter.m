@@ -0,0 +1,125 @@
+classdef SpoolSpanExporter < opentelemetry.sdk.trace.SpanExporter
+% Spool span exporter stores spans on disk while another exporter is
+% failing, and sends them once it recovers.
+
+% Copyright 2026 The MathWorks, Inc.
+
+    properties (SetAccess=immutable)
+        Exporter      % Wrapped span exporter
+    end
+
+    properties
+        Directory (1,1) string                         % Folder for spool files
+        SegmentSize (1,1) double = 4194304             % Size of each spool file in bytes
+        MaxDiskUsage (1,1) double = 268435456          % Maximum total size of spool files in bytes. When exceeded, the oldest spans are dropped.
+        InitialBackoff (1,1) duration = seconds(1)     % Delay before the first retry
+        MaxBackoff (1,1) duration = minutes(5)         % Maximum delay between retries
+    end
+
+    methods
+        function obj = SpoolSpanExporter(exporter, optionnames, optionvalues)
+            % Spool span exporter stores spans on disk while another
+            % exporter is failing, and sends them once it recovers.
+            %    EXP = OPENTELEMETRY.SDK.TRACE.SPOOLSPANEXPORTER(WEXP)
+            %    wraps span exporter WEXP. Spans that WEXP fails to send,
+            %    for example because the collector is unavailable, are
+            %    written to memory-mapped spool files and retried with
+            %    exponential backoff. Spans still spooled when MATLAB exits
+            %    are sent by the next exporter that uses the same folder.
+            %    Only one exporter at a time can spool to a folder, another
+            %    exporter that uses it sends spans without spooling them.
+            %    WEXP must report export failures, so OTLP exporters built
+            %    with asynchronous export cannot be wrapped.
+            %
+            %    EXP = OPENTELEMETRY.SDK.TRACE.SPOOLSPANEXPORTER(WEXP,
+            %    PARAM1, VALUE1, PARAM2, VALUE2, ...) specifies optional
+            %    parameter name/value pairs. Parameters are:
+            %       "Directory"         - Folder for spool files. Default
+            %                             is a folder in tempdir.
+            %       "SegmentSize"       - Size of each spool file in
+            %                             bytes. Default is 4 MB.
+            %       "MaxDiskUsage"      - Maximum total size of spool
+            %                             files in bytes. When exceeded,
+            %                             the oldest spans are dropped.
+            %                             Default is 256 MB.
+            %       "InitialBackoff"    - Delay before the first retry,
+            %                             doubled after each failure.
+            %                             Default is 1 second.
+            %       "MaxBackoff"        - Maximum delay between retries.
+            %                             Default is 5 minutes.
+            %
+            %    See also OPENTELEMETRY.EXPORTERS.OTLP.OTLPHTTPSPANEXPORTER,
+            %    OPENTELEMETRY.EXPORTERS.OTLP.OTLPGRPCSPANEXPORTER,
+            %    OPENTELEMETRY.SDK.TRACE.BATCHSPANPROCESSOR
+            arguments
+                exporter (1,1) {mustBeA(exporter, "opentelemetry.sdk.trace.SpanExporter")}
+            end
+            arguments (Repeating)
+                optionnames (1,:) {mustBeTextScalar}
+                optionvalues
+            end
+
+            obj = obj@opentelemetry.sdk.trace.SpanExporter(...
+                "libmexclass.opentelemetry.sdk.SpoolSpanExporterProxy", ...
+                exporter.Proxy.ID);
+            obj.Exporter = exporter;
+            obj.Directory = fullfile(tempdir, "opentelemetry-spool", "traces");
+
+            validnames = ["Directory", "SegmentSize", "MaxDiskUsage", ...
+                "InitialBackoff", "MaxBackoff"];
+            for i = 1:length(optionnames)
+                namei = validatestring(optionnames{i}, validnames);
+                valuei = optionvalues{i};
+                obj.(namei) = valuei;
+            end
+        end
+
+        function obj = set.Directory(obj, folder)
+            if ~(isStringScalar(folder) || (ischar(folder) && isrow(folder))) || strlength(folder) == 0
+                error("opentelemetry:sdk:trace:SpoolSpanExporter:InvalidDirectory", ...
+                    "Directory must be a nonempty string scalar.");
+            end
+            folder = string(folder);
+            obj.Proxy.setDirectory(folder);
+            obj.Directory = folder;
+        end
+
+        function obj = set.SegmentSize(obj, sz)
+            if ~(isnumeric(sz) && isscalar(sz) && sz > 0 && round(sz) == sz)
+                error("opentelemetry:sdk:trace:SpoolSpanExporter:InvalidSegmentSize", ...
+                    "SegmentSize must be a scalar positive integer.");
+            end
+            sz = double(sz);
+            obj.Proxy.setSegmentSize(sz);
+            obj.SegmentSize = sz;
+        end
+
+        function obj = set.MaxDiskUsage(obj, sz)
+            if ~(isnumeric(sz) && isscalar(sz) && sz > 0 && round(sz) == sz)
+                error("opentelemetry:sdk:trace:SpoolSpanExporter:InvalidMaxDiskUsage", ...
+                    "MaxDiskUsage must be a scalar positive integer.");
+            end
+            sz = double(sz);
+            obj.Proxy.setMaxDiskUsage(sz);
+            obj.MaxDiskUsage = sz;
+        end
+
+        function obj = set.InitialBackoff(obj, backoff)
+            if ~(isduration(backoff) && isscalar(backoff) && backoff > 0)
+                error("opentelemetry:sdk:trace:SpoolSpanExporter:InvalidInitialBackoff", ...
+                    "InitialBackoff must be a positive duration scalar.");
+            end
+            obj.Proxy.setInitialBackoff(milliseconds(backoff));
+            obj.InitialBackoff = backoff;
+        end
+
+        function obj = set.MaxBackoff(obj, backoff)
+            if ~(isduration(backoff) && isscalar(backoff) && backoff > 0)
+                error("opentelemetry:sdk:trace:SpoolSpanExporter:InvalidMaxBackoff", ...
+                    "MaxBackoff must be a positive duration scalar.");
+            end
+            obj.Proxy.setMaxBackoff(milliseconds(backoff));
+            obj.MaxBackoff = backoff;
+        end
+    end
+end
@@ -2,7 +2,7 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
     % An SDK implementation of tracer provider, which stores a set of configurations used
     % in a distributed tracing system.
 
-    % Copyright 2023-2025 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     properties(Access=private)
         isShutdown (1,1) logical = false
@@ -12,6 +12,7 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
         SpanProcessor   % Whether spans should be sent immediately or batched
         Sampler         % Sampling policy on generated spans
         Resource        % Attributes attached to all spans
+        SpanLimits      % Limits on attributes, events, and links of each span
     end
 
     methods
@@ -29,13 +30,17 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
             %       "Sampler"     - Sampling policy. Default is always on.
             %       "Resource"    - Additional resource attributes.
             %                       Specified as a dictionary.
+            %       "SpanLimits"  - Limits on the attributes, events, 
+            %                       and links of each span. Default
+            %                       is no limits.
             %
             %    See also OPENTELEMETRY.SDK.TRACE.SIMPLESPANPROCESSOR,
             %    OPENTELEMETRY.SDK.TRACE.BATCHSPANPROCESSOR,
             %    OPENTELEMETRY.SDK.TRACE.ALWAYSONSAMPLER,
             %    OPENTELEMETRY.SDK.TRACE.ALWAYSOFFSAMPLER,
             %    OPENTELEMETRY.SDK.TRACE.TRACEIDRATIOBASEDSAMPLER,
-            %    OPENTELEMETRY.SDK.TRACE.PARENTBASEDSAMPLER
+            %    OPENTELEMETRY.SDK.TRACE.PARENTBASEDSAMPLER,
+            %    OPENTELEMETRY.SDK.TRACE.SPANLIMITS
 
             % explicit call to superclass constructor to make it a no-op
             obj@opentelemetry.trace.TracerProvider("skip");
@@ -125,8 +130,9 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
                 optionnames (1,:) {mustBeTextScalar}
                 optionvalues
             end
-            validnames = ["Sampler", "Resource"];
+            validnames = ["Sampler", "Resource", "SpanLimits"];
             foundsampler = false;
+            limits = opentelemetry.sdk.trace.SpanLimits;
             resourcekeys = string.empty();
             resourcevalues = {};
             resource = dictionary(resourcekeys, resourcevalues);
@@ -140,6 +146,12 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
                     end
                     sampler = valuei;
                     foundsampler = true;
+                elseif strcmp(namei, "SpanLimits")
+                    if ~isa(valuei, "opentelemetry.sdk.trace.SpanLimits")
+                        error("opentelemetry:sdk:trace:TracerProvider:InvalidSpanLimitsType", ...
+                            "SpanLimits must be an opentelemetry.sdk.trace.SpanLimits object.");
+                    end
+                    limits = valuei;
                 else  % "Resource"
                     if ~isa(valuei, "dictionary")
                         error("opentelemetry:sdk:trace:TracerProvider:InvalidResourceType", ...
@@ -164,9 +176,13 @@ classdef TracerProvider < opentelemetry.trace.TracerProvider & handle
                 "libmexclass.opentelemetry.sdk.TracerProviderProxy", ...
                 "ConstructorArguments", {processor.Proxy.ID, sampler.Proxy.ID, ...
                 resourcekeys, resourcevalues});
+            obj.Proxy.setSpanLimits(limits.MaximumAttributes, limits.MaximumEvents, ...
+                limits.MaximumLinks, limits.MaximumAttributeValueLength, limits.MaximumSpanBytes, ...
+                limits.ArraySummaryThreshold);
             obj.SpanProcessor = processor;
             obj.Sampler = sampler;
             obj.Resource = resource;
+            obj.SpanLimits = limits;
         end
     end
 end
@@ -0,0 +1,62 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Span exporter that writes the Chrome trace event format, which can be opened in Perfetto or
+// chrome://tracing. Each span becomes a complete event with its attributes as args, and each
+// span event an instant event. The file is a JSON array that is appended to as spans are
+// exported, so memory use does not grow with the number of spans. The array is closed on
+// shutdown, but viewers also load a file that was cut short.
+//
+// Spans go on the track given by their thread.id attribute. Without one, each trace in progress
+// gets its own track, which is reused once the root span of the trace has ended, so that
+// nested spans are drawn as a call stack.
+class ChromeTraceSpanExporter : public trace_sdk::SpanExporter {
+  public:
+    explicit ChromeTraceSpanExporter(const std::string& filename);
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    int64_t processId(const trace_sdk::SpanData& span);
+
+    int64_t threadId(const trace_sdk::SpanData& span);
+
+    void appendEvent(const std::string& event);
+
+    std::mutex Mutex;
+    std::ofstream File;
+    std::string Pending;          // events of the batch being written
+    bool FirstEvent = true;
+    std::set<int64_t> NamedProcesses;
+    std::unordered_map<std::string, int64_t> TraceTracks;   // track of each trace in progress
+    std::set<int64_t> FreeTracks;
+    int64_t NextTrack = 1;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,34 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <string>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class ChromeTraceSpanExporterProxy : public SpanExporterProxy {
+  public:
+    ChromeTraceSpanExporterProxy() {
+        REGISTER_METHOD(ChromeTraceSpanExporterProxy, setFileName);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+        return std::make_shared<ChromeTraceSpanExporterProxy>();
+    }
+
+    std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::string FileName = "trace.json";
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,56 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Value written after each stack in a collapsed stack file
+enum class CollapsedStackMetric {SelfTime, TotalTime, Count};
+
+// Span exporter that writes the profile records of CollapsedStackSpanProcessor as a collapsed
+// stack file, with one "stack value" line per stack, which flame graph tools take as input.
+// Records of the same stack are summed over the life of the exporter, and the file is replaced
+// after each export. Times are written in microseconds. Spans that are not profile records are
+// counted as a stack of their own name.
+class CollapsedStackSpanExporter : public trace_sdk::SpanExporter {
+  public:
+    CollapsedStackSpanExporter(const std::string& filename, CollapsedStackMetric metric)
+	    : FileName(filename), Metric(metric) {}
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return true;
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        IsShutdown.store(true);
+        return true;
+    }
+
+  private:
+    bool writeFile();
+
+    const std::string FileName;
+    const CollapsedStackMetric Metric;
+    std::mutex Mutex;
+    std::map<std::string, int64_t> Stacks;    // sorted, so that the file is stable
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,39 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanExporter.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <string>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class CollapsedStackSpanExporterProxy : public SpanExporterProxy {
+  public:
+    CollapsedStackSpanExporterProxy() {
+        REGISTER_METHOD(CollapsedStackSpanExporterProxy, setFileName);
+        REGISTER_METHOD(CollapsedStackSpanExporterProxy, setMetric);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+        return std::make_shared<CollapsedStackSpanExporterProxy>();
+    }
+
+    std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+    void setMetric(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::string FileName = "stacks.folded";
+    CollapsedStackMetric Metric = CollapsedStackMetric::SelfTime;
+};
+} // namespace libmexclass::opentelemetry
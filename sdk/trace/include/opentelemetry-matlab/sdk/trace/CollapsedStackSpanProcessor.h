@@ -0,0 +1,78 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/sdk/instrumentationscope/instrumentation_scope.h"
+#include "opentelemetry/sdk/resource/resource.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Attributes of the profile records exported by CollapsedStackSpanProcessor
+extern const char* const ProfileSelfTimeKey;     // time in the stack minus time in child spans, in ns
+extern const char* const ProfileTotalTimeKey;    // time in the stack, in ns
+extern const char* const ProfileCountKey;        // number of spans folded into the record
+
+// Span processor that folds spans into collapsed stacks instead of exporting them one by one. The
+// stack of a span is the chain of span names from its root, joined by semicolons. Self time and
+// total time are summed per stack in a hash map, and at each export interval and on flush, one
+// profile record per stack is passed to the exporter. A profile record is a span named after the
+// stack, with its times and span count as attributes. The totals are reset after each export.
+class CollapsedStackSpanProcessor : public trace_sdk::SpanProcessor {
+  public:
+    // export_interval of zero exports only on flush and shutdown
+    CollapsedStackSpanProcessor(std::unique_ptr<trace_sdk::SpanExporter>&& exporter,
+		    std::chrono::milliseconds export_interval);
+
+    ~CollapsedStackSpanProcessor() override;
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnStart(trace_sdk::Recordable& span, const trace_api::SpanContext& parent_context) noexcept override;
+
+    void OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    struct ActiveSpan {
+        std::string Stack;
+        std::chrono::nanoseconds ChildTime{0};
+    };
+
+    struct StackTotals {
+        uint64_t Count = 0;
+        std::chrono::nanoseconds SelfTime{0};
+        std::chrono::nanoseconds TotalTime{0};
+    };
+
+    // pass the totals to the exporter and reset them
+    bool exportStacks();
+
+    std::unique_ptr<trace_sdk::SpanExporter> Exporter;
+    const std::chrono::milliseconds ExportInterval;
+    std::mutex Mutex;
+    std::unordered_map<uint64_t, ActiveSpan> Active;     // started spans, by span ID
+    std::unordered_map<std::string, StackTotals> Totals;
+    std::chrono::system_clock::time_point IntervalStart;
+    std::chrono::steady_clock::time_point LastExport;
+    const ::opentelemetry::sdk::resource::Resource* Resource = nullptr;
+    const ::opentelemetry::sdk::instrumentationscope::InstrumentationScope* Scope = nullptr;
+    std::mutex ExportMutex;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,33 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanProcessorProxy.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+
+#include <chrono>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class CollapsedStackSpanProcessorProxy : public SpanProcessorProxy {
+  public:
+    CollapsedStackSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter)
+	    : SpanProcessorProxy(exporter, "CollapsedStackSpanProcessor") {
+        REGISTER_METHOD(CollapsedStackSpanProcessorProxy, setExportInterval);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<trace_sdk::SpanProcessor> getInstance() override;
+
+    void setExportInterval(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::chrono::milliseconds ExportInterval{0};
+};
+} // namespace libmexclass::opentelemetry
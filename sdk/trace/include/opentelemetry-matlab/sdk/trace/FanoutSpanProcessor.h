@@ -0,0 +1,59 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+enum class FanoutDropPolicy {DropNewest, DropOldest};
+
+struct FanoutSinkOptions {
+    size_t max_queue_size = 2048;
+    std::chrono::milliseconds schedule_delay_millis = std::chrono::milliseconds(5000);
+    size_t max_export_batch_size = 512;
+    FanoutDropPolicy drop_policy = FanoutDropPolicy::DropNewest;
+};
+
+// Span processor that records each span once and hands the same immutable span data to several
+// exporters. Each exporter has its own bounded queue and worker thread, so that a slow exporter
+// only fills its own queue. Pipeline statistics count each span once per exporter, including the
+// batches each exporter fails to export.
+class FanoutSpanProcessor : public trace_sdk::SpanProcessor {
+  public:
+    using Sink = std::pair<std::unique_ptr<trace_sdk::SpanExporter>, FanoutSinkOptions>;
+
+    explicit FanoutSpanProcessor(std::vector<Sink>&& sinks, std::shared_ptr<PipelineStats> stats = nullptr);
+
+    ~FanoutSpanProcessor() override;
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnStart(trace_sdk::Recordable& span, const trace_api::SpanContext& parent_context) noexcept override {}
+
+    void OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    class SinkQueue;
+
+    std::vector<std::shared_ptr<SinkQueue> > Sinks;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry::sdk
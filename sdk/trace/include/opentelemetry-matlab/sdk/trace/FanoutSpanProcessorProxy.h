@@ -0,0 +1,38 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/FanoutSpanProcessor.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+
+#include <vector>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class FanoutSpanProcessorProxy : public SpanProcessorProxy {
+  public:
+    FanoutSpanProcessorProxy(const std::vector<std::shared_ptr<SpanExporterProxy> >& exporters);
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<trace_sdk::SpanProcessor> getInstance() override;
+
+    void setMaximumQueueSize(libmexclass::proxy::method::Context& context);
+
+    void setScheduledDelay(libmexclass::proxy::method::Context& context);
+
+    void setMaximumExportBatchSize(libmexclass::proxy::method::Context& context);
+
+    void setDropPolicy(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::vector<std::shared_ptr<SpanExporterProxy> > SpanExporters;
+    std::vector<FanoutSinkOptions> CppOptions;   // one per exporter
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,78 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/FlightRecorderBuffer.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Keeps recently ended spans in a flight recorder buffer and exports them only when dumped. Spans
+// are stored as OTLP encoded ResourceSpans, reusing the encoding of their resource and scope.
+class SpanFlightRecorder {
+  public:
+    SpanFlightRecorder(std::unique_ptr<trace_sdk::SpanExporter>&& exporter, const FlightRecorderOptions& options);
+
+    // Store a span created by MakeRecordable. Returns true if the span has an error status.
+    bool record(std::unique_ptr<trace_sdk::Recordable>&& span);
+
+    // Export the recorded spans and clear the buffer
+    bool dump();
+
+    // Forget the encodings of resources and scopes, which are only valid while the span processor
+    // that recorded their spans is running
+    void clearEncodings();
+
+    trace_sdk::SpanExporter& exporter() {
+        return *Exporter;
+    }
+
+  private:
+    std::unique_ptr<trace_sdk::SpanExporter> Exporter;
+    FlightRecorderBuffer Buffer;
+    std::mutex ExportMutex;
+    std::mutex EncodingMutex;
+    // encoded ResourceSpans and ScopeSpans without their spans, by address of resource and scope.
+    // Cleared on every dump and when a processor shuts down, so that addresses are not reused by
+    // other objects while entries refer to them.
+    std::map<std::pair<const void*, const void*>, std::pair<std::string, std::string> > Encodings;
+};
+
+// Span processor that records ended spans in a SpanFlightRecorder, and dumps it when a span
+// ends with an error status if triggered on error
+class FlightRecorderSpanProcessor : public trace_sdk::SpanProcessor {
+  public:
+    FlightRecorderSpanProcessor(std::shared_ptr<SpanFlightRecorder> recorder, bool trigger_on_error)
+	    : Recorder(std::move(recorder)), TriggerOnError(trigger_on_error) {}
+
+    ~FlightRecorderSpanProcessor() override;
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnStart(trace_sdk::Recordable& span, const trace_api::SpanContext& parent_context) noexcept override {}
+
+    void OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    std::shared_ptr<SpanFlightRecorder> Recorder;
+    bool TriggerOnError;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,41 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/FlightRecorderSpanProcessor.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+
+#include <vector>
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class FlightRecorderSpanProcessorProxy : public SpanProcessorProxy {
+  public:
+    FlightRecorderSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter);
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<trace_sdk::SpanProcessor> getInstance() override;
+
+    void setBufferSize(libmexclass::proxy::method::Context& context);
+
+    void setFileName(libmexclass::proxy::method::Context& context);
+
+    void setMaximumAge(libmexclass::proxy::method::Context& context);
+
+    void setTriggerOnError(libmexclass::proxy::method::Context& context);
+
+    void dump(libmexclass::proxy::method::Context& context);
+
+  private:
+    FlightRecorderOptions CppOptions;
+    bool TriggerOnError = true;
+    std::vector<std::weak_ptr<SpanFlightRecorder> > Recorders;   // one per tracer provider
+};
+} // namespace libmexclass::opentelemetry
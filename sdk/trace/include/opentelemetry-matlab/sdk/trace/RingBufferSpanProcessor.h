@@ -0,0 +1,43 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/BatchExportQueue.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Batch span processor built on a lock-free ring buffer, with a choice of what to do when the
+// queue is full and an optional byte budget for the queue
+class RingBufferSpanProcessor : public trace_sdk::SpanProcessor {
+  public:
+    RingBufferSpanProcessor(std::unique_ptr<trace_sdk::SpanExporter>&& exporter,
+		    const BatchExportQueueOptions& options, std::shared_ptr<PipelineStats> stats = nullptr);
+
+    ~RingBufferSpanProcessor() override;
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override;
+
+    void OnStart(trace_sdk::Recordable& span, const trace_api::SpanContext& parent_context) noexcept override {}
+
+    void OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override;
+
+  private:
+    std::unique_ptr<trace_sdk::SpanExporter> Exporter;
+    std::unique_ptr<BatchExportQueue<trace_sdk::Recordable> > Queue;
+    std::atomic<bool> IsShutdown{false};
+};
+} // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -15,12 +15,12 @@ namespace libmexclass::opentelemetry::sdk {
 class SimpleSpanProcessorProxy : public SpanProcessorProxy {
   public:
     SimpleSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter) 
-	    : SpanProcessorProxy(exporter) {}
+	    : SpanProcessorProxy(exporter, "SimpleSpanProcessor") {}
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
     std::unique_ptr<trace_sdk::SpanProcessor> getInstance() override {
-        return trace_sdk::SimpleSpanProcessorFactory::Create(std::move(SpanExporter->getInstance()));
+        return wrapProcessor(trace_sdk::SimpleSpanProcessorFactory::Create(wrapExporter(SpanExporter->getInstance())));
     }
 };
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,15 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/trace/recordable.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Copy the contents of a finished span into another recordable, typically one created by an exporter
+void replaySpanData(const trace_sdk::SpanData& source, trace_sdk::Recordable& target);
+
+} // namespace libmexclass::opentelemetry
@@ -1,11 +1,13 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
 #include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
 
 #include "libmexclass/proxy/Proxy.h"
 #include "libmexclass/proxy/ProxyManager.h"
+#include "libmexclass/proxy/method/Context.h"
 
 #include "opentelemetry/sdk/trace/processor.h"
 
@@ -16,9 +18,24 @@ class SpanProcessorProxy : public libmexclass::proxy::Proxy {
   public:
     virtual std::unique_ptr<trace_sdk::SpanProcessor> getInstance() = 0;
 
+    void getStats(libmexclass::proxy::method::Context& context);
+
+    void publishStats(libmexclass::proxy::method::Context& context);
+
   protected:
-    SpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter) : SpanExporter(exporter) {}
+    // component is the processor class name reported with the pipeline statistics
+    SpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter, const std::string& component);
+
+    // wrap an exporter so that its exports are counted in the pipeline statistics
+    std::unique_ptr<trace_sdk::SpanExporter> wrapExporter(std::unique_ptr<trace_sdk::SpanExporter>&& exporter);
+
+    // wrap a processor so that ended spans are counted in the pipeline statistics. If countrejected
+    // is set, spans the processor does not take ownership of are counted as dropped.
+    std::unique_ptr<trace_sdk::SpanProcessor> wrapProcessor(std::unique_ptr<trace_sdk::SpanProcessor>&& processor,
+		    bool countrejected = false);
 
     std::shared_ptr<SpanExporterProxy> SpanExporter;
+
+    std::shared_ptr<PipelineStats> Stats;
 };
 } // namespace libmexclass::opentelemetry
@@ -0,0 +1,44 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/common/SpoolForwarder.h"
+
+#include "libmexclass/proxy/Proxy.h"
+#include "libmexclass/proxy/method/Context.h"
+
+#include "opentelemetry/sdk/trace/exporter.h"
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+class SpoolSpanExporterProxy : public SpanExporterProxy {
+  public:
+    SpoolSpanExporterProxy(std::shared_ptr<SpanExporterProxy> exporter) : WrappedExporter(std::move(exporter)) {
+        REGISTER_METHOD(SpoolSpanExporterProxy, setDirectory);
+        REGISTER_METHOD(SpoolSpanExporterProxy, setSegmentSize);
+        REGISTER_METHOD(SpoolSpanExporterProxy, setMaxDiskUsage);
+        REGISTER_METHOD(SpoolSpanExporterProxy, setInitialBackoff);
+        REGISTER_METHOD(SpoolSpanExporterProxy, setMaxBackoff);
+    }
+
+    static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
+
+    std::unique_ptr<trace_sdk::SpanExporter> getInstance() override;
+
+    void setDirectory(libmexclass::proxy::method::Context& context);
+
+    void setSegmentSize(libmexclass::proxy::method::Context& context);
+
+    void setMaxDiskUsage(libmexclass::proxy::method::Context& context);
+
+    void setInitialBackoff(libmexclass::proxy::method::Context& context);
+
+    void setMaxBackoff(libmexclass::proxy::method::Context& context);
+
+  private:
+    std::shared_ptr<SpanExporterProxy> WrappedExporter;
+    SpoolOptions CppOptions;
+};
+} // namespace libmexclass::opentelemetry::sdk
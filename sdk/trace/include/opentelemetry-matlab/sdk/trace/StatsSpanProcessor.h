@@ -0,0 +1,83 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry-matlab/sdk/common/PipelineStats.h"
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include <chrono>
+#include <memory>
+
+namespace trace_api = opentelemetry::trace;
+namespace trace_sdk = opentelemetry::sdk::trace;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Span exporter wrapper that records the number, outcome, and duration of exports
+class StatsSpanExporter : public trace_sdk::SpanExporter {
+  public:
+    StatsSpanExporter(std::unique_ptr<trace_sdk::SpanExporter>&& exporter, std::shared_ptr<PipelineStats> stats)
+        : Exporter(std::move(exporter)), Stats(std::move(stats)) {}
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override {
+        return Exporter->MakeRecordable();
+    }
+
+    ::opentelemetry::sdk::common::ExportResult Export(
+		    const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->ForceFlush(timeout);
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Exporter->Shutdown(timeout);
+    }
+
+  private:
+    std::unique_ptr<trace_sdk::SpanExporter> Exporter;
+    std::shared_ptr<PipelineStats> Stats;
+};
+
+// Span processor wrapper that counts ended spans. The stock batch processor leaves a span it
+// rejects in the caller's pointer, so with countrejected set, a span still present after OnEnd
+// is counted as dropped.
+class StatsSpanProcessor : public trace_sdk::SpanProcessor {
+  public:
+    StatsSpanProcessor(std::unique_ptr<trace_sdk::SpanProcessor>&& processor, std::shared_ptr<PipelineStats> stats,
+		    bool countrejected = false)
+        : Processor(std::move(processor)), Stats(std::move(stats)), CountRejected(countrejected) {}
+
+    std::unique_ptr<trace_sdk::Recordable> MakeRecordable() noexcept override {
+        return Processor->MakeRecordable();
+    }
+
+    void OnStart(trace_sdk::Recordable& span, const trace_api::SpanContext& parent_context) noexcept override {
+        Processor->OnStart(span, parent_context);
+    }
+
+    void OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept override {
+        Stats->recordEnqueued(1);
+        Processor->OnEnd(std::move(span));
+        if (CountRejected && span) {
+            Stats->recordDropped(1);
+        }
+    }
+
+    bool ForceFlush(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Processor->ForceFlush(timeout);
+    }
+
+    bool Shutdown(std::chrono::microseconds timeout = (std::chrono::microseconds::max)()) noexcept override {
+        return Processor->Shutdown(timeout);
+    }
+
+  private:
+    std::unique_ptr<trace_sdk::SpanProcessor> Processor;
+    std::shared_ptr<PipelineStats> Stats;
+    const bool CountRejected;
+};
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,22 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#pragma once
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+#include "opentelemetry/exporters/otlp/protobuf_include_prefix.h"
+#include "opentelemetry/proto/collector/trace/v1/trace_service.pb.h"
+#include "opentelemetry/exporters/otlp/protobuf_include_suffix.h"
+
+namespace trace_sdk = opentelemetry::sdk::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+// Export the spans in an OTLP request through an exporter, by converting them into recordables
+// created by the exporter
+::opentelemetry::sdk::common::ExportResult exportTraceRequest(
+		const ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
+		trace_sdk::SpanExporter& exporter);
+
+} // namespace libmexclass::opentelemetry
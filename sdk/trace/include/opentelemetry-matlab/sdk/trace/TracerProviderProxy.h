@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #pragma once
 
@@ -14,14 +14,19 @@ class TracerProviderProxy : public libmexclass::opentelemetry::TracerProviderPro
         REGISTER_METHOD(TracerProviderProxy, addSpanProcessor);
         REGISTER_METHOD(TracerProviderProxy, shutdown);
         REGISTER_METHOD(TracerProviderProxy, forceFlush);
+        REGISTER_METHOD(TracerProviderProxy, setSpanLimits);
     }
 
     static libmexclass::proxy::MakeResult make(const libmexclass::proxy::FunctionArguments& constructor_arguments);
 
+    ~TracerProviderProxy();
+
     void addSpanProcessor(libmexclass::proxy::method::Context& context);
 
     void shutdown(libmexclass::proxy::method::Context& context);
 
     void forceFlush(libmexclass::proxy::method::Context& context);
+
+    void setSpanLimits(libmexclass::proxy::method::Context& context);
 };
 } // namespace libmexclass::opentelemetry
@@ -1,4 +1,4 @@
-// Copyright 2023 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/sdk/trace/BatchSpanProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
@@ -9,7 +9,7 @@
 
 namespace libmexclass::opentelemetry::sdk {
 BatchSpanProcessorProxy::BatchSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter)
-	: SpanProcessorProxy(exporter) {
+	: SpanProcessorProxy(exporter, "BatchSpanProcessor") {
     REGISTER_METHOD(BatchSpanProcessorProxy, setMaximumQueueSize);
     REGISTER_METHOD(BatchSpanProcessorProxy, setScheduledDelay);
     REGISTER_METHOD(BatchSpanProcessorProxy, setMaximumExportBatchSize);
@@ -24,7 +24,7 @@ libmexclass::proxy::MakeResult BatchSpanProcessorProxy::make(const libmexclass::
 }
 
 std::unique_ptr<trace_sdk::SpanProcessor> BatchSpanProcessorProxy::getInstance() {
-    return trace_sdk::BatchSpanProcessorFactory::Create(std::move(SpanExporter->getInstance()), CppOptions);
+    return wrapProcessor(trace_sdk::BatchSpanProcessorFactory::Create(wrapExporter(SpanExporter->getInstance()), CppOptions), true);
 }
 
 void BatchSpanProcessorProxy::setMaximumQueueSize(libmexclass::proxy::method::Context& context) {
@@ -0,0 +1,304 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/ChromeTraceSpanExporter.h"
+
+#include "opentelemetry/nostd/variant.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace trace_api = opentelemetry::trace;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+// traces that are never seen to end, for example because their root span is remote, are
+// forgotten after this many
+const size_t MaxTraceTracks = 4096;
+
+void appendString(std::string& out, nostd::string_view text) {
+    out.push_back('"');
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                } else {
+                    out.push_back(c);
+                }
+        }
+    }
+    out.push_back('"');
+}
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T>
+struct IsVector<std::vector<T> > : std::true_type {};
+
+template <typename T>
+void appendScalar(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out += value ? "true" : "false";
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        appendString(out, value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if (std::isfinite(value)) {
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+        } else {
+            out += "null";   // JSON has no NaN or infinity
+        }
+    } else {
+        out += std::to_string(value);
+    }
+}
+
+void appendValue(std::string& out, const common_sdk::OwnedAttributeValue& value) {
+    nostd::visit([&out](const auto& v) {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::vector<bool> >) {
+            out.push_back('[');
+            for (size_t i = 0; i < v.size(); ++i) {
+                out += i > 0 ? (v[i] ? ",true" : ",false") : (v[i] ? "true" : "false");
+            }
+            out.push_back(']');
+        } else if constexpr (IsVector<T>::value) {
+            out.push_back('[');
+            for (size_t i = 0; i < v.size(); ++i) {
+                if (i > 0) {
+                    out.push_back(',');
+                }
+                appendScalar(out, v[i]);
+            }
+            out.push_back(']');
+        } else {
+            appendScalar(out, v);
+        }
+    }, value);
+}
+
+template <typename AttributeMap>
+void appendArgs(std::string& out, const AttributeMap& attributes) {
+    for (const auto& kv : attributes) {
+        out.push_back(',');
+        appendString(out, kv.first);
+        out.push_back(':');
+        appendValue(out, kv.second);
+    }
+}
+
+// microseconds with nanosecond digits
+void appendTime(std::string& out, int64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", static_cast<long long>(nanoseconds / 1000),
+		    static_cast<long long>(nanoseconds % 1000));
+    out += buffer;
+}
+
+template <size_t N, typename Id>
+std::string toHex(const Id& id) {
+    char hex[N];
+    id.ToLowerBase16(nostd::span<char, N>(hex, N));
+    return std::string(hex, N);
+}
+
+template <typename AttributeMap>
+bool findInteger(const AttributeMap& attributes, const std::string& key, int64_t& value) {
+    auto found = attributes.find(key);
+    if (found == attributes.end()) {
+        return false;
+    }
+    if (nostd::holds_alternative<int64_t>(found->second)) {
+        value = nostd::get<int64_t>(found->second);
+    } else if (nostd::holds_alternative<int32_t>(found->second)) {
+        value = nostd::get<int32_t>(found->second);
+    } else if (nostd::holds_alternative<double>(found->second)) {
+        value = static_cast<int64_t>(nostd::get<double>(found->second));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int64_t currentProcessId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+} // namespace
+
+ChromeTraceSpanExporter::ChromeTraceSpanExporter(const std::string& filename)
+	: File(filename, std::ios::out | std::ios::trunc | std::ios::binary) {
+    File << "[\n";
+    File.flush();
+}
+
+std::unique_ptr<trace_sdk::Recordable> ChromeTraceSpanExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData());
+}
+
+int64_t ChromeTraceSpanExporter::processId(const trace_sdk::SpanData& span) {
+    const auto& resourceattrs = span.GetResource().GetAttributes();
+    int64_t pid;
+    if (!findInteger(resourceattrs, "process.pid", pid)) {
+        pid = currentProcessId();
+    }
+    if (NamedProcesses.insert(pid).second) {
+        // label the process with the service name
+        auto servicename = resourceattrs.find("service.name");
+        if (servicename != resourceattrs.end() && nostd::holds_alternative<std::string>(servicename->second)) {
+            std::string event = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(pid)
+		    + ",\"args\":{\"name\":";
+            appendString(event, nostd::get<std::string>(servicename->second));
+            event += "}}";
+            appendEvent(event);
+        }
+    }
+    return pid;
+}
+
+int64_t ChromeTraceSpanExporter::threadId(const trace_sdk::SpanData& span) {
+    int64_t tid;
+    if (findInteger(span.GetAttributes(), "thread.id", tid)) {
+        return tid;
+    }
+    auto traceid = span.GetTraceId().Id();
+    std::string key(reinterpret_cast<const char*>(traceid.data()), traceid.size());
+    auto found = TraceTracks.find(key);
+    if (found != TraceTracks.end()) {
+        tid = found->second;
+    } else {
+        if (TraceTracks.size() >= MaxTraceTracks) {
+            TraceTracks.clear();
+            FreeTracks.clear();
+            NextTrack = 1;
+        }
+        if (FreeTracks.empty()) {
+            tid = NextTrack++;
+        } else {
+            tid = *FreeTracks.begin();
+            FreeTracks.erase(FreeTracks.begin());
+        }
+        found = TraceTracks.emplace(key, tid).first;
+    }
+    // children end before their parent, so the trace is done with its track when the root ends
+    if (!span.GetParentSpanId().IsValid()) {
+        TraceTracks.erase(found);
+        FreeTracks.insert(tid);
+    }
+    return tid;
+}
+
+void ChromeTraceSpanExporter::appendEvent(const std::string& event) {
+    if (!FirstEvent) {
+        Pending += ",\n";
+    }
+    FirstEvent = false;
+    Pending += event;
+}
+
+::opentelemetry::sdk::common::ExportResult ChromeTraceSpanExporter::Export(
+		const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    if (IsShutdown.load()) {
+        return ::opentelemetry::sdk::common::ExportResult::kFailure;
+    }
+    std::lock_guard<std::mutex> lock(Mutex);
+    for (const auto& recordable : spans) {
+        auto span = static_cast<const trace_sdk::SpanData*>(recordable.get());
+        std::string ids = ",\"pid\":" + std::to_string(processId(*span))
+		+ ",\"tid\":" + std::to_string(threadId(*span));
+
+        std::string event = "{\"name\":";
+        appendString(event, span->GetName());
+        event += ",\"cat\":";
+        appendString(event, span->GetInstrumentationScope().GetName());
+        event += ",\"ph\":\"X\",\"ts\":";
+        appendTime(event, span->GetStartTime().time_since_epoch().count());
+        event += ",\"dur\":";
+        appendTime(event, span->GetDuration().count());
+        event += ids;
+        event += ",\"args\":{\"trace_id\":\"" + toHex<32>(span->GetTraceId())
+		+ "\",\"span_id\":\"" + toHex<16>(span->GetSpanId()) + "\"";
+        if (span->GetParentSpanId().IsValid()) {
+            event += ",\"parent_span_id\":\"" + toHex<16>(span->GetParentSpanId()) + "\"";
+        }
+        if (span->GetStatus() == trace_api::StatusCode::kError) {
+            event += ",\"status\":\"error\",\"status_message\":";
+            appendString(event, span->GetDescription());
+        }
+        appendArgs(event, span->GetAttributes());
+        event += "}}";
+        appendEvent(event);
+
+        for (const auto& spanevent : span->GetEvents()) {
+            std::string instant = "{\"name\":";
+            appendString(instant, spanevent.GetName());
+            instant += ",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+            appendTime(instant, spanevent.GetTimestamp().time_since_epoch().count());
+            instant += ids;
+            instant += ",\"args\":{";
+            std::string args;
+            appendArgs(args, spanevent.GetAttributes());
+            if (!args.empty()) {
+                instant.append(args, 1, std::string::npos);   // drop the leading comma
+            }
+            instant += "}}";
+            appendEvent(instant);
+        }
+    }
+    // write each batch out, so that memory use stays bounded and a crash loses at most one batch
+    File << Pending;
+    File.flush();
+    Pending.clear();
+    return File.good() ? ::opentelemetry::sdk::common::ExportResult::kSuccess
+	    : ::opentelemetry::sdk::common::ExportResult::kFailure;
+}
+
+bool ChromeTraceSpanExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    std::lock_guard<std::mutex> lock(Mutex);
+    File.flush();
+    return File.good();
+}
+
+bool ChromeTraceSpanExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(Mutex);
+    File << "\n]\n";
+    File.close();
+    return true;
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,15 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/ChromeTraceSpanExporterProxy.h"
+#include "opentelemetry-matlab/sdk/trace/ChromeTraceSpanExporter.h"
+
+namespace libmexclass::opentelemetry::sdk {
+std::unique_ptr<trace_sdk::SpanExporter> ChromeTraceSpanExporterProxy::getInstance() {
+    return std::unique_ptr<trace_sdk::SpanExporter>(new ChromeTraceSpanExporter(FileName));
+}
+
+void ChromeTraceSpanExporterProxy::setFileName(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filename_mda = context.inputs[0];
+    FileName = static_cast<std::string>(filename_mda[0]);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,75 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanExporter.h"
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanProcessor.h"
+
+#include "opentelemetry/sdk/trace/span_data.h"
+
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace common_sdk = opentelemetry::sdk::common;
+namespace fs = std::filesystem;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+int64_t integerAttribute(const trace_sdk::SpanData& span, const char* key, int64_t defaultvalue) {
+    const auto& attributes = span.GetAttributes();
+    auto found = attributes.find(key);
+    if (found == attributes.end() || !nostd::holds_alternative<int64_t>(found->second)) {
+        return defaultvalue;
+    }
+    return nostd::get<int64_t>(found->second);
+}
+} // namespace
+
+std::unique_ptr<trace_sdk::Recordable> CollapsedStackSpanExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData());
+}
+
+common_sdk::ExportResult CollapsedStackSpanExporter::Export(
+		const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    if (IsShutdown.load()) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    std::lock_guard<std::mutex> lock(Mutex);
+    for (const auto& recordable : spans) {
+        auto span = static_cast<const trace_sdk::SpanData*>(recordable.get());
+        int64_t duration = span->GetDuration().count();
+        int64_t value;
+        switch (Metric) {
+            case CollapsedStackMetric::SelfTime:
+                value = integerAttribute(*span, ProfileSelfTimeKey, duration) / 1000;
+                break;
+            case CollapsedStackMetric::TotalTime:
+                value = integerAttribute(*span, ProfileTotalTimeKey, duration) / 1000;
+                break;
+            default:
+                value = integerAttribute(*span, ProfileCountKey, 1);
+        }
+        Stacks[std::string(span->GetName())] += value;
+    }
+    return writeFile() ? common_sdk::ExportResult::kSuccess : common_sdk::ExportResult::kFailure;
+}
+
+bool CollapsedStackSpanExporter::writeFile() {
+    // write to a temporary file and rename it, so that readers never see a partial file
+    std::string tempname = FileName + ".tmp";
+    {
+        std::ofstream file(tempname, std::ios::out | std::ios::trunc);
+        for (const auto& [stack, value] : Stacks) {
+            if (value > 0) {
+                file << stack << ' ' << value << '\n';
+            }
+        }
+        if (!file) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(tempname, FileName, ec);
+    return !ec;
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,26 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanExporterProxy.h"
+
+namespace libmexclass::opentelemetry::sdk {
+std::unique_ptr<trace_sdk::SpanExporter> CollapsedStackSpanExporterProxy::getInstance() {
+    return std::unique_ptr<trace_sdk::SpanExporter>(new CollapsedStackSpanExporter(FileName, Metric));
+}
+
+void CollapsedStackSpanExporterProxy::setFileName(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filename_mda = context.inputs[0];
+    FileName = static_cast<std::string>(filename_mda[0]);
+}
+
+void CollapsedStackSpanExporterProxy::setMetric(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray metric_mda = context.inputs[0];
+    std::string metric = static_cast<std::string>(metric_mda[0]);
+    if (metric == "TotalTime") {
+        Metric = CollapsedStackMetric::TotalTime;
+    } else if (metric == "Count") {
+        Metric = CollapsedStackMetric::Count;
+    } else {
+        Metric = CollapsedStackMetric::SelfTime;
+    }
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,157 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanProcessor.h"
+
+#include "opentelemetry/sdk/trace/random_id_generator.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/nostd/span.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace common = opentelemetry::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+const char* const ProfileSelfTimeKey = "profile.self_time_ns";
+const char* const ProfileTotalTimeKey = "profile.total_time_ns";
+const char* const ProfileCountKey = "profile.count";
+
+namespace {
+uint64_t spanKey(const trace_api::SpanId& id) {
+    uint64_t key;
+    std::memcpy(&key, id.Id().data(), sizeof(key));
+    return key;
+}
+
+// semicolons separate stack frames and spaces separate the stack from its value
+std::string frameName(nostd::string_view name) {
+    std::string frame(name.data(), name.size());
+    std::replace(frame.begin(), frame.end(), ';', ':');
+    std::replace(frame.begin(), frame.end(), ' ', '_');
+    return frame;
+}
+} // namespace
+
+CollapsedStackSpanProcessor::CollapsedStackSpanProcessor(std::unique_ptr<trace_sdk::SpanExporter>&& exporter,
+		std::chrono::milliseconds export_interval)
+	: Exporter(std::move(exporter)), ExportInterval(export_interval),
+	  IntervalStart(std::chrono::system_clock::now()), LastExport(std::chrono::steady_clock::now()) {}
+
+CollapsedStackSpanProcessor::~CollapsedStackSpanProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<trace_sdk::Recordable> CollapsedStackSpanProcessor::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData());
+}
+
+void CollapsedStackSpanProcessor::OnStart(trace_sdk::Recordable& span,
+		const trace_api::SpanContext& parent_context) noexcept {
+    auto& data = static_cast<trace_sdk::SpanData&>(span);
+    std::lock_guard<std::mutex> lock(Mutex);
+    ActiveSpan entry;
+    auto parent = parent_context.IsValid() ? Active.find(spanKey(parent_context.span_id())) : Active.end();
+    if (parent != Active.end()) {
+        entry.Stack = parent->second.Stack + ';';
+    }
+    entry.Stack += frameName(data.GetName());
+    Active[spanKey(data.GetSpanId())] = std::move(entry);
+}
+
+void CollapsedStackSpanProcessor::OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !span) {
+        return;
+    }
+    auto data = static_cast<const trace_sdk::SpanData*>(span.get());
+    bool exportdue = false;
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        auto found = Active.find(spanKey(data->GetSpanId()));
+        if (found == Active.end()) {
+            return;
+        }
+        std::chrono::nanoseconds duration = data->GetDuration();
+        StackTotals& totals = Totals[found->second.Stack];
+        ++totals.Count;
+        totals.TotalTime += duration;
+        totals.SelfTime += (std::max)(duration - found->second.ChildTime, std::chrono::nanoseconds(0));
+        Active.erase(found);
+
+        auto parent = Active.find(spanKey(data->GetParentSpanId()));
+        if (data->GetParentSpanId().IsValid() && parent != Active.end()) {
+            parent->second.ChildTime += duration;
+        }
+        if (Resource == nullptr) {
+            Resource = &data->GetResource();
+            Scope = &data->GetInstrumentationScope();
+        }
+        exportdue = ExportInterval.count() > 0 && std::chrono::steady_clock::now() - LastExport >= ExportInterval;
+    }
+    if (exportdue) {
+        exportStacks();
+    }
+}
+
+bool CollapsedStackSpanProcessor::exportStacks() {
+    std::lock_guard<std::mutex> exportlock(ExportMutex);
+    std::unordered_map<std::string, StackTotals> totals;
+    std::chrono::system_clock::time_point intervalstart;
+    const ::opentelemetry::sdk::resource::Resource* resource;
+    const ::opentelemetry::sdk::instrumentationscope::InstrumentationScope* scope;
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        totals.swap(Totals);
+        resource = Resource;
+        scope = Scope;
+        intervalstart = IntervalStart;
+        IntervalStart = std::chrono::system_clock::now();
+        LastExport = std::chrono::steady_clock::now();
+    }
+    if (totals.empty()) {
+        return true;
+    }
+
+    trace_sdk::RandomIdGenerator ids;
+    trace_api::TraceId traceid = ids.GenerateTraceId();
+    std::vector<std::unique_ptr<trace_sdk::Recordable> > records;
+    records.reserve(totals.size());
+    for (const auto& [stack, total] : totals) {
+        std::unique_ptr<trace_sdk::Recordable> record = Exporter->MakeRecordable();
+        record->SetIdentity(trace_api::SpanContext(traceid, ids.GenerateSpanId(),
+			    trace_api::TraceFlags(trace_api::TraceFlags::kIsSampled), false), trace_api::SpanId());
+        record->SetName(stack);
+        record->SetSpanKind(trace_api::SpanKind::kInternal);
+        record->SetStartTime(common::SystemTimestamp(intervalstart));
+        record->SetDuration(total.TotalTime);
+        record->SetAttribute(ProfileSelfTimeKey, static_cast<int64_t>(total.SelfTime.count()));
+        record->SetAttribute(ProfileTotalTimeKey, static_cast<int64_t>(total.TotalTime.count()));
+        record->SetAttribute(ProfileCountKey, static_cast<int64_t>(total.Count));
+        if (resource != nullptr) {
+            record->SetResource(*resource);
+            record->SetInstrumentationScope(*scope);
+        }
+        records.push_back(std::move(record));
+    }
+    return Exporter->Export(nostd::span<std::unique_ptr<trace_sdk::Recordable> >(records.data(), records.size()))
+	    == ::opentelemetry::sdk::common::ExportResult::kSuccess;
+}
+
+bool CollapsedStackSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire)) {
+        return false;
+    }
+    bool result = exportStacks();
+    return Exporter->ForceFlush(timeout) && result;
+}
+
+bool CollapsedStackSpanProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    exportStacks();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,33 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/CollapsedStackSpanProcessor.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+libmexclass::proxy::MakeResult CollapsedStackSpanProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    std::shared_ptr<SpanExporterProxy> exporter = std::static_pointer_cast<SpanExporterProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    return std::make_shared<CollapsedStackSpanProcessorProxy>(exporter);
+}
+
+std::unique_ptr<trace_sdk::SpanProcessor> CollapsedStackSpanProcessorProxy::getInstance() {
+    // spans are folded instead of being passed on, so only the exported profile records are
+    // counted in the pipeline statistics
+    return std::unique_ptr<trace_sdk::SpanProcessor>(new CollapsedStackSpanProcessor(
+		    wrapExporter(SpanExporter->getInstance()), ExportInterval));
+}
+
+void CollapsedStackSpanProcessorProxy::setExportInterval(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> interval_mda = context.inputs[0];
+    double interval = interval_mda[0];
+    // Inf means export only on flush
+    ExportInterval = std::isinf(interval) ? std::chrono::milliseconds(0)
+	    : std::chrono::milliseconds(static_cast<int64_t>(interval));
+}
+} // namespace libmexclass::opentelemetry
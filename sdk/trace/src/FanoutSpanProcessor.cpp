@@ -0,0 +1,248 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/FanoutSpanProcessor.h"
+#include "opentelemetry-matlab/sdk/trace/SpanDataReplay.h"
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace nostd = opentelemetry::nostd;
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+// wait on a condition variable, treating the maximum duration as no timeout
+template <typename Predicate>
+bool waitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+        std::chrono::microseconds timeout, Predicate pred) {
+    if (timeout == (std::chrono::microseconds::max)()) {
+        cv.wait(lock, pred);
+        return true;
+    }
+    return cv.wait_for(lock, timeout, pred);
+}
+
+// end of a timeout that starts now, where the maximum duration means no deadline
+std::chrono::steady_clock::time_point deadlineAfter(std::chrono::microseconds timeout) {
+    if (timeout == (std::chrono::microseconds::max)()) {
+        return (std::chrono::steady_clock::time_point::max)();
+    }
+    return std::chrono::steady_clock::now() + timeout;
+}
+
+// time left until a deadline from deadlineAfter
+std::chrono::microseconds remaining(std::chrono::steady_clock::time_point deadline) {
+    if (deadline == (std::chrono::steady_clock::time_point::max)()) {
+        return (std::chrono::microseconds::max)();
+    }
+    auto left = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+    return (std::max)(left, std::chrono::microseconds::zero());
+}
+} // namespace
+
+// The worker thread holds a reference to its queue, so that a shutdown that times out while an export
+// hangs can leave the worker behind without destroying the queue it uses.
+class FanoutSpanProcessor::SinkQueue : public std::enable_shared_from_this<SinkQueue> {
+  public:
+    SinkQueue(std::unique_ptr<trace_sdk::SpanExporter>&& exporter, const FanoutSinkOptions& options,
+            std::shared_ptr<PipelineStats> stats)
+        : Exporter(std::move(exporter)), Options(options), Stats(std::move(stats)) {
+        Options.max_queue_size = (std::max)(Options.max_queue_size, static_cast<size_t>(1));
+        if (Options.max_export_batch_size == 0 || Options.max_export_batch_size > Options.max_queue_size) {
+            Options.max_export_batch_size = Options.max_queue_size;
+        }
+    }
+
+    void start() {
+        Worker = std::thread([self = shared_from_this()] { self->run(); });
+    }
+
+    void push(const std::shared_ptr<const trace_sdk::SpanData>& span) {
+        if (Stats) {
+            Stats->recordEnqueued(1);
+        }
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (Stop) {
+            recordDropped();
+            return;
+        }
+        if (Queue.size() >= Options.max_queue_size) {
+            recordDropped();
+            if (Options.drop_policy == FanoutDropPolicy::DropNewest) {
+                return;
+            }
+            Queue.pop_front();
+        }
+        Queue.push_back(span);
+        if (Queue.size() >= Options.max_export_batch_size) {
+            Ready.notify_one();
+        }
+    }
+
+    bool forceFlush(std::chrono::microseconds timeout) {
+        auto deadline = deadlineAfter(timeout);
+        std::unique_lock<std::mutex> lock(Mutex);
+        FlushRequested = true;
+        Ready.notify_one();
+        bool drained = waitFor(Drained, lock, timeout, [this] { return Queue.empty() && InFlight == 0; });
+        lock.unlock();
+        return drained && Exporter->ForceFlush(remaining(deadline));
+    }
+
+    bool shutdown(std::chrono::microseconds timeout) {
+        auto deadline = deadlineAfter(timeout);
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (Stop) {
+            return true;
+        }
+        Stop = true;
+        Ready.notify_one();
+        // the worker drains the remaining spans before exiting
+        bool finished = waitFor(Drained, lock, timeout, [this] { return Finished; });
+        if (!finished) {
+            // an export is hung, spans still queued are not exported
+            if (Stats) {
+                Stats->recordDropped(Queue.size());
+            }
+            Queue.clear();
+        }
+        lock.unlock();
+        if (finished) {
+            Worker.join();
+        } else {
+            Worker.detach();
+        }
+        // shutting down the exporter may also cancel the hung export
+        return Exporter->Shutdown(remaining(deadline)) && finished;
+    }
+
+  private:
+    void recordDropped() {
+        if (Stats) {
+            Stats->recordDropped(1);
+        }
+    }
+
+    void run() {
+        std::vector<std::shared_ptr<const trace_sdk::SpanData> > batch;
+        std::unique_lock<std::mutex> lock(Mutex);
+        while (true) {
+            Ready.wait_for(lock, Options.schedule_delay_millis, [this] {
+                    return Stop || FlushRequested || Queue.size() >= Options.max_export_batch_size; });
+            if (Queue.empty()) {
+                FlushRequested = false;
+                if (Stop) {
+                    Finished = true;
+                    Drained.notify_all();
+                    break;
+                }
+                Drained.notify_all();
+                continue;
+            }
+            size_t n = (std::min)(Queue.size(), Options.max_export_batch_size);
+            batch.assign(Queue.begin(), Queue.begin() + n);
+            Queue.erase(Queue.begin(), Queue.begin() + n);
+            InFlight = n;
+            lock.unlock();
+            exportBatch(batch);
+            batch.clear();
+            lock.lock();
+            InFlight = 0;
+            if (Queue.empty()) {
+                FlushRequested = false;
+                Drained.notify_all();
+            }
+        }
+    }
+
+    void exportBatch(const std::vector<std::shared_ptr<const trace_sdk::SpanData> >& batch) {
+        // each exporter needs spans in its own recordable type, which is filled from the shared span data
+        std::vector<std::unique_ptr<trace_sdk::Recordable> > recordables;
+        recordables.reserve(batch.size());
+        for (const auto& span : batch) {
+            std::unique_ptr<trace_sdk::Recordable> recordable = Exporter->MakeRecordable();
+            if (recordable) {
+                replaySpanData(*span, *recordable);
+                recordables.push_back(std::move(recordable));
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        auto result = Exporter->Export(nostd::span<std::unique_ptr<trace_sdk::Recordable> >(recordables.data(),
+                    recordables.size()));
+        if (Stats) {
+            // failed batches are counted here rather than by an exporter wrapper, like dropped spans
+            Stats->recordExport(batch.size(), result == common_sdk::ExportResult::kSuccess,
+                    std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    std::unique_ptr<trace_sdk::SpanExporter> Exporter;
+    FanoutSinkOptions Options;
+    std::shared_ptr<PipelineStats> Stats;
+    std::mutex Mutex;
+    std::condition_variable Ready;
+    std::condition_variable Drained;
+    std::deque<std::shared_ptr<const trace_sdk::SpanData> > Queue;
+    size_t InFlight = 0;
+    bool FlushRequested = false;
+    bool Stop = false;
+    bool Finished = false;      // worker has exported all spans after Stop
+    std::thread Worker;
+};
+
+FanoutSpanProcessor::FanoutSpanProcessor(std::vector<Sink>&& sinks, std::shared_ptr<PipelineStats> stats) {
+    Sinks.reserve(sinks.size());
+    for (auto& sink : sinks) {
+        Sinks.push_back(std::make_shared<SinkQueue>(std::move(sink.first), sink.second, stats));
+        Sinks.back()->start();
+    }
+}
+
+FanoutSpanProcessor::~FanoutSpanProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<trace_sdk::Recordable> FanoutSpanProcessor::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new trace_sdk::SpanData);
+}
+
+void FanoutSpanProcessor::OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !span) {
+        return;
+    }
+    // recordables passed to OnEnd are always the ones created by MakeRecordable
+    std::shared_ptr<const trace_sdk::SpanData> data(static_cast<trace_sdk::SpanData*>(span.release()));
+    for (auto& sink : Sinks) {
+        sink->push(data);
+    }
+}
+
+bool FanoutSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    // the timeout applies to all sinks together
+    auto deadline = deadlineAfter(timeout);
+    bool result = true;
+    for (auto& sink : Sinks) {
+        result = sink->forceFlush(remaining(deadline)) && result;
+    }
+    return result;
+}
+
+bool FanoutSpanProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    auto deadline = deadlineAfter(timeout);
+    bool result = true;
+    for (auto& sink : Sinks) {
+        result = sink->shutdown(remaining(deadline)) && result;
+    }
+    return result;
+}
+} // namespace libmexclass::opentelemetry::sdk
@@ -0,0 +1,81 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/FanoutSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+namespace libmexclass::opentelemetry::sdk {
+FanoutSpanProcessorProxy::FanoutSpanProcessorProxy(const std::vector<std::shared_ptr<SpanExporterProxy> >& exporters)
+	: SpanProcessorProxy(exporters.front(), "FanoutSpanProcessor"), SpanExporters(exporters), CppOptions(exporters.size()) {
+    REGISTER_METHOD(FanoutSpanProcessorProxy, setMaximumQueueSize);
+    REGISTER_METHOD(FanoutSpanProcessorProxy, setScheduledDelay);
+    REGISTER_METHOD(FanoutSpanProcessorProxy, setMaximumExportBatchSize);
+    REGISTER_METHOD(FanoutSpanProcessorProxy, setDropPolicy);
+}
+
+libmexclass::proxy::MakeResult FanoutSpanProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterids_mda = constructor_arguments[0];
+    std::vector<std::shared_ptr<SpanExporterProxy> > exporters;
+    for (libmexclass::proxy::ID exporterid : exporterids_mda) {
+        exporters.push_back(std::static_pointer_cast<SpanExporterProxy>(
+            libmexclass::proxy::ProxyManager::getProxy(exporterid)));
+    }
+    if (exporters.empty()) {
+        return libmexclass::error::Error{"opentelemetry:sdk:trace:FanoutSpanProcessor:NoExporter",
+		"At least one span exporter must be specified."};
+    }
+    return std::make_shared<FanoutSpanProcessorProxy>(exporters);
+}
+
+std::unique_ptr<trace_sdk::SpanProcessor> FanoutSpanProcessorProxy::getInstance() {
+    std::vector<FanoutSpanProcessor::Sink> sinks;
+    for (size_t i = 0; i < SpanExporters.size(); ++i) {
+        // export outcomes are counted by the processor itself
+        sinks.emplace_back(SpanExporters[i]->getInstance(), CppOptions[i]);
+    }
+    return std::unique_ptr<trace_sdk::SpanProcessor>(new FanoutSpanProcessor(std::move(sinks), Stats));
+}
+
+void FanoutSpanProcessorProxy::setMaximumQueueSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> qsize_mda = context.inputs[0];
+    for (size_t i = 0; i < CppOptions.size() && i < qsize_mda.getNumberOfElements(); ++i) {
+        double qsize = qsize_mda[i];
+        if (qsize > 0) {
+            CppOptions[i].max_queue_size = static_cast<size_t>(qsize);
+        }
+    }
+}
+
+void FanoutSpanProcessorProxy::setScheduledDelay(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> delay_mda = context.inputs[0];
+    for (size_t i = 0; i < CppOptions.size() && i < delay_mda.getNumberOfElements(); ++i) {
+        double delay = delay_mda[i];
+        if (delay > 0) {
+            CppOptions[i].schedule_delay_millis = std::chrono::milliseconds(static_cast<int64_t>(delay));
+        }
+    }
+}
+
+void FanoutSpanProcessorProxy::setMaximumExportBatchSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> batchsize_mda = context.inputs[0];
+    for (size_t i = 0; i < CppOptions.size() && i < batchsize_mda.getNumberOfElements(); ++i) {
+        double batchsize = batchsize_mda[i];
+        if (batchsize > 0) {
+            CppOptions[i].max_export_batch_size = static_cast<size_t>(batchsize);
+        }
+    }
+}
+
+void FanoutSpanProcessorProxy::setDropPolicy(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray policy_mda = context.inputs[0];
+    for (size_t i = 0; i < CppOptions.size() && i < policy_mda.getNumberOfElements(); ++i) {
+        std::string policy = static_cast<std::string>(policy_mda[i]);
+        if (policy == "dropoldest") {
+            CppOptions[i].drop_policy = FanoutDropPolicy::DropOldest;
+        } else if (policy == "dropnewest") {
+            CppOptions[i].drop_policy = FanoutDropPolicy::DropNewest;
+        }
+    }
+}
+} // namespace libmexclass::opentelemetry
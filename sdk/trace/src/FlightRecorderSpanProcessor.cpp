@@ -0,0 +1,142 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/FlightRecorderSpanProcessor.h"
+#include "opentelemetry-matlab/sdk/trace/TraceRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+#include "opentelemetry/nostd/span.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+namespace trace_proto = ::opentelemetry::proto::trace::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+SpanFlightRecorder::SpanFlightRecorder(std::unique_ptr<trace_sdk::SpanExporter>&& exporter,
+		const FlightRecorderOptions& options) : Exporter(std::move(exporter)), Buffer(options) {}
+
+bool SpanFlightRecorder::record(std::unique_ptr<trace_sdk::Recordable>&& span) {
+    auto otlpspan = dynamic_cast<otlp_exporter::OtlpRecordable*>(span.get());
+    if (otlpspan == nullptr) {
+        return false;
+    }
+    bool error = otlpspan->span().status().code() == trace_proto::Status::STATUS_CODE_ERROR;
+    auto key = std::make_pair(static_cast<const void*>(otlpspan->GetResource()),
+		    static_cast<const void*>(otlpspan->GetInstrumentationScope()));
+
+    std::unique_lock<std::mutex> lock(EncodingMutex);
+    auto found = Encodings.find(key);
+    if (found != Encodings.end()) {
+        std::string resourcepart = found->second.first;
+        std::string scopepart = found->second.second;
+        lock.unlock();
+        std::string spanbytes = otlpspan->span().SerializeAsString();
+        std::string spanheader, scopeheader;
+        appendProtoFieldHeader(spanheader, 2, spanbytes.size());    // ScopeSpans.spans
+        appendProtoFieldHeader(scopeheader, 2, scopepart.size() + spanheader.size() + spanbytes.size());  // ResourceSpans.scope_spans
+        Buffer.push({resourcepart, scopeheader, scopepart, spanheader, spanbytes});
+        return error;
+    }
+
+    // first span of this resource and scope, encode it in full and keep the resource and scope
+    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(
+		    nostd::span<std::unique_ptr<trace_sdk::Recordable> >(&span, 1), &request);
+    if (request.resource_spans_size() == 0) {
+        return error;
+    }
+    trace_proto::ResourceSpans& resourcespans = *request.mutable_resource_spans(0);
+    Buffer.push({resourcespans.SerializeAsString()});
+    if (resourcespans.scope_spans_size() > 0) {
+        trace_proto::ScopeSpans scopespans = resourcespans.scope_spans(0);
+        scopespans.clear_spans();
+        resourcespans.clear_scope_spans();
+        Encodings.emplace(key, std::make_pair(resourcespans.SerializeAsString(), scopespans.SerializeAsString()));
+    }
+    return error;
+}
+
+bool SpanFlightRecorder::dump() {
+    // one dump at a time, so that spans are exported in the order they ended
+    std::lock_guard<std::mutex> lock(ExportMutex);
+    std::vector<std::string> records = Buffer.take();
+    clearEncodings();
+    if (records.empty()) {
+        return true;
+    }
+    // regroup the spans by resource and scope
+    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+    std::unordered_map<std::string, trace_proto::ResourceSpans*> resources;
+    std::unordered_map<std::string, trace_proto::ScopeSpans*> scopes;
+    for (const auto& record : records) {
+        trace_proto::ResourceSpans entry;
+        if (!entry.ParseFromString(record)) {
+            continue;
+        }
+        std::string resourcekey = entry.resource().SerializeAsString() + '\0' + entry.schema_url();
+        trace_proto::ResourceSpans*& resource = resources[resourcekey];
+        if (resource == nullptr) {
+            resource = request.add_resource_spans();
+            *resource->mutable_resource() = entry.resource();
+            resource->set_schema_url(entry.schema_url());
+        }
+        for (auto& scopeentry : *entry.mutable_scope_spans()) {
+            std::string scopekey = resourcekey + '\0' + scopeentry.scope().SerializeAsString() + '\0' + scopeentry.schema_url();
+            trace_proto::ScopeSpans*& scope = scopes[scopekey];
+            if (scope == nullptr) {
+                scope = resource->add_scope_spans();
+                *scope->mutable_scope() = scopeentry.scope();
+                scope->set_schema_url(scopeentry.schema_url());
+            }
+            for (auto& item : *scopeentry.mutable_spans()) {
+                *scope->add_spans() = std::move(item);
+            }
+        }
+    }
+    return exportTraceRequest(request, *Exporter) == common_sdk::ExportResult::kSuccess;
+}
+
+void SpanFlightRecorder::clearEncodings() {
+    std::lock_guard<std::mutex> lock(EncodingMutex);
+    Encodings.clear();
+}
+
+FlightRecorderSpanProcessor::~FlightRecorderSpanProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<trace_sdk::Recordable> FlightRecorderSpanProcessor::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new otlp_exporter::OtlpRecordable());
+}
+
+void FlightRecorderSpanProcessor::OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !span) {
+        return;
+    }
+    if (Recorder->record(std::move(span)) && TriggerOnError) {
+        Recorder->dump();
+    }
+}
+
+bool FlightRecorderSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // recorded spans are only exported by a dump
+    return Recorder->exporter().ForceFlush(timeout);
+}
+
+bool FlightRecorderSpanProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    // spans still recorded are kept, in the recording file if there is one, but the resource and
+    // scopes of this processor's provider go away
+    Recorder->clearEncodings();
+    return Recorder->exporter().Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,78 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/FlightRecorderSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+FlightRecorderSpanProcessorProxy::FlightRecorderSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter)
+	: SpanProcessorProxy(exporter, "FlightRecorderSpanProcessor") {
+    REGISTER_METHOD(FlightRecorderSpanProcessorProxy, setBufferSize);
+    REGISTER_METHOD(FlightRecorderSpanProcessorProxy, setFileName);
+    REGISTER_METHOD(FlightRecorderSpanProcessorProxy, setMaximumAge);
+    REGISTER_METHOD(FlightRecorderSpanProcessorProxy, setTriggerOnError);
+    REGISTER_METHOD(FlightRecorderSpanProcessorProxy, dump);
+}
+
+libmexclass::proxy::MakeResult FlightRecorderSpanProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];
+    std::shared_ptr<SpanExporterProxy> exporter = std::static_pointer_cast<SpanExporterProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    return std::make_shared<FlightRecorderSpanProcessorProxy>(exporter);
+}
+
+std::unique_ptr<trace_sdk::SpanProcessor> FlightRecorderSpanProcessorProxy::getInstance() {
+    auto recorder = std::make_shared<SpanFlightRecorder>(wrapExporter(SpanExporter->getInstance()), CppOptions);
+    Recorders.push_back(recorder);
+    return wrapProcessor(std::unique_ptr<trace_sdk::SpanProcessor>(new FlightRecorderSpanProcessor(
+		    recorder, TriggerOnError)));
+}
+
+void FlightRecorderSpanProcessorProxy::setBufferSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> bufsize_mda = context.inputs[0];
+    double bufsize = bufsize_mda[0];
+    if (bufsize > 0) {
+        CppOptions.buffer_size = static_cast<size_t>(bufsize);
+    }
+}
+
+void FlightRecorderSpanProcessorProxy::setFileName(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray filename_mda = context.inputs[0];
+    CppOptions.filename = static_cast<std::string>(filename_mda[0]);
+}
+
+void FlightRecorderSpanProcessorProxy::setMaximumAge(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> maxage_mda = context.inputs[0];
+    double maxage = maxage_mda[0];
+    // Inf means no age limit
+    if (maxage >= 0) {
+        CppOptions.max_age = std::isinf(maxage) ? (std::chrono::nanoseconds::max)()
+		: std::chrono::nanoseconds(static_cast<int64_t>(maxage * 1e6));
+    }
+}
+
+void FlightRecorderSpanProcessorProxy::setTriggerOnError(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<bool> trigger_mda = context.inputs[0];
+    TriggerOnError = trigger_mda[0];
+}
+
+void FlightRecorderSpanProcessorProxy::dump(libmexclass::proxy::method::Context& context) {
+    bool success = true;
+    for (auto it = Recorders.begin(); it != Recorders.end();) {
+        std::shared_ptr<SpanFlightRecorder> recorder = it->lock();
+        if (!recorder) {
+            // the tracer provider has been destroyed
+            it = Recorders.erase(it);
+            continue;
+        }
+        success = recorder->dump() && success;
+        ++it;
+    }
+    matlab::data::ArrayFactory factory;
+    context.outputs[0] = factory.createScalar(success);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,136 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/RingBufferSpanProcessor.h"
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/sdk/common/attribute_utils.h"
+#include "opentelemetry/sdk/common/exporter_utils.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/nostd/variant.h"
+
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace nostd = opentelemetry::nostd;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+// fixed part of a span: ids, flags, kind, status code, and timestamps
+const size_t SpanOverhead = 64;
+// fixed part of an event or a link
+const size_t EntryOverhead = 32;
+// size assumed for spans of exporters with an unknown recordable type
+const size_t DefaultSpanSize = 512;
+
+size_t attributeValueSize(const common_sdk::OwnedAttributeValue& value) {
+    return nostd::visit([](const auto& v) -> size_t {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+            return v.size();
+        } else if constexpr (std::is_same_v<T, std::vector<std::string> >) {
+            size_t n = 0;
+            for (const auto& item : v) {
+                n += item.size();
+            }
+            return n;
+        } else if constexpr (std::is_same_v<T, std::vector<bool> >) {
+            return v.size();
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            return sizeof(T);
+        } else {
+            return v.size() * sizeof(typename T::value_type);
+        }
+    }, value);
+}
+
+size_t attributesSize(const std::unordered_map<std::string, common_sdk::OwnedAttributeValue>& attributes) {
+    size_t n = 0;
+    for (const auto& [key, value] : attributes) {
+        n += key.size() + attributeValueSize(value);
+    }
+    return n;
+}
+
+// estimate of the encoded size from the name, attributes, events, and links
+size_t spanDataSize(const trace_sdk::SpanData& span) {
+    size_t n = SpanOverhead + span.GetName().size() + span.GetDescription().size()
+        + attributesSize(span.GetAttributes());
+    for (const auto& event : span.GetEvents()) {
+        n += EntryOverhead + event.GetName().size() + attributesSize(event.GetAttributes());
+    }
+    for (const auto& link : span.GetLinks()) {
+        n += EntryOverhead + attributesSize(link.GetAttributes());
+    }
+    return n;
+}
+
+size_t spanSize(trace_sdk::Recordable& span) {
+    auto otlpspan = dynamic_cast<otlp_exporter::OtlpRecordable*>(&span);
+    if (otlpspan != nullptr) {
+        return otlpspan->span().ByteSizeLong();
+    }
+    auto spandata = dynamic_cast<trace_sdk::SpanData*>(&span);
+    if (spandata != nullptr) {
+        return spanDataSize(*spandata);
+    }
+    return DefaultSpanSize;
+}
+} // namespace
+
+RingBufferSpanProcessor::RingBufferSpanProcessor(std::unique_ptr<trace_sdk::SpanExporter>&& exporter,
+		const BatchExportQueueOptions& options, std::shared_ptr<PipelineStats> stats) : Exporter(std::move(exporter)) {
+    trace_sdk::SpanExporter* exp = Exporter.get();
+    Queue.reset(new BatchExportQueue<trace_sdk::Recordable>(options,
+        [exp](std::vector<std::unique_ptr<trace_sdk::Recordable> >& batch) {
+            return exp->Export(nostd::span<std::unique_ptr<trace_sdk::Recordable> >(batch.data(), batch.size()))
+                == common_sdk::ExportResult::kSuccess;
+        }, std::move(stats)));
+}
+
+RingBufferSpanProcessor::~RingBufferSpanProcessor() {
+    Shutdown();
+}
+
+std::unique_ptr<trace_sdk::Recordable> RingBufferSpanProcessor::MakeRecordable() noexcept {
+    return Exporter->MakeRecordable();
+}
+
+void RingBufferSpanProcessor::OnEnd(std::unique_ptr<trace_sdk::Recordable>&& span) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire) || !span) {
+        return;
+    }
+    size_t bytes = spanSize(*span);
+    Queue->push(std::move(span), bytes);
+}
+
+bool RingBufferSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.load(std::memory_order_acquire)) {
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (!Queue->flush(timeout)) {
+        return false;
+    }
+    if (timeout == (std::chrono::microseconds::max)()) {
+        return Exporter->ForceFlush(timeout);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+    return elapsed < timeout && Exporter->ForceFlush(timeout - elapsed);
+}
+
+bool RingBufferSpanProcessor::Shutdown(std::chrono::microseconds timeout) noexcept {
+    if (IsShutdown.exchange(true)) {
+        return true;
+    }
+    // exports all queued spans before stopping
+    Queue->stop();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,87 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/RingBufferSpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/RingBufferSpanProcessor.h"
+#include "opentelemetry-matlab/sdk/trace/SpanExporterProxy.h"
+
+#include "libmexclass/proxy/ProxyManager.h"
+
+#include <cmath>
+
+namespace libmexclass::opentelemetry::sdk {
+RingBufferSpanProcessorProxy::RingBufferSpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter)
+	: SpanProcessorProxy(exporter, "RingBufferSpanProcessor") {
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setMaximumQueueSize);
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setMaximumQueueBytes);
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setScheduledDelay);
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setMaximumExportBatchSize);
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setFullQueuePolicy);
+    REGISTER_METHOD(RingBufferSpanProcessorProxy, setBlockTimeout);
+}
+
+libmexclass::proxy::MakeResult RingBufferSpanProcessorProxy::make(const libmexclass::proxy::FunctionArguments& constructor_arguments) {
+    matlab::data::TypedArray<uint64_t> exporterid_mda = constructor_arguments[0];
+    libmexclass::proxy::ID exporterid = exporterid_mda[0];	
+    std::shared_ptr<SpanExporterProxy> exporter = std::static_pointer_cast<SpanExporterProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(exporterid));
+    return std::make_shared<RingBufferSpanProcessorProxy>(exporter);
+}
+
+std::unique_ptr<trace_sdk::SpanProcessor> RingBufferSpanProcessorProxy::getInstance() {
+    return wrapProcessor(std::unique_ptr<trace_sdk::SpanProcessor>(new RingBufferSpanProcessor(
+		    wrapExporter(SpanExporter->getInstance()), CppOptions, Stats)));
+}
+
+void RingBufferSpanProcessorProxy::setMaximumQueueSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> qsize_mda = context.inputs[0];
+    double qsize = qsize_mda[0];
+    if (qsize > 0) {
+        CppOptions.max_queue_size = static_cast<size_t>(qsize);
+    }
+}
+
+void RingBufferSpanProcessorProxy::setMaximumQueueBytes(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> qbytes_mda = context.inputs[0];
+    double qbytes = qbytes_mda[0];
+    // Inf means no byte limit
+    if (qbytes > 0) {
+        CppOptions.max_queue_bytes = std::isinf(qbytes) ? 0 : static_cast<size_t>(qbytes);
+    }
+}
+
+void RingBufferSpanProcessorProxy::setScheduledDelay(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> delay_mda = context.inputs[0];
+    double delay = delay_mda[0];
+    if (delay > 0) {
+        CppOptions.schedule_delay_millis = std::chrono::milliseconds(static_cast<int64_t>(delay));
+    }
+}
+
+void RingBufferSpanProcessorProxy::setMaximumExportBatchSize(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> batchsize_mda = context.inputs[0];
+    double batchsize = batchsize_mda[0];
+    if (batchsize > 0) {
+        CppOptions.max_export_batch_size = static_cast<size_t>(batchsize);
+    }
+}
+
+void RingBufferSpanProcessorProxy::setFullQueuePolicy(libmexclass::proxy::method::Context& context) {
+    matlab::data::StringArray policy_mda = context.inputs[0];
+    std::string policy = static_cast<std::string>(policy_mda[0]);
+    if (policy == "dropnewest") {
+        CppOptions.full_queue_policy = FullQueuePolicy::DropNewest;
+    } else if (policy == "dropoldest") {
+        CppOptions.full_queue_policy = FullQueuePolicy::DropOldest;
+    } else if (policy == "block") {
+        CppOptions.full_queue_policy = FullQueuePolicy::Block;
+    }
+}
+
+void RingBufferSpanProcessorProxy::setBlockTimeout(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<double> timeout_mda = context.inputs[0];
+    double timeout = timeout_mda[0];
+    if (timeout >= 0) {
+        CppOptions.block_timeout_millis = std::chrono::milliseconds(static_cast<int64_t>(timeout));
+    }
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,55 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/SpanDataReplay.h"
+#include "opentelemetry-matlab/sdk/common/AttributeValueView.h"
+
+#include "opentelemetry/common/key_value_iterable_view.h"
+
+#include <utility>
+#include <vector>
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+using AttributeList = std::vector<std::pair<nostd::string_view, common::AttributeValue> >;
+
+template <typename OwnedAttributeMap>
+AttributeList viewAttributes(const OwnedAttributeMap& attrs, AttributeValueView& view) {
+    AttributeList result;
+    result.reserve(attrs.size());
+    for (const auto& kv : attrs) {
+        result.emplace_back(kv.first, view(kv.second));
+    }
+    return result;
+}
+} // namespace
+
+void replaySpanData(const trace_sdk::SpanData& source, trace_sdk::Recordable& target) {
+    AttributeValueView view;
+
+    target.SetIdentity(source.GetSpanContext(), source.GetParentSpanId());
+    target.SetTraceFlags(source.GetFlags());
+    target.SetName(source.GetName());
+    target.SetSpanKind(source.GetSpanKind());
+    target.SetStatus(source.GetStatus(), source.GetDescription());
+    target.SetStartTime(source.GetStartTime());
+    target.SetDuration(source.GetDuration());
+    target.SetResource(source.GetResource());
+    target.SetInstrumentationScope(source.GetInstrumentationScope());
+
+    for (const auto& kv : source.GetAttributes()) {
+        target.SetAttribute(kv.first, view(kv.second));
+    }
+
+    for (const auto& event : source.GetEvents()) {
+        AttributeList eventattrs = viewAttributes(event.GetAttributes(), view);
+        target.AddEvent(event.GetName(), event.GetTimestamp(),
+                common::KeyValueIterableView<AttributeList>(eventattrs));
+    }
+
+    for (const auto& link : source.GetLinks()) {
+        AttributeList linkattrs = viewAttributes(link.GetAttributes(), view);
+        target.AddLink(link.GetSpanContext(), common::KeyValueIterableView<AttributeList>(linkattrs));
+    }
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,34 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/SpanProcessorProxy.h"
+#include "opentelemetry-matlab/sdk/trace/StatsSpanProcessor.h"
+#include "opentelemetry-matlab/metrics/MeterProviderProxy.h"
+
+namespace libmexclass::opentelemetry::sdk {
+SpanProcessorProxy::SpanProcessorProxy(std::shared_ptr<SpanExporterProxy> exporter, const std::string& component)
+	: SpanExporter(exporter), Stats(std::make_shared<PipelineStats>("traces", component)) {
+    REGISTER_METHOD(SpanProcessorProxy, getStats);
+    REGISTER_METHOD(SpanProcessorProxy, publishStats);
+}
+
+std::unique_ptr<trace_sdk::SpanExporter> SpanProcessorProxy::wrapExporter(std::unique_ptr<trace_sdk::SpanExporter>&& exporter) {
+    return std::unique_ptr<trace_sdk::SpanExporter>(new StatsSpanExporter(std::move(exporter), Stats));
+}
+
+std::unique_ptr<trace_sdk::SpanProcessor> SpanProcessorProxy::wrapProcessor(std::unique_ptr<trace_sdk::SpanProcessor>&& processor,
+		bool countrejected) {
+    return std::unique_ptr<trace_sdk::SpanProcessor>(new StatsSpanProcessor(std::move(processor), Stats, countrejected));
+}
+
+void SpanProcessorProxy::getStats(libmexclass::proxy::method::Context& context) {
+    context.outputs[0] = Stats->toStruct();
+}
+
+void SpanProcessorProxy::publishStats(libmexclass::proxy::method::Context& context) {
+    matlab::data::TypedArray<uint64_t> mpid_mda = context.inputs[0];
+    libmexclass::proxy::ID mpid = mpid_mda[0];
+    auto mp = std::static_pointer_cast<libmexclass::opentelemetry::MeterProviderProxy>(
+        libmexclass::proxy::ProxyManager::getProxy(mpid))->getInstance();
+    Stats->publish(mp->GetMeter("opentelemetry-matlab"));
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,58 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/SpoolSpanExporter.h"
+#include "opentelemetry-matlab/sdk/trace/TraceRequestReplay.h"
+
+#include "opentelemetry/exporters/otlp/otlp_recordable.h"
+#include "opentelemetry/exporters/otlp/otlp_recordable_utils.h"
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+SpoolSpanExporter::SpoolSpanExporter(std::unique_ptr<trace_sdk::SpanExporter>&& exporter, const SpoolOptions& options)
+        : Exporter(std::move(exporter)),
+          Forwarder(options, [this](const std::string& request) { return deliver(request); }) {}
+
+std::unique_ptr<trace_sdk::Recordable> SpoolSpanExporter::MakeRecordable() noexcept {
+    return std::unique_ptr<trace_sdk::Recordable>(new otlp_exporter::OtlpRecordable());
+}
+
+common_sdk::ExportResult SpoolSpanExporter::Export(
+                const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    if (IsShutdown.load()) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    if (spans.empty()) {
+        return common_sdk::ExportResult::kSuccess;
+    }
+    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+    otlp_exporter::OtlpRecordableUtils::PopulateRequest(spans, &request);
+    std::string serialized;
+    if (!request.SerializeToString(&serialized) || !Forwarder.submit(serialized)) {
+        return common_sdk::ExportResult::kFailure;
+    }
+    return common_sdk::ExportResult::kSuccess;
+}
+
+DeliveryResult SpoolSpanExporter::deliver(const std::string& serialized) {
+    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+    if (!request.ParseFromString(serialized)) {
+        return DeliveryResult::Rejected;   // unreadable, discard rather than retry forever
+    }
+    return toDeliveryResult(exportTraceRequest(request, *Exporter));
+}
+
+bool SpoolSpanExporter::ForceFlush(std::chrono::microseconds timeout) noexcept {
+    bool drained = Forwarder.drain(timeout);
+    return Exporter->ForceFlush(timeout) && drained;
+}
+
+bool SpoolSpanExporter::Shutdown(std::chrono::microseconds timeout) noexcept {
+    IsShutdown.store(true);
+    // make one last attempt, anything left stays on disk for the next session
+    Forwarder.drain(timeout);
+    Forwarder.stop();
+    return Exporter->Shutdown(timeout);
+}
+} // namespace libmexclass::opentelemetry::sdk
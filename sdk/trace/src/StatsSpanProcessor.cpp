@@ -0,0 +1,18 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/StatsSpanProcessor.h"
+
+#include "opentelemetry/sdk/common/exporter_utils.h"
+
+namespace common_sdk = opentelemetry::sdk::common;
+
+namespace libmexclass::opentelemetry::sdk {
+common_sdk::ExportResult StatsSpanExporter::Export(
+		const nostd::span<std::unique_ptr<trace_sdk::Recordable> >& spans) noexcept {
+    auto start = std::chrono::steady_clock::now();
+    common_sdk::ExportResult result = Exporter->Export(spans);
+    Stats->recordExport(spans.size(), result == common_sdk::ExportResult::kSuccess,
+		    std::chrono::steady_clock::now() - start);
+    return result;
+}
+} // namespace libmexclass::opentelemetry
@@ -0,0 +1,80 @@
+// Copyright 2026 The MathWorks, Inc.
+
+#include "opentelemetry-matlab/sdk/trace/TraceRequestReplay.h"
+#include "opentelemetry-matlab/sdk/common/ProtoConversion.h"
+
+#include "opentelemetry/trace/span_context.h"
+#include "opentelemetry/trace/trace_state.h"
+
+#include <vector>
+
+namespace trace_api = opentelemetry::trace;
+namespace common_sdk = opentelemetry::sdk::common;
+namespace trace_proto = ::opentelemetry::proto::trace::v1;
+
+namespace libmexclass::opentelemetry::sdk {
+
+namespace {
+trace_api::SpanContext makeSpanContext(const std::string& traceid, const std::string& spanid, uint32_t flags,
+		const std::string& tracestate) {
+    return trace_api::SpanContext(traceIdFromBytes(traceid), spanIdFromBytes(spanid),
+		    trace_api::TraceFlags(static_cast<uint8_t>(flags & 0xFF)), false,
+		    trace_api::TraceState::FromHeader(tracestate));
+}
+
+common::SystemTimestamp toTimestamp(uint64_t nanoseconds) {
+    return common::SystemTimestamp(std::chrono::nanoseconds(nanoseconds));
+}
+
+void replaySpan(const trace_proto::Span& span, trace_sdk::Recordable& target) {
+    trace_api::SpanContext context = makeSpanContext(span.trace_id(), span.span_id(), span.flags(), span.trace_state());
+    target.SetIdentity(context, spanIdFromBytes(span.parent_span_id()));
+    target.SetTraceFlags(context.trace_flags());
+    target.SetName(span.name());
+    // OTLP numbers span kinds from 1, after SPAN_KIND_UNSPECIFIED
+    int kind = span.kind() > 0 ? static_cast<int>(span.kind()) - 1 : 0;
+    target.SetSpanKind(static_cast<trace_api::SpanKind>(kind));
+    target.SetStatus(static_cast<trace_api::StatusCode>(span.status().code()), span.status().message());
+    target.SetStartTime(toTimestamp(span.start_time_unix_nano()));
+    target.SetDuration(std::chrono::nanoseconds(span.end_time_unix_nano() - span.start_time_unix_nano()));
+
+    ProtoAttributeList attrs(span.attributes());
+    for (const auto& [key, value] : attrs.entries()) {
+        target.SetAttribute(key, value);
+    }
+    for (const auto& event : span.events()) {
+        ProtoAttributeList eventattrs(event.attributes());
+        target.AddEvent(event.name(), toTimestamp(event.time_unix_nano()), eventattrs.view());
+    }
+    for (const auto& link : span.links()) {
+        ProtoAttributeList linkattrs(link.attributes());
+        target.AddLink(makeSpanContext(link.trace_id(), link.span_id(), link.flags(), link.trace_state()),
+			linkattrs.view());
+    }
+}
+} // namespace
+
+common_sdk::ExportResult exportTraceRequest(
+		const ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
+		trace_sdk::SpanExporter& exporter) {
+    // resources and scopes are referenced by the recordables until the export completes
+    std::vector<std::unique_ptr<resource::Resource> > resources;
+    std::vector<std::unique_ptr<instrumentationscope::InstrumentationScope> > scopes;
+    std::vector<std::unique_ptr<trace_sdk::Recordable> > recordables;
+    for (const auto& resourcespans : request.resource_spans()) {
+        resources.push_back(makeResource(resourcespans.resource(), resourcespans.schema_url()));
+        for (const auto& scopespans : resourcespans.scope_spans()) {
+            scopes.push_back(makeInstrumentationScope(scopespans.scope(), scopespans.schema_url()));
+            for (const auto& span : scopespans.spans()) {
+                std::unique_ptr<trace_sdk::Recordable> recordable = exporter.MakeRecordable();
+                recordable->SetResource(*resources.back());
+                recordable->SetInstrumentationScope(*scopes.back());
+                replaySpan(span, *recordable);
+                recordables.push_back(std::move(recordable));
+            }
+        }
+    }
+    return exporter.Export(nostd::span<std::unique_ptr<trace_sdk::Recordable> >(recordables.data(),
+			    recordables.size()));
+}
+} // namespace libmexclass::opentelemetry
@@ -1,10 +1,11 @@
-// Copyright 2023-2024 The MathWorks, Inc.
+// Copyright 2023-2026 The MathWorks, Inc.
 
 #include "opentelemetry-matlab/sdk/trace/TracerProviderProxy.h"
 #include "opentelemetry-matlab/sdk/trace/SpanProcessorProxy.h"
 #include "opentelemetry-matlab/sdk/trace/SamplerProxy.h"
 #include "opentelemetry-matlab/sdk/common/resource.h"
 #include "opentelemetry-matlab/common/attribute.h"
+#include "opentelemetry-matlab/trace/SpanLimits.h"
 
 #include "libmexclass/proxy/ProxyManager.h"
 
@@ -16,6 +17,10 @@
 #include "opentelemetry/common/key_value_iterable_view.h"
 #include "opentelemetry/nostd/shared_ptr.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace trace_api = opentelemetry::trace;
 namespace trace_sdk = opentelemetry::sdk::trace;
 namespace resource = opentelemetry::sdk::resource;
@@ -58,11 +63,18 @@ libmexclass::proxy::MakeResult TracerProviderProxy::make(const libmexclass::prox
 		       resource_custom, std::move(sampler));
        nostd::shared_ptr<trace_sdk::TracerProvider> p_sdk_shared(std::move(p_sdk));
        nostd::shared_ptr<trace_api::TracerProvider> p_api_shared(std::move(p_sdk_shared));
+       // a new provider may reuse the address of a deleted one
+       SpanLimitsRegistry::erase(p_api_shared.get());
        out = std::make_shared<TracerProviderProxy>(p_api_shared);
     }
     return out;
 }
 
+TracerProviderProxy::~TracerProviderProxy() {
+    // limits are keyed by provider address, which a later provider may reuse
+    SpanLimitsRegistry::erase(CppTracerProvider.get());
+}
+
 void TracerProviderProxy::addSpanProcessor(libmexclass::proxy::method::Context& context) {
     matlab::data::TypedArray<uint64_t> processorid_mda = context.inputs[0];
     libmexclass::proxy::ID processorid = processorid_mda[0];
@@ -76,6 +88,7 @@ void TracerProviderProxy::shutdown(libmexclass::proxy::method::Context& context)
     matlab::data::ArrayFactory factory;
     auto result_mda = factory.createScalar(static_cast<trace_sdk::TracerProvider&>(*CppTracerProvider).Shutdown());
     context.outputs[0] = result_mda;
+    SpanLimitsRegistry::erase(CppTracerProvider.get());
     nostd::shared_ptr<trace_api::TracerProvider> noop(new trace_api::NoopTracerProvider);
     CppTracerProvider.swap(noop);
 }
@@ -92,4 +105,28 @@ void TracerProviderProxy::forceFlush(libmexclass::proxy::method::Context& contex
     }
 }
 
+void TracerProviderProxy::setSpanLimits(libmexclass::proxy::method::Context& context) {
+    // inputs are maximum attributes, events, links, attribute value length, bytes, and the array
+    // summary threshold. Inf means unlimited.
+    std::array<size_t, 6> values;
+    for (size_t i = 0; i < values.size(); ++i) {
+        matlab::data::TypedArray<double> value_mda = context.inputs[i];
+        double value = value_mda[0];
+        values[i] = std::isinf(value) ? AttributeLimits::Unlimited : static_cast<size_t>(value);
+    }
+    if (std::all_of(values.begin(), values.end(), [](size_t v) {return v == AttributeLimits::Unlimited;})) {
+        SpanLimitsRegistry::erase(CppTracerProvider.get());
+        return;
+    }
+    auto limits = std::make_shared<SpanLimits>();
+    limits->MaxAttributes = values[0];
+    limits->MaxEvents = values[1];
+    limits->MaxLinks = values[2];
+    limits->MaxAttributeValueLength = values[3];
+    limits->MaxBytes = values[4];
+    limits->ArraySummaryThreshold = values[5];
+    // spans started from existing Tracer objects are not affected
+    SpanLimitsRegistry::set(CppTracerProvider.get(), std::move(limits));
+}
+
 } // namespace libmexclass::opentelemetry
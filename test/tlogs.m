@@ -1,7 +1,7 @@
 classdef tlogs < matlab.unittest.TestCase
     % tests for logs
 
-    % Copyright 2024-2025 The MathWorks, Inc.
+    % Copyright 2024-2026 The MathWorks, Inc.
 
     properties
         OtelConfigFile
@@ -483,5 +483,31 @@ classdef tlogs < matlab.unittest.TestCase
             verifyNotEmpty(testCase, idx);
             verifyEqual(testCase, results{1}.resourceLogs.resource.attributes(idx).value.doubleValue, customvalue);
         end
+
+        function testGzipCompression(testCase)
+            % testGzipCompression: compress HTTP log export requests with gzip
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpLogRecordExporter", "class")), ...
+                "Otlp HTTP exporter must be installed.");
+
+            loggername = "foo";
+            logmessage = "bar";
+
+            exp = opentelemetry.exporters.otlp.OtlpHttpLogRecordExporter(...
+                "Compression", "gzip");
+            verifyEqual(testCase, exp.Compression, "gzip");
+            lp = opentelemetry.sdk.logs.LoggerProvider(...
+                opentelemetry.sdk.logs.SimpleLogRecordProcessor(exp));
+            lg = getLogger(lp, loggername);
+            emitLogRecord(lg, "info", logmessage);
+
+            % perform test comparisons
+            forceFlush(lp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 1);
+            results = results{1};
+            verifyEqual(testCase, string(results.resourceLogs.scopeLogs.scope.name), loggername);
+            verifyEqual(testCase, string(results.resourceLogs.scopeLogs.logRecords.body.stringValue), logmessage);
+        end
     end
 end
\ No newline at end of file
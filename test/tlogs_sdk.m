@@ -77,6 +77,35 @@ classdef tlogs_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, string(results.resourceLogs.scopeLogs.logRecords.body.stringValue), logmessage);
         end
 
+        function testParquetExporter(testCase)
+            % testParquetExporter: write log records to a Parquet file and
+            % read them back as a table
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.parquet.ParquetLogRecordExporter", "class")), ...
+                "Parquet exporter must be installed.");
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+            filename = fullfile(folderfixture.Folder, "logs.parquet");
+            exp = opentelemetry.exporters.parquet.ParquetLogRecordExporter(...
+                FileName=filename);
+
+            lp = opentelemetry.sdk.logs.LoggerProvider(...
+                opentelemetry.sdk.logs.SimpleLogRecordProcessor(exp));
+            lg = getLogger(lp, "foo");
+            emitLogRecord(lg, "debug", "bar");
+            emitLogRecord(lg, "error", "baz");
+            shutdown(lp);
+            clear("lg", "lp");
+
+            % perform test comparisons
+            T = parquetread(filename);
+            verifyEqual(testCase, string(T.body), ["bar"; "baz"]);
+            verifyEqual(testCase, string(T.severity_text), ["DEBUG"; "ERROR"]);
+            verifyEqual(testCase, double(T.severity_number), [5; 17]);
+            verifyEqual(testCase, unique(string(T.scope_name)), "foo");
+        end
+
         function testHttpExporter(testCase)
             testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpLogRecordExporter", "class")), ...
                 "Otlp HTTP Log record exporter must be installed.");
@@ -160,6 +189,66 @@ classdef tlogs_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, string(results.resourceLogs.scopeLogs.logRecords.body.stringValue), logbody);
         end
 
+        function testRingBufferLogRecordProcessor(testCase)
+            % testRingBufferLogRecordProcessor: setting properties of
+            % RingBufferLogRecordProcessor
+            loggername = "foo";
+            logseverity = "info";
+            logbody = "bar";
+            queuesize = 500;
+            queuebytes = 1e6;
+            policy = "dropoldest";
+            b = opentelemetry.sdk.logs.RingBufferLogRecordProcessor;
+            b.MaximumQueueSize = queuesize;
+            b.MaximumQueueBytes = queuebytes;
+            b.FullQueuePolicy = policy;
+
+            % verify properties modified successfully
+            verifyEqual(testCase, b.MaximumQueueSize, queuesize);
+            verifyEqual(testCase, b.MaximumQueueBytes, queuebytes);
+            verifyEqual(testCase, b.FullQueuePolicy, policy);
+
+            p = opentelemetry.sdk.logs.LoggerProvider(b);
+            lg = p.getLogger(loggername);
+            lg.emitLogRecord(logseverity, logbody);
+
+            % verify log body and severity
+            forceFlush(p, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            results = results{1};
+            verifyEqual(testCase, string(results.resourceLogs.scopeLogs.scope.name), loggername);
+            verifyEqual(testCase, string(results.resourceLogs.scopeLogs.logRecords.severityText), upper(logseverity));
+            verifyEqual(testCase, string(results.resourceLogs.scopeLogs.logRecords.body.stringValue), logbody);
+        end
+
+        function testFlightRecorderLogRecordProcessor(testCase)
+            % testFlightRecorderLogRecordProcessor: log records are only
+            % exported when dumped or when a log record has the trigger
+            % severity
+            loggername = "foo";
+            b = opentelemetry.sdk.logs.FlightRecorderLogRecordProcessor(...
+                TriggerSeverity="error");
+            verifyEqual(testCase, b.TriggerSeverity, "error");
+
+            p = opentelemetry.sdk.logs.LoggerProvider(b);
+            lg = p.getLogger(loggername);
+            lg.emitLogRecord("info", "bar");
+            lg.emitLogRecord("warn", "baz");
+            forceFlush(p, testCase.ForceFlushTimeout);
+
+            % an error log record dumps the buffer
+            lg.emitLogRecord("error", "quux");
+            clear("lg", "p");
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 1);
+            logrecords = results{1}.resourceLogs.scopeLogs.logRecords;
+            verifyEqual(testCase, string(results{1}.resourceLogs.scopeLogs.scope.name), loggername);
+            verifyEqual(testCase, string(arrayfun(@(r)r.body.stringValue, logrecords, UniformOutput=false)), ...
+                ["bar"; "baz"; "quux"]);
+        end
+
         function testCustomResource(testCase)
             % testCustomResource: check custom resources are included in
             % emitted log record
@@ -1,7 +1,7 @@
 classdef tmetrics < matlab.unittest.TestCase
     % tests for metrics
 
-    % Copyright 2023-2025 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     properties
         OtelConfigFile
@@ -93,6 +93,37 @@ classdef tmetrics < matlab.unittest.TestCase
 
         end
 
+        function testGzipCompression(testCase)
+            % testGzipCompression: compress HTTP metric export requests with gzip
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpMetricExporter", "class")), ...
+                "Otlp HTTP exporter must be installed.");
+
+            metername = "foo";
+            countername = "bar";
+            val = 5;
+
+            exp = opentelemetry.exporters.otlp.OtlpHttpMetricExporter(...
+                "Compression", "gzip");
+            verifyEqual(testCase, exp.Compression, "gzip");
+            reader = opentelemetry.sdk.metrics.PeriodicExportingMetricReader(exp, ...
+                "Interval", seconds(2), "Timeout", seconds(1));
+            p = opentelemetry.sdk.metrics.MeterProvider(reader);
+            ct = createCounter(getMeter(p, metername), countername);
+            add(ct, val);
+
+            % wait for collector response
+            pause(testCase.WaitTime);
+
+            % fetch result
+            clear p;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            verifyEqual(testCase, string(results.resourceMetrics.scopeMetrics.metrics.name), countername);
+            verifyEqual(testCase, results.resourceMetrics.scopeMetrics.metrics.sum.dataPoints.asDouble, val);
+        end
+
         function testCounterDelta(testCase)
             metername = "foo";
             countername = "bar";
@@ -200,6 +231,61 @@ classdef tmetrics < matlab.unittest.TestCase
         end
 
 
+        function testCoalescingCounter(testCase)
+            % test that coalescing counter sums increments per attribute
+            % set and flushes exact totals before collection
+            p = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader);
+            mt = p.getMeter("foo");
+            ct = mt.createCounter("bar");
+            cc = opentelemetry.metrics.CoalescingCounter(ct, ...
+                FlushCount=1000, FlushInterval=hours(1));
+            verifyEqual(testCase, cc.FlushCount, 1000);
+
+            % fewer adds than FlushCount, so nothing is flushed yet
+            vals = 1:500;
+            for i = vals
+                if mod(i, 2) == 1
+                    cc.add(i, "k", "odd");
+                else
+                    cc.add(i, dictionary("k", "even"));
+                end
+            end
+            cc.add(-1, "k", "odd");   % ignored by counters
+
+            % force flush includes the coalesced sums
+            verifyTrue(testCase, p.forceFlush());
+            clear p;
+            results = readJsonResults(testCase);
+            dp = results{end}.resourceMetrics.scopeMetrics.metrics.sum.dataPoints;
+            verifyNumElements(testCase, dp, 2);
+            attrvalues = arrayfun(@(x)string(x.attributes.value.stringValue), dp);
+            verifyEqual(testCase, dp(attrvalues == "odd").asDouble, sum(vals(1:2:end)));
+            verifyEqual(testCase, dp(attrvalues == "even").asDouble, sum(vals(2:2:end)));
+        end
+
+        function testCoalescingCounterNaNAttribute(testCase)
+            % test that increments with a NaN attribute value are summed
+            % into a single attribute set
+            p = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader);
+            mt = p.getMeter("foo");
+            ct = mt.createCounter("bar");
+            cc = opentelemetry.metrics.CoalescingCounter(ct, ...
+                FlushCount=1000, FlushInterval=hours(1));
+
+            n = 100;
+            for i = 1:n
+                cc.add(1, "ratio", NaN);
+                cc.add(2, dictionary("ratio", NaN));
+            end
+
+            verifyTrue(testCase, p.forceFlush());
+            clear p;
+            results = readJsonResults(testCase);
+            dp = results{end}.resourceMetrics.scopeMetrics.metrics.sum.dataPoints;
+            verifyNumElements(testCase, dp, 1);
+            verifyEqual(testCase, dp.asDouble, 3*n);
+        end
+
         function testUpDownCounterBasic(testCase)
             % test names and added value in UpDownCounter
 
@@ -405,6 +491,68 @@ classdef tmetrics < matlab.unittest.TestCase
             verifyEqual(testCase, str2double(counts{len}), sum(vals>bounds(len-1)));
         end
 
+        function testHistogramRecordDistribution(testCase)
+            % record an array of values in one call
+            p = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader);
+            mt = p.getMeter("foo");
+            hist = mt.createHistogram("bar");
+
+            vals = [1 5; 8.1 20; 300 7];
+            hist.recordDistribution(vals, "k1", "v1");
+            hist.recordDistribution(single([2 4]), "k1", "v1");
+            vals = [vals(:); 2; 4];
+
+            % wait for collector response
+            pause(testCase.WaitTime);
+
+            % fetch results
+            clear p;
+            results = readJsonResults(testCase);
+            results = results{end};
+            dp = results.resourceMetrics.scopeMetrics.metrics.histogram.dataPoints;
+
+            % verify statistics
+            verifyEqual(testCase, dp.count, num2str(numel(vals)));
+            verifyEqual(testCase, dp.min, min(vals));
+            verifyEqual(testCase, dp.max, max(vals));
+            verifyEqual(testCase, dp.sum, sum(vals), "AbsTol", 1e-10);
+            verifyEqual(testCase, string(dp.attributes.value.stringValue), "v1");
+        end
+
+        function testHistogramRecordDistributionBuckets(testCase)
+            % bucket counts of a large array recorded in one call
+            p = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader);
+            mt = p.getMeter("foo");
+            hist = mt.createHistogram("bar");
+
+            % include values equal to the default bucket boundaries
+            rng(1);
+            vals = [12000*rand(1e5,1); 0; 5; 10; 1000; 10000];
+            hist.recordDistribution(vals);
+
+            % wait for collector response
+            pause(testCase.WaitTime);
+
+            % fetch results
+            clear p;
+            results = readJsonResults(testCase);
+            results = results{end};
+            dp = results.resourceMetrics.scopeMetrics.metrics.histogram.dataPoints;
+            bounds = dp.explicitBounds;
+            counts = str2double(string(dp.bucketCounts));
+
+            % verify count in each bucket
+            verifyEqual(testCase, dp.count, num2str(numel(vals)));
+            verifyLength(testCase, counts, numel(bounds) + 1);
+            % buckets include their upper bound
+            edges = [-Inf; bounds(:); Inf];
+            expected = arrayfun(@(i)nnz(vals > edges(i) & vals <= edges(i+1)), 1:numel(edges)-1);
+            verifyEqual(testCase, counts(:), expected(:));
+            verifyEqual(testCase, dp.min, min(vals));
+            verifyEqual(testCase, dp.max, max(vals));
+            verifyEqual(testCase, dp.sum, sum(vals), "RelTol", 1e-12);
+        end
+
         function testHistogramInvalidValue(testCase)
             % add invalid values to Histogram
             p = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader);
@@ -330,6 +330,248 @@ classdef tmetrics_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, dp.bucketCounts, expected_buckets);
         end
 
+        function testViewExponentialHistogram(testCase)
+            % testViewExponentialHistogram: use exponential histogram aggregation
+            mp = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader); 
+            
+            meter_name = "mymeter";
+            histogram_name = "myhistogram";
+            view = opentelemetry.sdk.metrics.View(InstrumentName=histogram_name, ...
+                InstrumentType="Histogram", Aggregation="exponentialhistogram", ...
+                ExponentialHistogramMaxScale=1, ExponentialHistogramMaxSize=20);
+            verifyEqual(testCase, view.ExponentialHistogramMaxScale, 1);
+            verifyEqual(testCase, view.ExponentialHistogramMaxSize, 20);
+            
+            addView(mp, view);
+            
+            m = mp.getMeter(meter_name);
+            hist = m.createHistogram(histogram_name);
+            
+            % record values
+            hist.record(1);
+            hist.record(2);
+            hist.record(4);
+            hist.record(8);
+            
+            % wait for collector response
+            pause(testCase.WaitTime);
+            
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            % fetch datapoint
+            dp = results.resourceMetrics.scopeMetrics.metrics.exponentialHistogram.dataPoints;
+
+            % verify count and sum
+            verifyEqual(testCase, dp.count, '4');
+            verifyEqual(testCase, dp.sum, 15);
+
+            % at scale 1, bucket i holds values in (2^(i/2), 2^((i+1)/2)]
+            verifyEqual(testCase, dp.scale, 1);
+            verifyEqual(testCase, dp.positive.offset, -1);
+            verifyEqual(testCase, dp.positive.bucketCounts, {'1'; '0'; '1'; '0'; '1'; '0'; '1'});
+        end
+
+        function testViewQuantile(testCase)
+            % testViewQuantile: estimate quantiles from quantile aggregation
+            mp = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader); 
+            
+            histogram_name = "latency";
+            relerr = 0.01;
+            view = opentelemetry.sdk.metrics.View(InstrumentName=histogram_name, ...
+                InstrumentType="Histogram", Aggregation="quantile", ...
+                QuantileRelativeError=relerr);
+            addView(mp, view);
+            
+            m = mp.getMeter("mymeter");
+            hist = m.createHistogram(histogram_name);
+            
+            values = 1:1000;
+            for v = values
+                hist.record(v);
+            end
+            
+            % wait for collector response
+            pause(testCase.WaitTime);
+            
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            dp = results.resourceMetrics.scopeMetrics.metrics.exponentialHistogram.dataPoints;
+            verifyEqual(testCase, dp.count, '1000');
+
+            % smallest scale whose buckets meet the relative error
+            verifyEqual(testCase, dp.scale, 6);
+
+            % estimate quantiles by the harmonic mean of bucket boundaries
+            base = 2^(2^-dp.scale);
+            counts = cumsum(str2double(dp.positive.bucketCounts));
+            for q = [0.5 0.99 0.999]
+                truevalue = values(ceil(q*numel(values)));
+                k = find(counts >= ceil(q*numel(values)), 1);
+                lower = base^(dp.positive.offset + k - 1);
+                upper = lower * base;
+                estimate = 2*lower*upper/(lower+upper);
+                verifyLessThanOrEqual(testCase, abs(estimate - truevalue) / truevalue, relerr);
+            end
+        end
+
+        function testExemplar(testCase)
+            % testExemplar: measurements made within a sampled span are
+            % recorded as exemplars
+            try
+                mp = opentelemetry.sdk.metrics.MeterProvider(testCase.ShortIntervalReader, ...
+                    ExemplarFilter="traceBased"); 
+            catch me
+                testCase.assumeNotEqual(string(me.identifier), ...
+                    "opentelemetry:sdk:metrics:MeterProvider:ExemplarNotSupported", ...
+                    "Exemplars are not supported by this build.");
+                rethrow(me);
+            end
+            verifyEqual(testCase, mp.ExemplarFilter, "traceBased");
+            m = mp.getMeter("mymeter");
+            hist = m.createHistogram("latency");
+
+            % span is kept open so that only metrics are exported
+            tp = opentelemetry.sdk.trace.TracerProvider();
+            tr = getTracer(tp, "tracer");
+            sp = startSpan(tr, "request");
+            scope = makeCurrent(sp); %#ok<NASGU>
+            hist.record(42);
+            clear("scope");
+            
+            % wait for collector response
+            pause(testCase.WaitTime);
+            
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            dp = results.resourceMetrics.scopeMetrics.metrics.histogram.dataPoints;
+            verifyNotEmpty(testCase, dp.exemplars);
+            exemplar = dp.exemplars(1);
+            verifyEqual(testCase, exemplar.asDouble, 42);
+            sc = getSpanContext(sp);
+            verifyEqual(testCase, string(exemplar.traceId), sc.TraceId);
+            verifyEqual(testCase, string(exemplar.spanId), sc.SpanId);
+        end
+
+        function testManualMetricReader(testCase)
+            % testManualMetricReader: metrics are collected and exported
+            % only when collect is called
+            exporter = opentelemetry.exporters.otlp.defaultMetricExporter;
+            reader = opentelemetry.sdk.metrics.ManualMetricReader(exporter);
+            mp = opentelemetry.sdk.metrics.MeterProvider(reader);
+            m = mp.getMeter("mymeter");
+            c = m.createCounter("steps");
+            h = m.createHistogram("duration");
+
+            c.add(3, "solver", "ode45");
+            h.record(0.5);
+            h.record(2);
+            [success, data] = collect(reader);
+            verifyTrue(testCase, success);
+            verifyEqual(testCase, numel(data.Name), 2);
+            row = find(data.Name == "steps");
+            verifyEqual(testCase, data.Type(row), "sum");
+            verifyEqual(testCase, data.Value(row), 3);
+            verifyEqual(testCase, data.Attributes{row}("solver"), {"ode45"});
+            row = find(data.Name == "duration");
+            verifyEqual(testCase, data.Type(row), "histogram");
+            verifyEqual(testCase, [data.Count(row) data.Sum(row)], [2 2.5]);
+            verifyEqual(testCase, numel(data.BucketCounts{row}), numel(data.BucketBounds{row}) + 1);
+
+            % a second collection is exported with the cumulative value
+            c.add(4, "solver", "ode45");
+            verifyTrue(testCase, collect(reader));
+
+            pause(testCase.WaitTime);
+            clear mp;
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 2);
+            metrics = results{end}.resourceMetrics.scopeMetrics.metrics;
+            if ~iscell(metrics)
+                metrics = num2cell(metrics);
+            end
+            names = cellfun(@(x)string(x.name), metrics);
+            sums = metrics{names == "steps"};
+            verifyEqual(testCase, sums.sum.dataPoints.asDouble, 7);
+        end
+
+        function testFanoutMetricReader(testCase)
+            % testFanoutMetricReader: one reader exports to several
+            % exporters with different intervals and temporality
+            exporter1 = opentelemetry.exporters.otlp.defaultMetricExporter;
+            exporter2 = opentelemetry.exporters.otlp.defaultMetricExporter(...
+                "PreferredAggregationTemporality", "delta");
+            reader = opentelemetry.sdk.metrics.FanoutMetricReader(exporter1, ...
+                seconds(1), exporter2, seconds(2));
+            verifyEqual(testCase, reader.Interval, seconds([1 2]));
+            mp = opentelemetry.sdk.metrics.MeterProvider(reader);
+            c = mp.getMeter("mymeter").createCounter("mycounter");
+
+            c.add(5);
+            pause(seconds(2.5));
+            c.add(3);
+            clear mp;   % exports to both exporters at shutdown
+
+            results = readJsonResults(testCase);
+            cumulative = [];
+            delta = [];
+            for i = 1:numel(results)
+                sums = results{i}.resourceMetrics.scopeMetrics.metrics.sum;
+                if sums.aggregationTemporality == 1   % delta
+                    delta(end+1) = sums.dataPoints.asDouble; %#ok<AGROW>
+                else
+                    cumulative(end+1) = sums.dataPoints.asDouble; %#ok<AGROW>
+                end
+            end
+            % the faster exporter exports more often
+            verifyGreaterThan(testCase, numel(cumulative), numel(delta));
+            verifyEqual(testCase, cumulative(end), 8);
+            verifyEqual(testCase, sum(delta), 8);
+        end
+
+        function testPrometheusExporter(testCase)
+            % testPrometheusExporter: scrape metrics from the local
+            % Prometheus endpoint
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.prometheus.PrometheusExporter", "class")), ...
+                "Prometheus exporter must be installed.");
+
+            reader = opentelemetry.exporters.prometheus.PrometheusExporter(...
+                Host="127.0.0.1", Port=0);   % use any unused port
+            verifyGreaterThan(testCase, reader.Port, 0);
+            mp = opentelemetry.sdk.metrics.MeterProvider(reader);
+            m = mp.getMeter("mymeter");
+            c = m.createCounter("mycounter", "my description");
+            h = m.createHistogram("myhistogram", "", "ms");
+            m2 = mp.getMeter("othermeter", "2.0");
+            c2 = m2.createCounter("mycounter");
+
+            c.add(5, "mykey", "myvalue");
+            c2.add(1, "mykey", "myvalue");
+            h.record(2);
+            url = "http://127.0.0.1:" + reader.Port + "/metrics";
+            text = webread(url, weboptions(ContentType="text"));
+            verifySubstring(testCase, text, "# TYPE mycounter_total counter");
+            verifySubstring(testCase, text, 'mycounter_total{otel_scope_name="mymeter",mykey="myvalue"} 5');
+            verifySubstring(testCase, text, 'myhistogram_milliseconds_count{otel_scope_name="mymeter"} 1');
+
+            % metrics with the same name from another meter are a separate
+            % series of the same family
+            verifySubstring(testCase, text, ...
+                'mycounter_total{otel_scope_name="othermeter",otel_scope_version="2.0",mykey="myvalue"} 1');
+            verifyNumElements(testCase, strfind(text, "# TYPE mycounter_total"), 1);
+
+            % each scrape collects cumulative values
+            c.add(3, "mykey", "myvalue");
+            text = webread(url, weboptions(ContentType="text"));
+            verifySubstring(testCase, text, 'mycounter_total{otel_scope_name="mymeter",mykey="myvalue"} 8');
+        end
+
         function testViewAggregation(testCase)
             % testViewAggregation: change aggregation of metric instruments
             metername = "foo";
@@ -451,6 +693,133 @@ classdef tmetrics_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, dp(roomidx==2).asDouble, sum(values2));
         end
 
+        function testViewCardinalityLimit(testCase)
+            % testViewCardinalityLimit: attribute sets beyond the
+            % cardinality limit go into an overflow series
+            metername = "foo";
+            countername = "bar";
+            cardinalitylimit = 3;
+            view = opentelemetry.sdk.metrics.View(InstrumentType="Counter", ...
+                InstrumentName=countername);
+            mp = opentelemetry.sdk.metrics.MeterProvider(...
+                testCase.ShortIntervalReader, View=view, ...
+                CardinalityLimit=cardinalitylimit); 
+            verifyEqual(testCase, mp.CardinalityLimit, cardinalitylimit);
+
+            m = getMeter(mp, metername);
+            c = createCounter(m, countername);
+            
+            % add values with more distinct attribute sets than the limit
+            nrooms = 6;
+            for i = 1:nrooms
+                add(c, 1, "Room", i);
+            end
+            
+            pause(testCase.WaitTime);
+            
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            % verify the number of series is capped and the total is kept
+            dp = results.resourceMetrics.scopeMetrics.metrics.sum.dataPoints;
+            if isstruct(dp)
+                dp = num2cell(dp);
+            end
+            verifyLength(testCase, dp, cardinalitylimit);
+            verifyEqual(testCase, sum(cellfun(@(x)x.asDouble, dp)), nrooms);
+
+            % verify exactly one series is the overflow series
+            isoverflow = cellfun(@(x)any(string({x.attributes.key}) == "otel.metric.overflow"), dp);
+            verifyEqual(testCase, nnz(isoverflow), 1);
+            overflowattr = dp{isoverflow}.attributes;
+            verifyTrue(testCase, overflowattr(1).value.boolValue);
+        end
+
+        function testViewUnlimitedCardinality(testCase)
+            % testViewUnlimitedCardinality: a view with CardinalityLimit Inf
+            % keeps all attribute sets regardless of the MeterProvider limit
+            metername = "foo";
+            countername = "bar";
+            view = opentelemetry.sdk.metrics.View(InstrumentType="Counter", ...
+                InstrumentName=countername);
+            verifyEmpty(testCase, view.CardinalityLimit);
+            view.CardinalityLimit = Inf;
+            mp = opentelemetry.sdk.metrics.MeterProvider(...
+                testCase.ShortIntervalReader, View=view, CardinalityLimit=3);
+
+            m = getMeter(mp, metername);
+            c = createCounter(m, countername);
+            nrooms = 6;
+            for i = 1:nrooms
+                add(c, 1, "Room", i);
+            end
+
+            pause(testCase.WaitTime);
+
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            % verify every attribute set has its own series
+            dp = results.resourceMetrics.scopeMetrics.metrics.sum.dataPoints;
+            verifyLength(testCase, dp, nrooms);
+        end
+
+        function testViewRewriteAttribute(testCase)
+            % testViewRewriteAttribute: group attribute values into bins
+            % and keep only the first distinct values
+            metername = "foo";
+            countername = "bar";
+            view = opentelemetry.sdk.metrics.View(InstrumentType="Counter", ...
+                InstrumentName=countername);
+            rewriteAttribute(view, "Size", Bins=[0 100]);
+            rewriteAttribute(view, "File", TopN=1, OtherValue="others");
+            mp = opentelemetry.sdk.metrics.MeterProvider(...
+                testCase.ShortIntervalReader, View=view); 
+
+            m = getMeter(mp, metername);
+            c = createCounter(m, countername);
+            
+            add(c, 1, "Size", 5, "File", "a.txt");
+            add(c, 2, "Size", 50, "File", "a.txt");
+            add(c, 4, "Size", 150, "File", "a.txt");
+            add(c, 8, "Size", 20, "File", "b.txt");
+            
+            pause(testCase.WaitTime);
+            
+            clear mp;
+            results = readJsonResults(testCase);
+            results = results{end};
+
+            dp = results.resourceMetrics.scopeMetrics.metrics.sum.dataPoints;
+            if isstruct(dp)
+                dp = num2cell(dp);
+            end
+            verifyLength(testCase, dp, 3);
+            labels = strings(size(dp));
+            for i = 1:numel(dp)
+                attrkeys = string({dp{i}.attributes.key});
+                sizeattr = dp{i}.attributes(attrkeys == "Size");
+                fileattr = dp{i}.attributes(attrkeys == "File");
+                labels(i) = string(sizeattr.value.stringValue) + " " + ...
+                    string(fileattr.value.stringValue);
+            end
+            values = cellfun(@(x)x.asDouble, dp);
+            verifyEqual(testCase, values(labels == "[0,100) a.txt"), 3);
+            verifyEqual(testCase, values(labels == "[100,Inf) a.txt"), 4);
+            verifyEqual(testCase, values(labels == "[0,100) others"), 8);
+        end
+
+        function testViewRewriteAttributeInvalidPattern(testCase)
+            % testViewRewriteAttributeInvalidPattern: a pattern that is
+            % not a valid regular expression is rejected
+            view = opentelemetry.sdk.metrics.View(InstrumentType="Counter");
+            verifyError(testCase, @()rewriteAttribute(view, "File", ...
+                Patterns=["\.txt$" "(unclosed"], Groups=["text" "bad"]), ...
+                "opentelemetry:sdk:metrics:View:InvalidAttributeRewrite");
+        end
+
         function testMultipleViews(testCase)
             % testMultipleView: Applying multiple views to a meter provider
 
@@ -911,5 +911,154 @@ classdef ttrace < matlab.unittest.TestCase
 
             verifyEmpty(testCase, results{1}.resourceSpans.scopeSpans.spans.parentSpanId);
         end
+
+        function testGzipCompression(testCase)
+            % testGzipCompression: compress HTTP export requests with gzip
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpSpanExporter", "class")), ...
+                "Otlp HTTP exporter must be installed.");
+
+            tracername = "foo";
+            spanname = "bar";
+
+            exp = opentelemetry.exporters.otlp.OtlpHttpSpanExporter(...
+                "Compression", "gzip");
+            verifyEqual(testCase, exp.Compression, "gzip");
+            processor = opentelemetry.sdk.trace.SimpleSpanProcessor(exp);
+            tp = opentelemetry.sdk.trace.TracerProvider(processor);
+            tr = getTracer(tp, tracername);
+            sp = startSpan(tr, spanname);
+            pause(1);
+            endSpan(sp);
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            results = results{1};
+
+            % check span and tracer names
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.spans.name), spanname);
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
+        end
+
+        function testGrpcGzipCompression(testCase)
+            % testGrpcGzipCompression: compress gRPC export requests with gzip
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpGrpcSpanExporter", "class")), ...
+                "Otlp gRPC exporter must be installed.");
+
+            tracername = "foo";
+            spanname = "bar";
+
+            exp = opentelemetry.exporters.otlp.OtlpGrpcSpanExporter(...
+                "Compression", "gzip");
+            processor = opentelemetry.sdk.trace.SimpleSpanProcessor(exp);
+            tp = opentelemetry.sdk.trace.TracerProvider(processor);
+            tr = getTracer(tp, tracername);
+            sp = startSpan(tr, spanname);
+            pause(1);
+            endSpan(sp);
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            results = results{1};
+
+            % check span and tracer names
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.spans.name), spanname);
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
+        end
+
+        function testInvalidCompression(testCase)
+            % testInvalidCompression: unsupported compression algorithms are rejected
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpSpanExporter", "class")), ...
+                "Otlp HTTP exporter must be installed.");
+
+            verifyError(testCase, @()opentelemetry.exporters.otlp.OtlpHttpSpanExporter(...
+                "Compression", "zstd"), "MATLAB:unrecognizedStringChoice");
+        end
+
+        function testConcurrentRequests(testCase)
+            % testConcurrentRequests: export spans with several HTTP
+            % requests in flight over reused connections
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpHttpSpanExporter", "class")), ...
+                "Otlp HTTP exporter must be installed.");
+
+            try
+                exp = opentelemetry.exporters.otlp.OtlpHttpSpanExporter(...
+                    "MaxConcurrentRequests", 4, "MaxRequestsPerConnection", 2);
+            catch me
+                testCase.assumeNotEqual(string(me.identifier), ...
+                    "opentelemetry:exporters:otlp:OtlpValidator:AsyncExportNotSupported", ...
+                    "Asynchronous export must be enabled.");
+                rethrow(me);
+            end
+            verifyEqual(testCase, exp.MaxConcurrentRequests, 4);
+            verifyEqual(testCase, exp.MaxRequestsPerConnection, 2);
+            processor = opentelemetry.sdk.trace.SimpleSpanProcessor(exp);
+            tp = opentelemetry.sdk.trace.TracerProvider(processor);
+            tr = getTracer(tp, "foo");
+            nspans = 6;
+            for i = 1:nspans
+                sp = startSpan(tr, "bar" + i);
+                endSpan(sp);
+            end
+
+            % shutdown waits for requests still in flight
+            clear("sp", "tr", "tp");
+
+            % perform test comparisons, spans may arrive in any order
+            results = readJsonResults(testCase);
+            spannames = string.empty;
+            for i = 1:numel(results)
+                spannames = [spannames; string({results{i}.resourceSpans.scopeSpans.spans.name}')]; %#ok<AGROW>
+            end
+            verifyEqual(testCase, sort(spannames), sort("bar" + (1:nspans)'));
+        end
+
+        function testSharedGrpcClient(testCase)
+            % testSharedGrpcClient: export spans and logs over one shared
+            % gRPC connection
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpGrpcSpanExporter", "class")), ...
+                "Otlp gRPC exporter must be installed.");
+
+            spanexp = opentelemetry.exporters.otlp.OtlpGrpcSpanExporter(SharedClient=true);
+            logexp = opentelemetry.exporters.otlp.OtlpGrpcLogRecordExporter(SharedClient=true);
+            verifyTrue(testCase, spanexp.SharedClient);
+            verifyTrue(testCase, logexp.SharedClient);
+
+            tp = opentelemetry.sdk.trace.TracerProvider(...
+                opentelemetry.sdk.trace.SimpleSpanProcessor(spanexp));
+            lp = opentelemetry.sdk.logs.LoggerProvider(...
+                opentelemetry.sdk.logs.SimpleLogRecordProcessor(logexp));
+            tr = getTracer(tp, "foo");
+            sp = startSpan(tr, "bar");
+            endSpan(sp);
+            lg = getLogger(lp, "foo");
+            emitLogRecord(lg, "info", "baz");
+
+            % shutting down one provider leaves the shared connection open
+            % for the other
+            clear("sp", "tr", "tp");
+            lg = getLogger(lp, "foo");
+            emitLogRecord(lg, "info", "quux");
+            clear("lg", "lp");
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            spannames = string.empty;
+            logbodies = string.empty;
+            for i = 1:numel(results)
+                if isfield(results{i}, "resourceSpans")
+                    spannames = [spannames; string({results{i}.resourceSpans.scopeSpans.spans.name}')]; %#ok<AGROW>
+                else
+                    logrecords = results{i}.resourceLogs.scopeLogs.logRecords;
+                    logbodies = [logbodies; string(arrayfun(@(r)r.body.stringValue, logrecords, UniformOutput=false))]; %#ok<AGROW>
+                end
+            end
+            verifyEqual(testCase, spannames, "bar");
+            verifyEqual(testCase, sort(logbodies), ["baz"; "quux"]);
+        end
     end
 end
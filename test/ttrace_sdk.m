@@ -1,7 +1,7 @@
 classdef ttrace_sdk < matlab.unittest.TestCase
     % tests for tracing SDK (span processors, exporters, samplers, resource)
 
-    % Copyright 2023-2025 The MathWorks, Inc.
+    % Copyright 2023-2026 The MathWorks, Inc.
 
     properties
         OtelConfigFile
@@ -76,6 +76,274 @@ classdef ttrace_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
         end
 
+        function testFanoutSpanProcessor(testCase)
+            % testFanoutSpanProcessor: export spans through multiple
+            % exporters with separate queue settings
+            tracername = "foo";
+            spanname = "bar";
+
+            exporters = {opentelemetry.exporters.otlp.defaultSpanExporter, ...
+                opentelemetry.exporters.otlp.defaultSpanExporter};
+            queuesize = [500 100];
+            policy = ["dropnewest" "dropoldest"];
+            p = opentelemetry.sdk.trace.FanoutSpanProcessor(exporters, ...
+                MaximumQueueSize=queuesize, ...
+                ScheduledDelay=seconds(1), ...
+                DropPolicy=policy);
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, tracername);
+            sp = startSpan(tr, spanname);
+            endSpan(sp);
+
+            % verify properties set correctly
+            verifyEqual(testCase, p.MaximumQueueSize, queuesize);
+            verifyEqual(testCase, p.ScheduledDelay, seconds(1));
+            verifyEqual(testCase, p.DropPolicy, policy);
+            verifyNumElements(testCase, p.SpanExporter, 2);
+
+            % per-exporter values must match the number of exporters
+            verifyError(testCase, @()opentelemetry.sdk.trace.FanoutSpanProcessor(...
+                exporters, MaximumQueueSize=[1 2 3]), ...
+                "opentelemetry:sdk:trace:FanoutSpanProcessor:InvalidMaxQueueSize");
+
+            % perform test comparisons, span should be exported once through each exporter
+            forceFlush(tp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 2);
+            for i = 1:numel(results)
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.spans.name), spanname);
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.scope.name), tracername);
+            end
+        end
+
+        function testRingBufferSpanProcessor(testCase)
+            % testRingBufferSpanProcessor: setting properties of
+            % RingBufferSpanProcessor
+            tracername = "foo";
+            spanname = "bar";
+            queuesize = 500;
+            queuebytes = 1e6;
+            policy = "block";
+            timeout = seconds(0.5);
+            p = opentelemetry.sdk.trace.RingBufferSpanProcessor(...
+                MaximumQueueSize=queuesize, ...
+                MaximumQueueBytes=queuebytes, ...
+                ScheduledDelay=seconds(1), ...
+                FullQueuePolicy=policy, ...
+                BlockTimeout=timeout);
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, tracername);
+            sp = startSpan(tr, spanname);
+            endSpan(sp);
+
+            % verify properties set correctly
+            verifyEqual(testCase, p.MaximumQueueSize, queuesize);
+            verifyEqual(testCase, p.MaximumQueueBytes, queuebytes);
+            verifyEqual(testCase, p.FullQueuePolicy, policy);
+            verifyEqual(testCase, p.BlockTimeout, timeout);
+            verifyError(testCase, @()opentelemetry.sdk.trace.RingBufferSpanProcessor(...
+                MaximumQueueBytes=-1), ...
+                "opentelemetry:sdk:trace:RingBufferSpanProcessor:InvalidMaxQueueBytes");
+
+            % perform test comparisons
+            forceFlush(tp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            results = results{1};
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.spans.name), spanname);
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
+        end
+
+        function testFlightRecorderSpanProcessor(testCase)
+            % testFlightRecorderSpanProcessor: spans are only exported
+            % when dumped or when a span ends with an error status
+            tracername = "foo";
+            spannames = "bar" + (1:3);
+            p = opentelemetry.sdk.trace.FlightRecorderSpanProcessor(...
+                BufferSize=65536, MaximumAge=minutes(5));
+            verifyEqual(testCase, p.BufferSize, 65536);
+            verifyTrue(testCase, p.TriggerOnError);
+            verifyError(testCase, @()opentelemetry.sdk.trace.FlightRecorderSpanProcessor(...
+                BufferSize=0), ...
+                "opentelemetry:sdk:trace:FlightRecorderSpanProcessor:InvalidBufferSize");
+
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, tracername);
+            for i = 1:numel(spannames)
+                sp = startSpan(tr, spannames(i));
+                endSpan(sp);
+            end
+            verifyTrue(testCase, dump(p));
+
+            % a span with an error status dumps the buffer
+            sp = startSpan(tr, "baz");
+            setStatus(sp, "Error");
+            endSpan(sp);
+            clear("sp", "tr", "tp");
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 2);
+            verifyEqual(testCase, string({results{1}.resourceSpans.scopeSpans.spans.name}), spannames);
+            verifyEqual(testCase, string(results{1}.resourceSpans.scopeSpans.scope.name), tracername);
+            verifyEqual(testCase, string(results{2}.resourceSpans.scopeSpans.spans.name), "baz");
+        end
+
+        function testFlightRecorderFile(testCase)
+            % testFlightRecorderFile: spans recorded in a file are kept
+            % after the processor is closed, and dumped by the next
+            % processor that opens the file
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+            filename = fullfile(folderfixture.Folder, "spans.rec");
+            tracername = "foo";
+            spannames = "bar" + (1:3);
+
+            p = opentelemetry.sdk.trace.FlightRecorderSpanProcessor(...
+                FileName=filename, BufferSize=65536);
+            verifyEqual(testCase, p.FileName, string(filename));
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, tracername);
+            for i = 1:numel(spannames)
+                sp = startSpan(tr, spannames(i));
+                endSpan(sp);
+            end
+            shutdown(tp);
+            clear("sp", "tr", "tp", "p");
+            verifyTrue(testCase, isfile(filename));
+
+            % reopen the file and export its spans
+            p = opentelemetry.sdk.trace.FlightRecorderSpanProcessor(...
+                FileName=filename, BufferSize=65536);
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            verifyTrue(testCase, dump(p));
+            clear("tp", "p");
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 1);
+            verifyEqual(testCase, string({results{1}.resourceSpans.scopeSpans.spans.name}), spannames);
+            verifyEqual(testCase, string(results{1}.resourceSpans.scopeSpans.scope.name), tracername);
+        end
+
+        function testProcessorStats(testCase)
+            % testProcessorStats: export pipeline statistics of a span
+            % processor
+            nspans = 3;
+            p = opentelemetry.sdk.trace.BatchSpanProcessor;
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, "foo");
+            for i = 1:nspans
+                sp = startSpan(tr, "bar");
+                endSpan(sp);
+            end
+            forceFlush(tp, testCase.ForceFlushTimeout);
+
+            stats = getStats(p);
+            verifyEqual(testCase, stats.Enqueued, nspans);
+            verifyEqual(testCase, stats.Exported + stats.Failed + stats.Dropped, nspans);
+            verifyEqual(testCase, stats.QueueDepth, 0);
+            verifyEqual(testCase, sum(stats.BatchSize.BucketCounts), stats.BatchSize.Count);
+            verifyEqual(testCase, stats.BatchSize.Sum, stats.Exported + stats.Failed);
+            verifyEqual(testCase, stats.ExportDuration.Count, stats.BatchSize.Count);
+
+            % publish as metrics
+            reader = opentelemetry.sdk.metrics.ManualMetricReader;
+            mp = opentelemetry.sdk.metrics.MeterProvider(reader);
+            publishStats(p, mp);
+            [success, data] = collect(reader);
+            verifyTrue(testCase, success);
+            names = ["enqueued" "dropped" "exported" "failed" "queue.size"];
+            expected = [stats.Enqueued stats.Dropped stats.Exported stats.Failed stats.QueueDepth];
+            for i = 1:numel(names)
+                row = find(data.Name == "otel.matlab.pipeline." + names(i));
+                verifyNumElements(testCase, row, 1);
+                verifyEqual(testCase, data.Value(row), expected(i));
+                verifyEqual(testCase, data.Attributes{row}("otel.signal"), {"traces"});
+            end
+            shutdown(mp);
+        end
+
+        function testSpanLimits(testCase)
+            % testSpanLimits: attributes and events beyond span limits are
+            % truncated or dropped
+            limits = opentelemetry.sdk.trace.SpanLimits("MaximumAttributes", 2, ...
+                "MaximumEvents", 1, "MaximumAttributeValueLength", 3);
+            verifyEqual(testCase, limits.MaximumLinks, Inf);
+            verifyError(testCase, @()opentelemetry.sdk.trace.SpanLimits("MaximumEvents", -1), ...
+                "opentelemetry:sdk:trace:SpanLimits:InvalidMaximumEvents");
+
+            tp = opentelemetry.sdk.trace.TracerProvider("SpanLimits", limits);
+            verifyEqual(testCase, tp.SpanLimits, limits);
+            tr = getTracer(tp, "foo");
+            sp = startSpan(tr, "bar", "Attributes", dictionary("a", "abcdef"));
+            setAttributes(sp, "b", 1, "c", 2);   % "c" exceeds attribute limit
+            setAttributes(sp, "a", "uvwxyz");    % updating existing attribute is allowed
+            addEvent(sp, "event1");
+            addEvent(sp, "event2");              % exceeds event limit
+            endSpan(sp);
+
+            % perform test comparisons
+            forceFlush(tp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            spanresult = results{1}.resourceSpans.scopeSpans.spans;
+            attrkeys = string({spanresult.attributes.key});
+            verifyEqual(testCase, sort(attrkeys), ["a" "b"]);
+            % the updated value is truncated to MaximumAttributeValueLength
+            verifyEqual(testCase, string(spanresult.attributes(attrkeys == "a").value.stringValue), "uvw");
+            verifyLength(testCase, spanresult.events, 1);
+            verifyEqual(testCase, spanresult.events.name, 'event1');
+
+            % byte budget
+            tp = opentelemetry.sdk.trace.TracerProvider("SpanLimits", ...
+                opentelemetry.sdk.trace.SpanLimits("MaximumSpanBytes", 100));
+            tr = getTracer(tp, "foo");
+            sp = startSpan(tr, "bar");
+            setAttributes(sp, "small", 1, "large", 1:100);   % "large" exceeds byte budget
+            % an update replaces the size of the old value in the budget
+            setAttributes(sp, "text", string(repmat('x', 1, 50)));
+            setAttributes(sp, "text", string(repmat('y', 1, 50)));
+            endSpan(sp);
+
+            forceFlush(tp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            spanresult = results{end}.resourceSpans.scopeSpans.spans;
+            attrkeys = string({spanresult.attributes.key});
+            verifyEqual(testCase, sort(attrkeys), ["small" "text"]);
+            verifyEqual(testCase, string(spanresult.attributes(attrkeys == "text").value.stringValue), ...
+                string(repmat('y', 1, 50)));
+        end
+
+        function testArraySummary(testCase)
+            % testArraySummary: large numeric array attributes are replaced
+            % by summary statistics
+            tp = opentelemetry.sdk.trace.TracerProvider("SpanLimits", ...
+                opentelemetry.sdk.trace.SpanLimits("ArraySummaryThreshold", 4));
+            tr = getTracer(tp, "foo");
+            sp = startSpan(tr, "bar");
+            data = [1 2 NaN 4 5; 6 7 8 9 10];
+            setAttributes(sp, "data", data, "small", [1 2 3]);
+            endSpan(sp);
+
+            % perform test comparisons
+            forceFlush(tp, testCase.ForceFlushTimeout);
+            results = readJsonResults(testCase);
+            attrs = results{1}.resourceSpans.scopeSpans.spans.attributes;
+            attrkeys = string({attrs.key});
+            getvalue = @(key)attrs(attrkeys == key).value;
+            verifyEqual(testCase, getvalue("data.min").doubleValue, min(data, [], "all", "omitnan"));
+            verifyEqual(testCase, getvalue("data.max").doubleValue, max(data, [], "all", "omitnan"));
+            verifyEqual(testCase, getvalue("data.mean").doubleValue, mean(data, "all", "omitnan"), "AbsTol", 1e-12);
+            verifyEqual(testCase, getvalue("data.std").doubleValue, std(data(~isnan(data))), "AbsTol", 1e-12);
+            verifyEqual(testCase, string(getvalue("data.nan_count").intValue), "1");
+            verifyEqual(testCase, getvalue("data.l2norm").doubleValue, norm(data(~isnan(data))), "AbsTol", 1e-12);
+            verifyEqual(testCase, strlength(getvalue("data.hash").stringValue), 16);
+            verifyEqual(testCase, [getvalue("data.size").arrayValue.values.doubleValue], size(data));
+            verifyFalse(testCase, any(attrkeys == "data"));
+
+            % arrays at or below the threshold are unchanged
+            verifyTrue(testCase, any(attrkeys == "small"));
+        end
+
         function testAlwaysOffSampler(testCase)
             % testAlwaysOffSampler: should not produce any spans
             tp = opentelemetry.sdk.trace.TracerProvider( ...
@@ -245,6 +513,256 @@ classdef ttrace_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
         end
 
+        function testOtlpBinaryFileExporter(testCase)
+            % testOtlpBinaryFileExporter: write length-delimited binary
+            % protobuf files and read them back
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpFileSpanExporter", "class")), ...
+                "Otlp file exporter must be installed.");
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+
+            output = fullfile(folderfixture.Folder,"output%n.binpb");
+            alias = fullfile(folderfixture.Folder,"output_latest.binpb");
+            exp = opentelemetry.exporters.otlp.OtlpFileSpanExporter(...
+                FileName=output, AliasName=alias, Format="binary");
+            verifyEqual(testCase, exp.Format, "binary");
+
+            tp = opentelemetry.sdk.trace.TracerProvider(...
+                opentelemetry.sdk.trace.SimpleSpanProcessor(exp));
+
+            tracername = "foo";
+            spannames = ["bar" "baz"];
+            tr = getTracer(tp, tracername);
+            ctxts = cell(1, numel(spannames));
+            for i = 1:numel(spannames)
+                sp = startSpan(tr, spannames(i));
+                ctxts{i} = getSpanContext(sp);
+                endSpan(sp);
+            end
+            clear("sp", "tr", "tp");
+
+            % perform test comparisons, each span is a separate record
+            % with hex IDs as in the JSON format
+            results = opentelemetry.exporters.otlp.readOtlpBinaryFile(alias, "traces");
+            verifyNumElements(testCase, results, numel(spannames));
+            for i = 1:numel(spannames)
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.spans.name), spannames(i));
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.scope.name), tracername);
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.spans.traceId), ctxts{i}.TraceId);
+                verifyEqual(testCase, string(results{i}.resourceSpans.scopeSpans.spans.spanId), ctxts{i}.SpanId);
+            end
+        end
+
+        function testReplayOtlpFiles(testCase)
+            % testReplayOtlpFiles: send spans written by a file exporter
+            % through another exporter
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.otlp.OtlpFileSpanExporter", "class")), ...
+                "Otlp file exporter must be installed.");
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+
+            tracername = "foo";
+            spannames = ["bar" "baz" "quux"];
+            formats = ["JSON" "binary"];
+            files = strings(1, numel(formats));
+            for f = 1:numel(formats)
+                files(f) = fullfile(folderfixture.Folder, "trace" + f + ".out");
+                tp = opentelemetry.sdk.trace.TracerProvider(...
+                    opentelemetry.sdk.trace.SimpleSpanProcessor(...
+                    opentelemetry.exporters.otlp.OtlpFileSpanExporter(...
+                    FileName=files(f), Format=formats(f))));
+                tr = getTracer(tp, tracername);
+                for i = 1:numel(spannames)
+                    sp = startSpan(tr, spannames(i));
+                    endSpan(sp);
+                end
+                shutdown(tp);
+            end
+            clear("sp", "tr", "tp");
+
+            result = opentelemetry.exporters.otlp.replayOtlpFiles(files, ...
+                opentelemetry.exporters.otlp.defaultSpanExporter, Workers=2);
+            verifyEqual(testCase, result.Records, numel(formats) * numel(spannames));
+            verifyEqual(testCase, result.InvalidRecords, 0);
+            % failed requests are unknown with asynchronous export
+            verifyTrue(testCase, isnan(result.FailedRequests) || result.FailedRequests == 0);
+
+            % perform test comparisons, spans are merged into one request
+            results = readJsonResults(testCase);
+            verifyNumElements(testCase, results, 1);
+            spans = results{1}.resourceSpans.scopeSpans;
+            verifyEqual(testCase, sort(string({spans.spans.name})), sort(repmat(spannames, 1, numel(formats))));
+        end
+
+        function testParquetSpanExporter(testCase)
+            % testParquetSpanExporter: write spans to a Parquet file and
+            % read them back as a table
+
+            testCase.assumeTrue(logical(exist("opentelemetry.exporters.parquet.ParquetSpanExporter", "class")), ...
+                "Parquet exporter must be installed.");
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+            filename = fullfile(folderfixture.Folder, "trace.parquet");
+
+            % small row groups so that the file has more than one
+            exporter = opentelemetry.exporters.parquet.ParquetSpanExporter(...
+                FileName=filename, MaxRowGroupSize=2);
+            verifyEqual(testCase, exporter.MaxRowGroupSize, 2);
+            tp = opentelemetry.sdk.trace.TracerProvider(...
+                opentelemetry.sdk.trace.SimpleSpanProcessor(exporter));
+            tr = getTracer(tp, "foo", "1.0");
+            spannames = ["bar" "baz" "quux"];
+            for i = 1:numel(spannames)
+                sp = startSpan(tr, spannames(i));
+                setAttributes(sp, "index", i, "label", spannames(i));
+                endSpan(sp);
+            end
+            shutdown(tp);
+            clear("sp", "tr", "tp");
+
+            info = parquetinfo(filename);
+            verifyEqual(testCase, info.NumRowGroups, 2);
+            T = parquetread(filename);
+            verifyEqual(testCase, string(T.name).', spannames);
+            verifyEqual(testCase, unique(string(T.scope_name)), "foo");
+            verifyEqual(testCase, strlength(string(T.trace_id)), repmat(32, numel(spannames), 1));
+            verifyTrue(testCase, all(T.end_time >= T.start_time));
+            keys = string(T.attribute_keys{3});
+            values = string(T.attribute_values{3});
+            verifyEqual(testCase, sort(keys).', ["index" "label"]);
+            verifyEqual(testCase, values(keys == "index"), "3");
+            verifyEqual(testCase, values(keys == "label"), "quux");
+        end
+
+        function testChromeTraceSpanExporter(testCase)
+            % testChromeTraceSpanExporter: write spans in Chrome trace
+            % event format
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+            filename = fullfile(folderfixture.Folder, "trace.json");
+
+            exporter = opentelemetry.sdk.trace.ChromeTraceSpanExporter(FileName=filename);
+            verifyEqual(testCase, exporter.FileName, string(filename));
+            tp = opentelemetry.sdk.trace.TracerProvider(...
+                opentelemetry.sdk.trace.SimpleSpanProcessor(exporter));
+            tr = getTracer(tp, "foo");
+            outer = startSpan(tr, "outer");
+            scope = makeCurrent(outer);
+            inner = startSpan(tr, "inner", "Attributes", dictionary(["count" "ratio"], [3 NaN]));
+            addEvent(inner, "checkpoint");
+            endSpan(inner);
+            clear("scope");
+            endSpan(outer);
+            shutdown(tp);
+            clear("inner", "outer", "tr", "tp");
+
+            % perform test comparisons, events have different fields so
+            % they are decoded into a cell array
+            events = jsondecode(fileread(filename));
+            if ~iscell(events)
+                events = num2cell(events);
+            end
+            phases = cellfun(@(e)string(e.ph), events);
+            complete = events(phases == "X");
+            verifyEqual(testCase, cellfun(@(e)string(e.name), complete), ["inner"; "outer"]);
+            verifyEqual(testCase, complete{1}.args.count, 3);
+            % NaN is written as null, since JSON has no NaN
+            verifyEmpty(testCase, complete{1}.args.ratio);
+            % nested spans are on the same track
+            verifyEqual(testCase, complete{1}.tid, complete{2}.tid);
+            instant = events(phases == "i");
+            verifyNumElements(testCase, instant, 1);
+            verifyEqual(testCase, string(instant{1}.name), "checkpoint");
+            verifyEqual(testCase, instant{1}.tid, complete{1}.tid);
+        end
+
+        function testCollapsedStackSpanProcessor(testCase)
+            % testCollapsedStackSpanProcessor: fold nested spans into a
+            % collapsed stack file
+
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+            filename = fullfile(folderfixture.Folder, "stacks.folded");
+
+            exporter = opentelemetry.sdk.trace.CollapsedStackSpanExporter(...
+                FileName=filename, Metric="Count");
+            processor = opentelemetry.sdk.trace.CollapsedStackSpanProcessor(exporter);
+            verifyEqual(testCase, processor.ExportInterval, seconds(Inf));
+            tp = opentelemetry.sdk.trace.TracerProvider(processor);
+            tr = getTracer(tp, "foo");
+            outer = startSpan(tr, "outer");
+            scope = makeCurrent(outer);
+            for i = 1:3
+                inner = startSpan(tr, "inner");
+                endSpan(inner);
+            end
+            clear("scope");
+            endSpan(outer);
+            shutdown(tp);
+            clear("inner", "outer", "tr", "tp");
+
+            % perform test comparisons, one line per stack
+            lines = readlines(filename, EmptyLineRule="skip");
+            verifyEqual(testCase, lines, ["outer 1"; "outer;inner 3"]);
+        end
+
+        function testSpoolSpanExporter(testCase)
+            % testSpoolSpanExporter: spans exported while the collector is
+            % down are spooled to disk and sent after it restarts
+            folderfixture = testCase.applyFixture(...
+                matlab.unittest.fixtures.TemporaryFolderFixture);
+
+            % stop the collector
+            terminateProcess(testCase, testCase.OtelcolName, testCase.Sigint);
+
+            try
+                exp = opentelemetry.sdk.trace.SpoolSpanExporter(...
+                    opentelemetry.exporters.otlp.defaultSpanExporter, ...
+                    Directory=folderfixture.Folder, SegmentSize=65536, ...
+                    InitialBackoff=seconds(0.5));
+            catch me
+                testCase.assumeNotEqual(string(me.identifier), ...
+                    "opentelemetry:sdk:trace:SpoolSpanExporter:AsynchronousExporter", ...
+                    "Asynchronous export must be disabled.");
+                rethrow(me);
+            end
+            verifyEqual(testCase, exp.Directory, string(folderfixture.Folder));
+            verifyEqual(testCase, exp.SegmentSize, 65536);
+            verifyError(testCase, @()opentelemetry.sdk.trace.SpoolSpanExporter(...
+                opentelemetry.exporters.otlp.defaultSpanExporter, MaxDiskUsage=0), ...
+                "opentelemetry:sdk:trace:SpoolSpanExporter:InvalidMaxDiskUsage");
+
+            tp = opentelemetry.sdk.trace.TracerProvider(...
+                opentelemetry.sdk.trace.SimpleSpanProcessor(exp));
+            tracername = "foo";
+            spanname = "bar";
+            tr = getTracer(tp, tracername);
+
+            % suppress internal error logs about span export failure
+            nologs = SuppressInternalLogs; %#ok<NASGU>
+            sp = startSpan(tr, spanname);
+            endSpan(sp);
+
+            % span should be in the spool
+            verifyNotEmpty(testCase, dir(fullfile(folderfixture.Folder, "segment-*.spool")));
+
+            % restart the collector and send the spooled span
+            commonSetup(testCase);
+            verifyTrue(testCase, forceFlush(tp, testCase.ForceFlushTimeout));
+
+            % perform test comparisons
+            results = readJsonResults(testCase);
+            results = results{1};
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.spans.name), spanname);
+            verifyEqual(testCase, string(results.resourceSpans.scopeSpans.scope.name), tracername);
+        end
+
         function testCustomResource(testCase)
             % testCustomResource: check custom resources are included in
             % emitted spans
@@ -349,4 +867,48 @@ classdef ttrace_sdk < matlab.unittest.TestCase
             verifyEqual(testCase, string(results{1}.resourceSpans.scopeSpans.spans.name), spanname);
         end
     end
-end
\ No newline at end of file
+
+    properties (TestParameter)
+        DropPolicy = {"dropnewest", "dropoldest"};
+    end
+
+    methods (Test)
+        function testFanoutDropPolicy(testCase, DropPolicy)
+            % testFanoutDropPolicy: fill the queue of a fan-out span
+            % processor and check which spans are dropped
+            queuesize = 5;
+            nspans = 500;
+            p = opentelemetry.sdk.trace.FanoutSpanProcessor(...
+                {opentelemetry.exporters.otlp.defaultSpanExporter}, ...
+                MaximumQueueSize=queuesize, ScheduledDelay=hours(1), ...
+                DropPolicy=DropPolicy);
+            tp = opentelemetry.sdk.trace.TracerProvider(p);
+            tr = getTracer(tp, "foo");
+            for i = 1:nspans
+                endSpan(startSpan(tr, "span" + i));
+            end
+            verifyTrue(testCase, forceFlush(tp, testCase.ForceFlushTimeout));
+            stats = getStats(p);
+
+            results = readJsonResults(testCase);
+            names = strings(1,0);
+            for i = 1:numel(results)
+                spans = results{i}.resourceSpans.scopeSpans.spans;
+                names = [names string({spans.name})]; %#ok<AGROW>
+            end
+            % every span is either exported or counted as dropped
+            verifyEqual(testCase, numel(names) + stats.Dropped, nspans);
+            verifyEqual(testCase, numel(unique(names)), numel(names));
+            if DropPolicy == "dropnewest"
+                % spans already in the queue are never dropped, so the
+                % first spans that fill the queue are always exported
+                kept = "span" + (1:queuesize);
+            else
+                % the oldest spans are dropped to make room, so the last
+                % spans are always exported
+                kept = "span" + (nspans-queuesize+1:nspans);
+            end
+            verifyTrue(testCase, all(ismember(kept, names)));
+        end
+    end
+end
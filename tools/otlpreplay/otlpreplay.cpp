@@ -0,0 +1,181 @@
+// Copyright 2026 The MathWorks, Inc.
+
+// Command line tool that sends files written by the OTLP file exporters to a backend, for
+// machines that have to record telemetry offline.
+//
+//    otlpreplay --signal traces|metrics|logs [--protocol http|grpc] [--endpoint URL]
+//               [--header NAME=VALUE]... [--compression none|gzip] [--workers N]
+//               [--batch-bytes N] FILE...
+
+#include "opentelemetry-matlab/exporters/otlp/OtlpFileReplayer.h"
+
+#ifdef WITH_OTLP_HTTP
+#include "opentelemetry/exporters/otlp/otlp_http_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_http_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_http_log_record_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_http_log_record_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_http_metric_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_http_metric_exporter_options.h"
+#endif
+#ifdef WITH_OTLP_GRPC
+#include "opentelemetry/exporters/otlp/otlp_grpc_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_log_record_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_log_record_exporter_options.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_metric_exporter_factory.h"
+#include "opentelemetry/exporters/otlp/otlp_grpc_metric_exporter_options.h"
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace otlp_exporter = opentelemetry::exporter::otlp;
+namespace replay = libmexclass::opentelemetry::exporters;
+
+namespace {
+struct Arguments {
+    std::string signal;
+    std::string protocol = "http";
+    std::string endpoint;
+    std::string compression;
+    std::multimap<std::string, std::string> headers;
+    replay::OtlpFileReplayOptions options;
+    std::vector<std::string> files;
+};
+
+int usage(const char* message) {
+    std::cerr << "otlpreplay: " << message << "\n"
+	    << "usage: otlpreplay --signal traces|metrics|logs [--protocol http|grpc] [--endpoint URL]\n"
+	    << "                  [--header NAME=VALUE]... [--compression none|gzip] [--workers N]\n"
+	    << "                  [--batch-bytes N] FILE...\n";
+    return 2;
+}
+
+bool parseArguments(int argc, char** argv, Arguments& args) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasvalue = i + 1 < argc;
+        if (arg.compare(0, 2, "--") != 0) {
+            args.files.push_back(arg);
+        } else if (!hasvalue) {
+            return false;
+        } else if (arg == "--signal") {
+            args.signal = argv[++i];
+        } else if (arg == "--protocol") {
+            args.protocol = argv[++i];
+        } else if (arg == "--endpoint") {
+            args.endpoint = argv[++i];
+        } else if (arg == "--compression") {
+            args.compression = argv[++i];
+        } else if (arg == "--header") {
+            std::string header = argv[++i];
+            size_t eq = header.find('=');
+            if (eq == std::string::npos) {
+                return false;
+            }
+            args.headers.emplace(header.substr(0, eq), header.substr(eq + 1));
+        } else if (arg == "--workers") {
+            args.options.workers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--batch-bytes") {
+            args.options.max_batch_bytes = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return (args.signal == "traces" || args.signal == "metrics" || args.signal == "logs")
+	    && (args.protocol == "http" || args.protocol == "grpc") && !args.files.empty()
+	    && args.options.workers > 0 && args.options.max_batch_bytes > 0;
+}
+
+// Apply the common command line options to the options struct of an exporter
+template <typename Options>
+void setHttpOptions(const Arguments& args, Options& options) {
+    if (!args.endpoint.empty()) {
+        options.url = args.endpoint;
+    }
+    if (!args.compression.empty()) {
+        options.compression = args.compression;
+    }
+    for (const auto& header : args.headers) {
+        options.http_headers.insert(header);
+    }
+}
+
+template <typename Options>
+void setGrpcOptions(const Arguments& args, Options& options) {
+    if (!args.endpoint.empty()) {
+        options.endpoint = args.endpoint;
+    }
+    if (!args.compression.empty()) {
+        options.compression = args.compression;
+    }
+    for (const auto& header : args.headers) {
+        options.metadata.insert(header);
+    }
+}
+
+replay::OtlpFileReplayResult replayFiles(const Arguments& args) {
+#ifdef WITH_OTLP_HTTP
+    if (args.protocol == "http") {
+        if (args.signal == "traces") {
+            otlp_exporter::OtlpHttpExporterOptions options;
+            setHttpOptions(args, options);
+            return replay::replayTraceFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpHttpExporterFactory::Create(options); }, args.options);
+        } else if (args.signal == "metrics") {
+            otlp_exporter::OtlpHttpMetricExporterOptions options;
+            setHttpOptions(args, options);
+            return replay::replayMetricFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpHttpMetricExporterFactory::Create(options); }, args.options);
+        } else {
+            otlp_exporter::OtlpHttpLogRecordExporterOptions options;
+            setHttpOptions(args, options);
+            return replay::replayLogFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpHttpLogRecordExporterFactory::Create(options); }, args.options);
+        }
+    }
+#endif
+#ifdef WITH_OTLP_GRPC
+    if (args.protocol == "grpc") {
+        if (args.signal == "traces") {
+            otlp_exporter::OtlpGrpcExporterOptions options;
+            setGrpcOptions(args, options);
+            return replay::replayTraceFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpGrpcExporterFactory::Create(options); }, args.options);
+        } else if (args.signal == "metrics") {
+            otlp_exporter::OtlpGrpcMetricExporterOptions options;
+            setGrpcOptions(args, options);
+            return replay::replayMetricFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpGrpcMetricExporterFactory::Create(options); }, args.options);
+        } else {
+            otlp_exporter::OtlpGrpcLogRecordExporterOptions options;
+            setGrpcOptions(args, options);
+            return replay::replayLogFiles(args.files,
+			    [&options] { return otlp_exporter::OtlpGrpcLogRecordExporterFactory::Create(options); }, args.options);
+        }
+    }
+#endif
+    std::cerr << "otlpreplay: protocol " << args.protocol << " is not included in this build\n";
+    std::exit(2);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Arguments args;
+    if (!parseArguments(argc, argv, args)) {
+        return usage("invalid arguments");
+    }
+    replay::OtlpFileReplayResult result = replayFiles(args);
+    std::cout << "records: " << result.records << ", invalid records: " << result.invalid_records
+	    << ", unreadable files: " << result.failed_files << ", requests: " << result.batches;
+#ifdef ENABLE_ASYNC_EXPORT
+    // the exporters report success once a request is queued, so failed requests are not known
+    std::cout << ", failed requests: unknown (asynchronous export)" << std::endl;
+#else
+    std::cout << ", failed requests: " << result.failed_batches << std::endl;
+#endif
+    return result.failed_files == 0 && result.failed_batches == 0 ? 0 : 1;
+}